@@ -19,23 +19,19 @@
 #include "comms-base.hpp"
 
 COMMS_BASE::COMMS_BASE(QObject *parent) :
-    QObject(parent)
+    QObject(parent),
+    rx_signalled(0),
+    tx_signalled(0),
+    rx_blocked(0),
+    tx_blocked(0)
 {
-    // Create new locks
-    readLock = new QMutex(QMutex::Recursive);
-    writeLock = new QMutex(QMutex::Recursive);
-    initSuccess = (readLock && writeLock);
-    if (!initSuccess) return;
-
     // Set variables
+    initSuccess = true;
     connected = false;
 }
 
 COMMS_BASE::~COMMS_BASE()
 {
-    // Delete locks
-    delete readLock;
-    delete writeLock;
 }
 
 void COMMS_BASE::open()
@@ -55,6 +51,29 @@ bool COMMS_BASE::initSuccessful()
     return initSuccess;
 }
 
+QByteArray COMMS_BASE::readQueued()
+{
+    // Clear wakeup before draining so no push is missed
+    rx_signalled.storeRelease(0);
+    QByteArray data = rxQueue.pop_all();
+
+    // Producer had overflow, have it move in now that there is space
+    if (rx_blocked.testAndSetOrdered(1, 0))
+        QMetaObject::invokeMethod(this, "flush_reads", Qt::QueuedConnection);
+
+    return data;
+}
+
+void COMMS_BASE::writeQueued(QByteArray writeData)
+{
+    // Queue data (overflow held until device thread drains)
+    if (!txQueue.push(writeData)) tx_blocked.storeRelease(1);
+
+    // Wake device thread once per drain
+    if (tx_signalled.testAndSetOrdered(0, 1))
+        QMetaObject::invokeMethod(this, "flush_writes", Qt::QueuedConnection);
+}
+
 void COMMS_BASE::close()
 {
     connected = false;
@@ -62,16 +81,44 @@ void COMMS_BASE::close()
 
 void COMMS_BASE::write(QByteArray)
 {
-    writeLock->lock();
-    writeLock->unlock();
+    // Default drops data
 }
 
 void COMMS_BASE::read()
 {
-    readLock->lock();
+    // Default has nothing to read
+    queue_read(QByteArray());
+}
 
-    QByteArray recvData;
-    emit readyRead(recvData);
+void COMMS_BASE::flush_reads()
+{
+    // Retry moving held overflow into the queue
+    queue_read(QByteArray());
+}
+
+void COMMS_BASE::flush_writes()
+{
+    // Clear wakeup before draining so no push is missed
+    tx_signalled.storeRelease(0);
+    QByteArray data = txQueue.pop_all();
+    if (!data.isEmpty()) write(data);
+
+    // Let bridge know the queue has space again
+    if (tx_blocked.testAndSetOrdered(1, 0))
+    {
+        // Overflow is producer owned so bridge must push it through
+        emit writeSpaceAvailable();
+    }
+}
+
+void COMMS_BASE::queue_read(QByteArray recvData)
+{
+    // Queue data (overflow held until bridge drains)
+    if (!rxQueue.push(recvData)) rx_blocked.storeRelease(1);
 
-    readLock->unlock();
+    // Wake bridge once per drain
+    // (also wake on held overflow in case bridge emptied the ring mid-push)
+    if ((rxQueue.available() || rxQueue.hasPending())
+            && rx_signalled.testAndSetOrdered(0, 1))
+        emit dataAvailable();
 }
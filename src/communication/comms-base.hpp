@@ -20,7 +20,9 @@
 #define COMMS_BASE_H
 
 #include <QObject>
-#include <QMutex>
+#include <QAtomicInt>
+
+#include "spsc-byte-queue.hpp"
 
 class COMMS_BASE : public QObject
 {
@@ -34,10 +36,18 @@ public:
     virtual bool isConnected();
     virtual bool initSuccessful();
 
+    // Queue access (safe to call from the bridge thread)
+    // readQueued() is the rx consumer, writeQueued() the tx producer
+    QByteArray readQueued();
+    void writeQueued(QByteArray writeData);
+
 signals:
     void deviceConnected();
     void deviceDisconnected();
-    void readyRead(QByteArray readData);
+
+    // Wakeups (only emitted on empty -> non-empty & full -> space)
+    void dataAvailable();
+    void writeSpaceAvailable();
 
 public slots:
     virtual void close();
@@ -46,12 +56,27 @@ public slots:
 protected slots:
     virtual void read();
 
+    // Queue drains (run in the device thread)
+    void flush_reads();
+    void flush_writes();
+
 protected:
-    QMutex *readLock;
-    QMutex *writeLock;
+    // Called by transports with newly received data
+    void queue_read(QByteArray recvData);
 
     bool connected;
     bool initSuccess;
+
+private:
+    // Transport -> bridge & bridge -> transport queues
+    SPSC_BYTE_QUEUE rxQueue;
+    SPSC_BYTE_QUEUE txQueue;
+
+    // Wakeup state (prevents a signal per packet)
+    QAtomicInt rx_signalled;
+    QAtomicInt tx_signalled;
+    QAtomicInt rx_blocked;
+    QAtomicInt tx_blocked;
 };
 
 #endif // COMMS_BASE_H
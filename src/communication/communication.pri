@@ -1,13 +1,23 @@
 SOURCES += \
     $$PWD/comms-base.cpp \
+    $$PWD/link-emulator.cpp \
+    $$PWD/link-emulator-mcu.cpp \
     $$PWD/serial-com-port.cpp \
+    $$PWD/serial-hotplug.cpp \
+    $$PWD/spsc-byte-queue.cpp \
     $$PWD/tcp-client.cpp \
     $$PWD/tcp-server.cpp \
+    $$PWD/tcp-server-client.cpp \
     $$PWD/udp-socket.cpp
 
 HEADERS += \
     $$PWD/comms-base.hpp \
+    $$PWD/link-emulator.hpp \
+    $$PWD/link-emulator-mcu.hpp \
     $$PWD/serial-com-port.hpp \
+    $$PWD/serial-hotplug.hpp \
+    $$PWD/spsc-byte-queue.hpp \
     $$PWD/tcp-client.hpp \
     $$PWD/tcp-server.hpp \
+    $$PWD/tcp-server-client.hpp \
     $$PWD/udp-socket.hpp
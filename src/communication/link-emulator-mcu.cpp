@@ -0,0 +1,251 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "link-emulator-mcu.hpp"
+
+#include <QtEndian>
+
+#include "../uc-interfaces/uc-generic-files/uc-generic-fsm.h"
+#include "../uc-interfaces/uc-generic-files/uc-generic-io.h"
+#include "../uc-interfaces/uc-generic-files/uc-generic-data-transmit.h"
+#include "../uc-interfaces/uc-generic-files/uc-generic-programmer.h"
+
+// Setup static running instance
+QMutex LINK_EMULATOR_MCU::activeLock;
+LINK_EMULATOR_MCU *LINK_EMULATOR_MCU::active = nullptr;
+
+LINK_EMULATOR_MCU::LINK_EMULATOR_MCU(QObject *parent) :
+    QThread(parent)
+{
+    // Set variables
+    stop_requested = false;
+    reset();
+}
+
+LINK_EMULATOR_MCU::~LINK_EMULATOR_MCU()
+{
+    stop_mcu();
+}
+
+bool LINK_EMULATOR_MCU::start_mcu()
+{
+    // Claim FSM (global state so only one instance allowed)
+    activeLock.lock();
+    bool claimed = (!active || (active == this));
+    if (claimed) active = this;
+    activeLock.unlock();
+    if (!claimed) return false;
+
+    // Start FSM thread
+    stop_requested = false;
+    if (!isRunning()) start();
+    return true;
+}
+
+void LINK_EMULATOR_MCU::stop_mcu()
+{
+    // Verify running instance
+    if (get_active() != this) return;
+
+    // Tell FSM to exit & wake any waits
+    rxLock.lock();
+    stop_requested = true;
+    fsm_exit();
+    rxWait.wakeAll();
+    rxLock.unlock();
+
+    // Wait for FSM to finish then release
+    wait();
+    activeLock.lock();
+    active = nullptr;
+    activeLock.unlock();
+}
+
+void LINK_EMULATOR_MCU::deliver(QByteArray data)
+{
+    // Add to receive buffer & wake FSM
+    rxLock.lock();
+    rx_buffer.append(data);
+    rxWait.wakeAll();
+    rxLock.unlock();
+}
+
+LINK_EMULATOR_MCU *LINK_EMULATOR_MCU::get_active()
+{
+    QMutexLocker locker(&activeLock);
+    return active;
+}
+
+void LINK_EMULATOR_MCU::run()
+{
+    // Start uC clock & setup FSM (clears any exit flag)
+    clock.start();
+    fsm_setup(32);
+
+    // Handle stop requested before setup finished
+    rxLock.lock();
+    if (stop_requested) fsm_exit();
+    rxLock.unlock();
+
+    // Run FSM (returns after fsm_exit())
+    fsm_poll();
+
+    // Free FSM buffers (next start sets up again)
+    fsm_destroy();
+}
+
+void LINK_EMULATOR_MCU::reset()
+{
+    // Clear pins
+    memset(dio_values, 0, sizeof(dio_values));
+    memset(aio_values, 0, sizeof(aio_values));
+
+    // Clear buffers
+    reset_buffers();
+}
+
+void LINK_EMULATOR_MCU::reset_buffers()
+{
+    rxLock.lock();
+    rx_buffer.clear();
+    rxLock.unlock();
+}
+
+uint8_t LINK_EMULATOR_MCU::getch()
+{
+    // Remove & return first byte (0 if empty)
+    QMutexLocker locker(&rxLock);
+    if (rx_buffer.isEmpty()) return 0;
+
+    uint8_t ch = (uint8_t) rx_buffer.at(0);
+    rx_buffer.remove(0, 1);
+    return ch;
+}
+
+uint32_t LINK_EMULATOR_MCU::bytes_available()
+{
+    QMutexLocker locker(&rxLock);
+    return rx_buffer.length();
+}
+
+void LINK_EMULATOR_MCU::delay_ms(uint32_t ms)
+{
+    // Sleep until timeout or new data arrives
+    // (FSM only delays while waiting for bytes)
+    rxLock.lock();
+    if (!stop_requested) rxWait.wait(&rxLock, ms);
+    rxLock.unlock();
+}
+
+uint32_t LINK_EMULATOR_MCU::millis()
+{
+    return (uint32_t) clock.elapsed();
+}
+
+uint32_t LINK_EMULATOR_MCU::micros()
+{
+    return (uint32_t) (clock.nsecsElapsed() / 1000);
+}
+
+uint8_t LINK_EMULATOR_MCU::send(uint8_t *data, uint32_t data_len)
+{
+    // Pass bytes onto the link
+    emit transmit(QByteArray((const char*) data, data_len));
+    return data_len;
+}
+
+void LINK_EMULATOR_MCU::pin_write(bool dio, uint8_t pin_num, uint16_t value)
+{
+    if (dio && (pin_num < num_dio_pins)) dio_values[pin_num] = value;
+    else if (!dio && (pin_num < num_aio_pins)) aio_values[pin_num] = value;
+}
+
+uint16_t LINK_EMULATOR_MCU::pin_read(bool dio, uint8_t pin_num)
+{
+    if (dio && (pin_num < num_dio_pins)) return dio_values[pin_num];
+    else if (!dio && (pin_num < num_aio_pins)) return aio_values[pin_num];
+    else return 0;
+}
+
+uint16_t *LINK_EMULATOR_MCU::pin_read_all(bool dio)
+{
+    // Compose data (convert to big endian)
+    uint8_t num_pins = dio ? num_dio_pins : num_aio_pins;
+    for (uint8_t i = 0; i < num_pins; i++)
+    {
+        read_all_buffer[i] = qToBigEndian(pin_read(dio, i));
+    }
+    return read_all_buffer;
+}
+
+/*** uc-generic-fsm extern functions (forwarded to running instance) ***/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void uc_reset() { LINK_EMULATOR_MCU::get_active()->reset(); }
+void uc_reset_buffers() { LINK_EMULATOR_MCU::get_active()->reset_buffers(); }
+uint8_t uc_getch() { return LINK_EMULATOR_MCU::get_active()->getch(); }
+void uc_delay_us(uint32_t us) { QThread::usleep(us); }
+void uc_delay_ms(uint32_t ms) { LINK_EMULATOR_MCU::get_active()->delay_ms(ms); }
+uint32_t uc_bytes_available() { return LINK_EMULATOR_MCU::get_active()->bytes_available(); }
+uint8_t uc_send(uint8_t* data, uint32_t data_len) { return LINK_EMULATOR_MCU::get_active()->send(data, data_len); }
+
+#ifdef UC_IO
+uint16_t uc_dio_read(uint8_t pin_num) { return LINK_EMULATOR_MCU::get_active()->pin_read(true, pin_num); }
+uint16_t* uc_dio_read_all() { return LINK_EMULATOR_MCU::get_active()->pin_read_all(true); }
+void uc_aio_set(uint8_t, uint8_t) { /* Do Nothing*/ }
+void uc_aio_write(uint8_t pin_num, uint16_t value) { LINK_EMULATOR_MCU::get_active()->pin_write(false, pin_num, value); }
+uint16_t uc_aio_read(uint8_t pin_num) { return LINK_EMULATOR_MCU::get_active()->pin_read(false, pin_num); }
+uint16_t* uc_aio_read_all() { return LINK_EMULATOR_MCU::get_active()->pin_read_all(false); }
+void uc_remote_conn() { /* Do Nothing*/ }
+uint32_t uc_millis() { return LINK_EMULATOR_MCU::get_active()->millis(); }
+uint32_t uc_micros() { return LINK_EMULATOR_MCU::get_active()->micros(); }
+void uc_critical_enter() { /* Do Nothing*/ }
+void uc_critical_exit() { /* Do Nothing*/ }
+const uint8_t uc_dio_num_pins = LINK_EMULATOR_MCU::num_dio_pins;
+const uint8_t uc_aio_num_pins = LINK_EMULATOR_MCU::num_aio_pins;
+#endif
+
+#if defined(UC_IO) || defined(UC_PROGRAMMER)
+void uc_dio_set(uint8_t, uint8_t) { /* Do Nothing*/ }
+void uc_dio_write(uint8_t pin_num, uint16_t value) { LINK_EMULATOR_MCU::get_active()->pin_write(true, pin_num, value); }
+#endif
+
+#ifdef UC_DATA_TRANSMIT
+void uc_data_handle(const uint8_t*, uint8_t)  { /* Do Nothing*/ }
+#endif
+
+#ifdef UC_PROGRAMMER
+bool uc_programmer_setup(uint8_t)  { return true; }
+bool uc_programmer_write(uint8_t, uint8_t, const uint8_t*, uint32_t) { return true; }
+void spi_exchange_bytes(const uint8_t*, const uint8_t*, uint32_t) { /* Do Nothing*/ }
+const uint8_t UC_DIO_SET_INPUT = 0;
+const uint8_t UC_DIO_SET_OUTPUT = 1;
+const uint8_t UC_PROGRAMMER_RESET_PIN = 0;
+#endif
+
+#ifdef UC_CUSTOM_CMD
+void uc_custom_cmd(uint8_t, uint8_t, const uint8_t*, uint32_t) { /* Do Nothing*/ }
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,93 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LINK_EMULATOR_MCU_H
+#define LINK_EMULATOR_MCU_H
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+#include <QByteArray>
+
+// Runs the generic uC FSM (uc-generic-files) in process.
+// The FSM keeps global state so only one instance can run at a time.
+class LINK_EMULATOR_MCU : public QThread
+{
+    Q_OBJECT
+
+public:
+    LINK_EMULATOR_MCU(QObject *parent = NULL);
+    ~LINK_EMULATOR_MCU();
+
+    // Start & stop the FSM (start fails if another instance is running)
+    bool start_mcu();
+    void stop_mcu();
+
+    // Bytes arriving at the uC receive buffer (thread safe)
+    void deliver(QByteArray data);
+
+    // Simulated pin counts (match Arduino Uno example)
+    static const uint8_t num_dio_pins = 14;
+    static const uint8_t num_aio_pins = 6;
+
+    // Running instance (used by the FSM extern hooks)
+    static LINK_EMULATOR_MCU *get_active();
+
+    // FSM hook helpers (only called from the FSM thread)
+    void reset();
+    void reset_buffers();
+    uint8_t getch();
+    uint32_t bytes_available();
+    void delay_ms(uint32_t ms);
+    uint32_t millis();
+    uint32_t micros();
+    uint8_t send(uint8_t *data, uint32_t data_len);
+    void pin_write(bool dio, uint8_t pin_num, uint16_t value);
+    uint16_t pin_read(bool dio, uint8_t pin_num);
+    uint16_t *pin_read_all(bool dio);
+
+signals:
+    // Bytes sent by the uC (emitted from the FSM thread)
+    void transmit(QByteArray data);
+
+protected:
+    virtual void run();
+
+private:
+    // Receive buffer
+    QMutex rxLock;
+    QWaitCondition rxWait;
+    QByteArray rx_buffer;
+
+    bool stop_requested;
+
+    // uC clock (started with FSM)
+    QElapsedTimer clock;
+
+    // Simulated pin state (outputs loop back on read)
+    uint16_t dio_values[num_dio_pins];
+    uint16_t aio_values[num_aio_pins];
+    uint16_t read_all_buffer[num_dio_pins];
+
+    // Running instance
+    static QMutex activeLock;
+    static LINK_EMULATOR_MCU *active;
+};
+
+#endif // LINK_EMULATOR_MCU_H
@@ -0,0 +1,217 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "link-emulator.hpp"
+
+LINK_EMULATOR::LINK_EMULATOR(Link_Emulator_Settings *link_settings, QObject *parent) :
+    COMMS_BASE(parent),
+    link_timer(this)
+{
+    // Create far end uC
+    mcu = new LINK_EMULATOR_MCU(this);
+    initSuccess = (initSuccess && mcu);
+    if (!initSuccess) return;
+
+    // Set variables
+    set_settings(link_settings);
+    for (uint8_t i = 0; i < LINK_NUM_DIRECTIONS; i++)
+    {
+        links[i].wire_free_at = 0;
+    }
+
+    // Setup link timer (rearmed for next delivery)
+    link_timer.setSingleShot(true);
+    link_timer.setTimerType(Qt::PreciseTimer);
+
+    // Connect link signals and slots
+    // Use queued connection to return uC sends to this thread
+    connect(mcu, SIGNAL(transmit(QByteArray)),
+            this, SLOT(mcu_transmit(QByteArray)),
+            Qt::QueuedConnection);
+    connect(&link_timer, SIGNAL(timeout()),
+            this, SLOT(process_link()),
+            Qt::DirectConnection);
+}
+
+LINK_EMULATOR::~LINK_EMULATOR()
+{
+    if (isConnected()) close();
+
+    delete mcu;
+}
+
+void LINK_EMULATOR::open()
+{
+    // Start far end uC (fails if one already running)
+    if (!mcu->start_mcu())
+    {
+        emit deviceDisconnected();
+        return;
+    }
+
+    // Start link clock
+    link_clock.start();
+    connected = true;
+    emit deviceConnected();
+}
+
+bool LINK_EMULATOR::isConnected()
+{
+    return (connected && mcu->isRunning());
+}
+
+void LINK_EMULATOR::set_settings(Link_Emulator_Settings *link_settings)
+{
+    // Copy settings & reseed
+    settings = *link_settings;
+    link_rand.seed(settings.seed);
+}
+
+uint16_t LINK_EMULATOR::pin_read(bool dio, uint8_t pin_num)
+{
+    // Read straight from far end uC
+    return mcu->pin_read(dio, pin_num);
+}
+
+void LINK_EMULATOR::close()
+{
+    // Stop link
+    connected = false;
+    link_timer.stop();
+    mcu->stop_mcu();
+
+    // Drop anything still on the wire
+    for (uint8_t i = 0; i < LINK_NUM_DIRECTIONS; i++)
+    {
+        links[i].deliver_at.clear();
+        links[i].data.clear();
+        links[i].wire_free_at = 0;
+    }
+}
+
+void LINK_EMULATOR::write(QByteArray writeData)
+{
+    // Put data on the link to the device
+    if (connected) queue_data(LINK_TO_DEVICE, writeData);
+}
+
+void LINK_EMULATOR::mcu_transmit(QByteArray data)
+{
+    // Put data on the link to the host
+    if (connected) queue_data(LINK_TO_HOST, data);
+}
+
+void LINK_EMULATOR::process_link()
+{
+    // Get current link time
+    qint64 now = link_clock.nsecsElapsed() / 1000;
+
+    // Deliver all due data
+    Link_Direction *link;
+    for (uint8_t i = 0; i < LINK_NUM_DIRECTIONS; i++)
+    {
+        link = &links[i];
+        while (!link->deliver_at.isEmpty() && (link->deliver_at.first() <= now))
+        {
+            link->deliver_at.removeFirst();
+            if (i == LINK_TO_DEVICE)
+            {
+                mcu->deliver(link->data.takeFirst());
+            } else
+            {
+                // Queue for bridge
+                queue_read(link->data.takeFirst());
+            }
+        }
+    }
+
+    // Wait for next delivery
+    start_link_timer();
+}
+
+void LINK_EMULATOR::queue_data(uint8_t direction, QByteArray data)
+{
+    // Drop entire write
+    if (random_event(settings.drop_rate)) return;
+
+    // Corrupt bytes (flip one random bit)
+    for (int i = 0; i < data.length(); i++)
+    {
+        if (random_event(settings.corrupt_rate))
+            data[i] = data.at(i) ^ (char) (1 << (link_rand() % 8));
+    }
+
+    // Schedule data (twice if duplicated)
+    schedule_data(direction, data);
+    if (random_event(settings.duplicate_rate)) schedule_data(direction, data);
+
+    // Wait for next delivery
+    start_link_timer();
+}
+
+void LINK_EMULATOR::schedule_data(uint8_t direction, QByteArray data)
+{
+    Link_Direction *link = &links[direction];
+    qint64 now = link_clock.nsecsElapsed() / 1000;
+
+    // Wire is busy for 10 bits per byte (start + 8 data + stop)
+    qint64 wire_us = 0;
+    if (settings.bits_per_sec)
+        wire_us = ((qint64) data.length() * 10 * 1000000) / settings.bits_per_sec;
+    link->wire_free_at = qMax(now, link->wire_free_at) + wire_us;
+
+    // Add latency & jitter
+    qint64 deliver_at = link->wire_free_at + ((qint64) settings.latency_ms * 1000);
+    if (settings.jitter_ms)
+    {
+        std::uniform_int_distribution<qint64> jitter(-((qint64) settings.jitter_ms * 1000),
+                                                     (qint64) settings.jitter_ms * 1000);
+        deliver_at += jitter(link_rand);
+    }
+
+    // Serial links never reorder data
+    if (!link->deliver_at.isEmpty()) deliver_at = qMax(deliver_at, link->deliver_at.last());
+
+    // Add to link
+    link->deliver_at.append(deliver_at);
+    link->data.append(data);
+}
+
+bool LINK_EMULATOR::random_event(double rate)
+{
+    if (rate <= 0.0) return false;
+    return (std::uniform_real_distribution<double>(0.0, 1.0)(link_rand) < rate);
+}
+
+void LINK_EMULATOR::start_link_timer()
+{
+    // Find next delivery
+    qint64 next = -1;
+    for (uint8_t i = 0; i < LINK_NUM_DIRECTIONS; i++)
+    {
+        if (links[i].deliver_at.isEmpty()) continue;
+        if ((next == -1) || (links[i].deliver_at.first() < next))
+            next = links[i].deliver_at.first();
+    }
+    if (next == -1) return;
+
+    // Arm timer (rounded up to next ms)
+    qint64 now = link_clock.nsecsElapsed() / 1000;
+    qint64 wait_ms = (next <= now) ? 0 : ((next - now + 999) / 1000);
+    link_timer.start((int) wait_ms);
+}
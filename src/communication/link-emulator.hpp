@@ -0,0 +1,96 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LINK_EMULATOR_H
+#define LINK_EMULATOR_H
+
+#include "comms-base.hpp"
+#include "link-emulator-mcu.hpp"
+#include <QTimer>
+#include <QElapsedTimer>
+#include <random>
+
+typedef struct {
+    uint32_t latency_ms;    // One-way latency
+    uint32_t jitter_ms;     // Random +/- latency (order preserved)
+    uint32_t bits_per_sec;  // Wire speed with 10 bits per byte (0 = unlimited)
+    double corrupt_rate;    // Per byte probability of a bit flip
+    double drop_rate;       // Per write probability of dropping it
+    double duplicate_rate;  // Per write probability of sending it twice
+    uint32_t seed;          // Random seed (same seed = same errors)
+} Link_Emulator_Settings;
+#define Link_Emulator_Settings_DEFAULT Link_Emulator_Settings{\
+    .latency_ms=0, .jitter_ms=0, .bits_per_sec=0,\
+    .corrupt_rate=0.0, .drop_rate=0.0, .duplicate_rate=0.0,\
+    .seed=0}
+
+class LINK_EMULATOR : public COMMS_BASE
+{
+    Q_OBJECT
+
+public:
+    LINK_EMULATOR(Link_Emulator_Settings *link_settings, QObject *parent = NULL);
+    ~LINK_EMULATOR();
+
+    virtual void open();
+    virtual bool isConnected();
+
+    // Update link settings (applies to new writes)
+    void set_settings(Link_Emulator_Settings *link_settings);
+
+    // Simulated uC pin value (stable once the FSM is idle)
+    uint16_t pin_read(bool dio, uint8_t pin_num);
+
+public slots:
+    virtual void close();
+    virtual void write(QByteArray writeData);
+
+private slots:
+    void mcu_transmit(QByteArray data);
+    void process_link();
+
+private:
+    // One direction of the link
+    typedef struct {
+        QList<qint64> deliver_at;   // Delivery times (us since open)
+        QList<QByteArray> data;     // Data to deliver
+        qint64 wire_free_at;        // Wire busy until (us since open)
+    } Link_Direction;
+    typedef enum {
+        LINK_TO_DEVICE = 0,
+        LINK_TO_HOST,
+        LINK_NUM_DIRECTIONS
+    } LINK_DIRECTIONS_ENUM;
+
+    Link_Emulator_Settings settings;
+    Link_Direction links[LINK_NUM_DIRECTIONS];
+    LINK_EMULATOR_MCU *mcu;
+
+    // Link timing & error injection
+    QTimer link_timer;
+    QElapsedTimer link_clock;
+    std::mt19937 link_rand;
+
+    // Link helpers
+    void queue_data(uint8_t direction, QByteArray data);
+    void schedule_data(uint8_t direction, QByteArray data);
+    bool random_event(double rate);
+    void start_link_timer();
+};
+
+#endif // LINK_EMULATOR_H
@@ -57,12 +57,17 @@ void SERIAL_COM_PORT::open()
         return;
     }
 
+    // Close any previous (lost) connection before reopening
+    if (serial_com_port->isOpen()) serial_com_port->close();
+
+    // Opening asserts DTR, restarting auto-reset boards (e.g. Arduino)
     connected = serial_com_port->open(QIODevice::ReadWrite);
     if (isConnected())
     {
+        // Unique so reopening does not stack connections
         connect(serial_com_port, SIGNAL(errorOccurred(QSerialPort::SerialPortError)),
                 this, SLOT(checkError(QSerialPort::SerialPortError)),
-                Qt::DirectConnection);
+                (Qt::ConnectionType) (Qt::DirectConnection | Qt::UniqueConnection));
         emit deviceConnected();
     } else
     {
@@ -95,34 +100,25 @@ void SERIAL_COM_PORT::close()
 
 void SERIAL_COM_PORT::write(QByteArray writeData)
 {
-    // Acquire Lock
-    writeLock->lock();
-
     // Write data (try to force start)
     serial_com_port->write((const QByteArray) writeData);
     serial_com_port->flush();
-
-    // Unlock lock
-    writeLock->unlock();
 }
 
 void SERIAL_COM_PORT::read()
 {
-    // Acquire Lock
-    readLock->lock();
-
     // Read data
     QByteArray recvData = serial_com_port->readAll();
 
-    // Emit signal
-    emit readyRead(recvData);
-
-    // Unlock lock
-    readLock->unlock();
+    // Queue for bridge
+    queue_read(recvData);
 }
 
-void SERIAL_COM_PORT::checkError(QSerialPort::SerialPortError)
+void SERIAL_COM_PORT::checkError(QSerialPort::SerialPortError error)
 {
+    // Ignore cleared errors & errors after the link is already lost
+    if ((error == QSerialPort::NoError) || !connected) return;
+
     connected = false;
     emit deviceDisconnected();
 }
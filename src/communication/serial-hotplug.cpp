@@ -0,0 +1,99 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "serial-hotplug.hpp"
+
+#include <QSerialPortInfo>
+
+// Setup static watch path
+const QString SERIAL_HOTPLUG::watch_path = "/dev";
+
+SERIAL_HOTPLUG::SERIAL_HOTPLUG(QObject *parent) :
+    QObject(parent),
+    dev_watcher(this),
+    refresh_timer(this)
+{
+    // Try to watch device directory
+    watching = dev_watcher.addPath(watch_path);
+
+    // Setup refresh timer
+    // Watching: single shot to let node creation settle
+    // Not watching: poll for changes
+    refresh_timer.setSingleShot(watching);
+    refresh_timer.setInterval(watching ? settle_time_ms : poll_time_ms);
+
+    // Connect watch signals and slots
+    // All internal object connections so direct is okay
+    connect(&dev_watcher, SIGNAL(directoryChanged(QString)),
+            this, SLOT(watch_changed()),
+            Qt::DirectConnection);
+    connect(&refresh_timer, SIGNAL(timeout()),
+            this, SLOT(refresh()),
+            Qt::DirectConnection);
+
+    // Load initial list & start polling if needed
+    refresh();
+    if (!watching) refresh_timer.start();
+}
+
+SERIAL_HOTPLUG::~SERIAL_HOTPLUG()
+{
+    refresh_timer.stop();
+}
+
+QStringList SERIAL_HOTPLUG::getDevices()
+{
+    return devices;
+}
+
+void SERIAL_HOTPLUG::watch_changed()
+{
+    // Restart settle timer (groups bursts of node changes)
+    refresh_timer.start();
+}
+
+void SERIAL_HOTPLUG::refresh()
+{
+    // Enumerate ports
+    QStringList curr_devices;
+    foreach (QSerialPortInfo i, QSerialPortInfo::availablePorts())
+    {
+        curr_devices.append(i.portName());
+    }
+
+    // Notify of removed ports
+    bool changed = false;
+    foreach (QString port, devices)
+    {
+        if (curr_devices.contains(port)) continue;
+        changed = true;
+        emit deviceRemoved(port);
+    }
+
+    // Notify of added ports
+    foreach (QString port, curr_devices)
+    {
+        if (devices.contains(port)) continue;
+        changed = true;
+        emit deviceAdded(port);
+    }
+
+    // Save & notify list changed
+    devices = curr_devices;
+    if (changed) emit devicesChanged(devices);
+}
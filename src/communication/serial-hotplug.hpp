@@ -0,0 +1,64 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SERIAL_HOTPLUG_H
+#define SERIAL_HOTPLUG_H
+
+#include <QObject>
+#include <QStringList>
+#include <QTimer>
+#include <QFileSystemWatcher>
+
+// Watches for serial ports being added or removed.
+// Uses a directory watch on /dev (inotify on Linux) & only enumerates
+// ports after a change, falling back to polling if the watch fails.
+class SERIAL_HOTPLUG : public QObject
+{
+    Q_OBJECT
+
+public:
+    SERIAL_HOTPLUG(QObject *parent = NULL);
+    ~SERIAL_HOTPLUG();
+
+    // Cached port list (no enumeration)
+    QStringList getDevices();
+
+    // Watch settings
+    static const QString watch_path;
+    static const int settle_time_ms = 250;
+    static const int poll_time_ms = 1000;
+
+signals:
+    void deviceAdded(QString port);
+    void deviceRemoved(QString port);
+    void devicesChanged(QStringList ports);
+
+public slots:
+    void refresh();
+
+private slots:
+    void watch_changed();
+
+private:
+    QStringList devices;
+    QFileSystemWatcher dev_watcher;
+    QTimer refresh_timer;
+    bool watching;
+};
+
+#endif // SERIAL_HOTPLUG_H
@@ -0,0 +1,111 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "spsc-byte-queue.hpp"
+
+#include <string.h>
+
+SPSC_BYTE_QUEUE::SPSC_BYTE_QUEUE(quint32 min_capacity) :
+    head(0),
+    tail(0)
+{
+    // Round capacity up to power of 2 (allows masking instead of modulo)
+    quint32 size = 1;
+    while (size < min_capacity) size <<= 1;
+    mask = size - 1;
+
+    // Create ring
+    buffer = new char[size];
+}
+
+SPSC_BYTE_QUEUE::~SPSC_BYTE_QUEUE()
+{
+    delete[] buffer;
+}
+
+bool SPSC_BYTE_QUEUE::push(const QByteArray &data)
+{
+    // Try to move any previous overflow in first (keeps byte order)
+    if (!pending.isEmpty())
+    {
+        pending.remove(0, write_some(pending.constData(), pending.length()));
+        if (!pending.isEmpty())
+        {
+            pending.append(data);
+            return false;
+        }
+    }
+
+    // Write new data & hold anything that did not fit
+    quint32 written = write_some(data.constData(), data.length());
+    if (written < (quint32) data.length()) pending = data.mid(written);
+    return pending.isEmpty();
+}
+
+bool SPSC_BYTE_QUEUE::hasPending()
+{
+    return !pending.isEmpty();
+}
+
+QByteArray SPSC_BYTE_QUEUE::pop_all()
+{
+    // Acquire head to see all bytes written before it
+    quint32 t = tail.loadAcquire();
+    quint32 used = head.loadAcquire() - t;
+    if (!used) return QByteArray();
+
+    // Copy out (two parts if wrapping)
+    QByteArray data(used, Qt::Uninitialized);
+    quint32 pos = t & mask;
+    quint32 first = qMin(used, (mask + 1) - pos);
+    memcpy(data.data(), buffer + pos, first);
+    memcpy(data.data() + first, buffer, used - first);
+
+    // Release space back to producer
+    tail.storeRelease(t + used);
+    return data;
+}
+
+quint32 SPSC_BYTE_QUEUE::available()
+{
+    return head.loadAcquire() - tail.loadAcquire();
+}
+
+quint32 SPSC_BYTE_QUEUE::capacity()
+{
+    return mask + 1;
+}
+
+quint32 SPSC_BYTE_QUEUE::write_some(const char *data, quint32 data_len)
+{
+    // Find free space
+    quint32 h = head.loadAcquire();
+    quint32 space = (mask + 1) - (h - tail.loadAcquire());
+    quint32 len = qMin(space, data_len);
+    if (!len) return 0;
+
+    // Copy in (two parts if wrapping)
+    quint32 pos = h & mask;
+    quint32 first = qMin(len, (mask + 1) - pos);
+    memcpy(buffer + pos, data, first);
+    memcpy(buffer, data + first, len - first);
+
+    // Publish bytes to consumer
+    head.storeRelease(h + len);
+    return len;
+}
@@ -0,0 +1,62 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SPSC_BYTE_QUEUE_H
+#define SPSC_BYTE_QUEUE_H
+
+#include <QByteArray>
+#include <QAtomicInteger>
+
+// Lock-free single producer/single consumer byte ring.
+// One thread may call the producer functions & one (other or same)
+// thread may call the consumer functions. Bytes that do not fit are held
+// by the producer & moved in on its next push().
+class SPSC_BYTE_QUEUE
+{
+public:
+    SPSC_BYTE_QUEUE(quint32 min_capacity = default_capacity);
+    ~SPSC_BYTE_QUEUE();
+
+    // Producer functions
+    bool push(const QByteArray &data);
+    bool hasPending();
+
+    // Consumer functions
+    QByteArray pop_all();
+
+    // Either side
+    quint32 available();
+    quint32 capacity();
+
+    // Default ring size (rounded up to a power of 2)
+    static const quint32 default_capacity = 0x10000;
+
+private:
+    // Ring buffer (head & tail are free running counters)
+    char *buffer;
+    quint32 mask;
+    QAtomicInteger<quint32> head;
+    QAtomicInteger<quint32> tail;
+
+    // Producer owned overflow
+    QByteArray pending;
+
+    quint32 write_some(const char *data, quint32 data_len);
+};
+
+#endif // SPSC_BYTE_QUEUE_H
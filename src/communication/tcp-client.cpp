@@ -47,10 +47,18 @@ TCP_CLIENT::~TCP_CLIENT()
 
 void TCP_CLIENT::open()
 {
+    // Drop any previous (lost) connection or attempt before reopening
+    if (client->state() != QAbstractSocket::UnconnectedState) client->abort();
+
     // Connect signals and slots
+    // Unique so reopening does not stack connections
+    // (disconnected is removed by close())
     connect(client, SIGNAL(connected()),
             this, SLOT(connectClient()),
-            Qt::DirectConnection);
+            (Qt::ConnectionType) (Qt::DirectConnection | Qt::UniqueConnection));
+    connect(client, SIGNAL(disconnected()),
+            this, SLOT(disconnectClient()),
+            (Qt::ConnectionType) (Qt::DirectConnection | Qt::UniqueConnection));
 
     // Attempt to connect
     client->connectToHost(server_ip, server_port, QIODevice::ReadWrite);
@@ -85,28 +93,16 @@ void TCP_CLIENT::disconnectClient()
 
 void TCP_CLIENT::write(QByteArray writeData)
 {
-    // Acquire Lock
-    writeLock->lock();
-
     // Write data (try to force start)
     client->write((const QByteArray) writeData);
     client->flush();
-
-    // Unlock lock
-    writeLock->unlock();
 }
 
 void TCP_CLIENT::read()
 {
-    // Acquire Lock
-    readLock->lock();
-
     // Read data
     QByteArray recvData = client->readAll();
 
-    // Emit signal
-    emit readyRead(recvData);
-
-    // Unlock lock
-    readLock->unlock();
+    // Queue for bridge
+    queue_read(recvData);
 }
@@ -0,0 +1,97 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tcp-server-client.hpp"
+
+TCP_SERVER_CLIENT::TCP_SERVER_CLIENT(QTcpSocket *socket, QObject *parent) :
+    COMMS_BASE(parent)
+{
+    // Take ownership of accepted socket
+    // (parented to this so it follows any moveToThread() calls)
+    client = socket;
+    initSuccess = (initSuccess && client);
+    if (!initSuccess) return;
+    client->setParent(this);
+
+    // Set variables
+    client_name = client->peerAddress().toString()
+            + ":" + QString::number(client->peerPort());
+
+    // Connect client signals and slots
+    connect(client, SIGNAL(readyRead()),
+            this, SLOT(read()),
+            Qt::DirectConnection);
+    connect(client, SIGNAL(disconnected()),
+            this, SLOT(disconnectClient()),
+            Qt::DirectConnection);
+}
+
+TCP_SERVER_CLIENT::~TCP_SERVER_CLIENT()
+{
+    if (isConnected()) close();
+
+    delete client;
+}
+
+void TCP_SERVER_CLIENT::open()
+{
+    // Socket was accepted connected, notify if still up
+    if (isConnected()) emit deviceConnected();
+    else emit deviceDisconnected();
+}
+
+bool TCP_SERVER_CLIENT::isConnected()
+{
+    return (client && (client->state() == QTcpSocket::ConnectedState));
+}
+
+QString TCP_SERVER_CLIENT::get_client_name()
+{
+    return client_name;
+}
+
+void TCP_SERVER_CLIENT::close()
+{
+    // Remove close slot to prevent infinite loop
+    disconnect(client, SIGNAL(disconnected()),
+               this, SLOT(disconnectClient()));
+
+    // Disconnect
+    client->disconnectFromHost();
+}
+
+void TCP_SERVER_CLIENT::write(QByteArray writeData)
+{
+    // Write data (try to force start)
+    client->write((const QByteArray) writeData);
+    client->flush();
+}
+
+void TCP_SERVER_CLIENT::read()
+{
+    // Read data
+    QByteArray recvData = client->readAll();
+
+    // Queue for bridge
+    queue_read(recvData);
+}
+
+void TCP_SERVER_CLIENT::disconnectClient()
+{
+    emit deviceDisconnected();
+}
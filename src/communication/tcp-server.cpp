@@ -27,8 +27,7 @@ TCP_SERVER::TCP_SERVER(QHostAddress addr, int port, QObject *parent) :
     if (!initSuccess) return;
 
     // Set new server values
-    server->setMaxPendingConnections(1);
-    server_client = nullptr;
+    // (listener stays open so any number of clients can connect)
     listen_port = port;
     listen_addr = addr;
 
@@ -47,7 +46,6 @@ TCP_SERVER::~TCP_SERVER()
 {
     if (isConnected()) close();
 
-    if (server_client) delete server_client;
     delete server;
     delete connecting_msg;
 }
@@ -69,85 +67,52 @@ void TCP_SERVER::open()
 
 bool TCP_SERVER::isConnected()
 {
-    return (server_client && (server_client->state() == QTcpSocket::ConnectedState));
+    // Connected once first client accepted & while still listening
+    return (connected && server->isListening());
 }
 
 void TCP_SERVER::close()
 {
-    // Disconnect server_client
-    if (server_client)
-    {
-        disconnect(server_client, SIGNAL(disconnected()),
-                   this, SLOT(disconnectClient()));
-        server_client->disconnectFromHost();
-    }
-
-    // Disconnect server
+    // Stop accepting clients
+    // (accepted clients are owned & closed by the receiver of clientConnected)
+    disconnect(server, SIGNAL(newConnection()),
+               this, SLOT(connectClient()));
     server->close();
-}
-
-void TCP_SERVER::write(QByteArray writeData)
-{
-    // Acquire Lock
-    writeLock->lock();
-
-    // Write data (try to force start)
-    server_client->write((const QByteArray) writeData);
-    server_client->flush();
-
-    // Unlock lock
-    writeLock->unlock();
-}
-
-void TCP_SERVER::read()
-{
-    // Acquire Lock
-    readLock->lock();
-
-    // Read data
-    QByteArray recvData = server_client->readAll();
-
-    // Emit signal
-    emit readyRead(recvData);
-
-    // Unlock lock
-    readLock->unlock();
+    connected = false;
 }
 
 void TCP_SERVER::connectClient()
 {
-    // Open pending connections
-    if (server->hasPendingConnections())
+    // Open all pending connections
+    TCP_SERVER_CLIENT *client;
+    while (server->hasPendingConnections())
     {
-        // Get next connection from server
-        server_client = server->nextPendingConnection();
-        server->close();
-        connecting_msg->hide();
-
-        // Connect client signals and slots
-        connect(server_client, SIGNAL(readyRead()),
-                this, SLOT(read()),
-                Qt::DirectConnection);
-        connect(server_client, SIGNAL(disconnected()),
-                this, SLOT(disconnectClient()),
-                Qt::DirectConnection);
-
-        // Remove uneeded connections
-        disconnect(server, SIGNAL(newConnection()),
-                   this, SLOT(connectClient()));
-        disconnect(connecting_msg, SIGNAL(finished(int)),
-                   this, SLOT(connecting_finished(int)));
-
-        // Notify host to conitnue
-        emit deviceConnected();
+        // Wrap next connection from server
+        client = new TCP_SERVER_CLIENT(server->nextPendingConnection());
+        if (!client->initSuccessful())
+        {
+            delete client;
+            continue;
+        }
+
+        // First client finishes the connecting stage
+        if (!connected)
+        {
+            // Remove uneeded connections
+            connected = true;
+            connecting_msg->hide();
+            disconnect(connecting_msg, SIGNAL(finished(int)),
+                       this, SLOT(connecting_finished(int)));
+
+            // Notify host to conitnue
+            emit deviceConnected();
+        }
+
+        // Hand client off to host
+        emit clientConnected(client);
     }
 }
 
-void TCP_SERVER::disconnectClient()
-{
-    emit deviceDisconnected();
-}
-
 void TCP_SERVER::connecting_finished(int res)
 {
     if ((res == QMessageBox::Cancel) || (res == QMessageBox::Close))
@@ -20,6 +20,7 @@
 #define TCP_SERVER_H
 
 #include "comms-base.hpp"
+#include "tcp-server-client.hpp"
 #include <QTcpServer>
 #include <QTcpSocket>
 #include <QMessageBox>
@@ -35,19 +36,19 @@ public:
     virtual void open();
     virtual bool isConnected();
 
+signals:
+    // New client accepted (receiver takes ownership)
+    void clientConnected(COMMS_BASE *client);
+
 public slots:
     virtual void close();
-    virtual void write(QByteArray writeData);
 
 private slots:
-    virtual void read();
     void connectClient();
-    void disconnectClient();
     void connecting_finished(int res);
 
 private:
     QTcpServer *server;
-    QTcpSocket *server_client;
     QMessageBox *connecting_msg;
 
     int listen_port;
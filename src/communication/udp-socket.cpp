@@ -81,32 +81,20 @@ void UDP_SOCKET::disconnectClient()
 
 void UDP_SOCKET::write(QByteArray writeData)
 {
-    // Acquire Lock
-    writeLock->lock();
-
     // Write data (try to force start)
     client->writeDatagram((const QByteArray) writeData,
                           udp_client_ip, udp_client_port);
     client->flush();
-
-    // Unlock lock
-    writeLock->unlock();
 }
 
 void UDP_SOCKET::read()
 {
-    // Acquire Lock
-    readLock->lock();
-
     // Read data
     QByteArray recvData;
     while (server->hasPendingDatagrams())
     {
         recvData += server->receiveDatagram().data();
     }
-    // Emit signal
-    emit readyRead(recvData);
-
-    // Unlock lock
-    readLock->unlock();
+    // Queue for bridge
+    queue_read(recvData);
 }
@@ -20,6 +20,7 @@
 #include "ui_gui-chart-element.h"
 
 #include <QDateTime>
+#include <QHeaderView>
 
 // Charts & helpers
 #include <QChart>
@@ -39,7 +40,8 @@ GUI_CHART_ELEMENT::supportedChartsList({
                                            "3D Line",
                                            "3D Scatter",
                                            "3D Bar",
-                                           "3D Surface"
+                                           "3D Surface",
+                                           "FFT Spectrum"
                                        });
 
 GUI_CHART_ELEMENT::GUI_CHART_ELEMENT(int type, QWidget *parent) :
@@ -53,29 +55,92 @@ GUI_CHART_ELEMENT::GUI_CHART_ELEMENT(int type, QWidget *parent) :
     curr_time = ((double) QDateTime::currentMSecsSinceEpoch() / GUI_GENERIC_HELPER::S2MS);
     chart_type = type;
     chart_element = nullptr;
+    series_store = &local_store;
+    sample_width = 0;
     ui->Legend_CheckBox->setChecked(false);
 
-    // Set & update chart ranges
-    ui->yMin_LineEdit->setText("0.0");
-    ui->yMax_LineEdit->setText("1.0");
+    // Register sampler metaTypes
+    qRegisterMetaType<QList<QString>>("QList<QString>");
+    qRegisterMetaType<QVector<QPointF>>("QVector<QPointF>");
+    qRegisterMetaType<Chart_Stats>("Chart_Stats");
+    qRegisterMetaType<GUI_CHART_STORE*>("GUI_CHART_STORE*");
+
+    // Setup sampler (series are sampled off the GUI thread)
+    sampler = new GUI_CHART_SAMPLER(series_store);
+    sampler->moveToThread(&sampler_thread);
+    connect(sampler, SIGNAL(series_sampled(QString, QVector<QPointF>)),
+            this, SLOT(replace_series(QString, QVector<QPointF>)),
+            Qt::QueuedConnection);
+    connect(sampler, SIGNAL(series_stats(QString, Chart_Stats, Chart_Stats)),
+            this, SLOT(update_series_stats(QString, Chart_Stats, Chart_Stats)),
+            Qt::QueuedConnection);
+    sampler_thread.start();
+
+    // Setup spectrum (FFT charts only, transformed off the GUI thread)
+    bool is_spectrum = (chart_type == CHART_TYPE_FFT_SPECTRUM);
+    spectrum = nullptr;
+    spectrum_max_hz = 0;
+    if (is_spectrum)
+    {
+        spectrum = new GUI_CHART_SPECTRUM();
+        spectrum->moveToThread(&spectrum_thread);
+        connect(spectrum, SIGNAL(spectrum_ready(QString, QVector<QPointF>)),
+                this, SLOT(replace_series(QString, QVector<QPointF>)),
+                Qt::QueuedConnection);
+        spectrum_thread.start();
+    }
+
+    // Setup statistics table (shown below chart when checked)
+    stats_table = new QTableWidget(0, 7, this);
+    stats_table->setHorizontalHeaderLabels({"Series", "Count", "Min", "Max", "Mean", "RMS", "Std"});
+    stats_table->verticalHeader()->setVisible(false);
+    stats_table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    stats_table->setVisible(false);
+    ui->verticalLayout->insertWidget(2, stats_table);
+    ui->Stats_CheckBox->setChecked(false);
+
+    // Load sampling modes (min/max by default)
+    bool prev_block_status = ui->Sampling_ComboBox->blockSignals(true);
+    ui->Sampling_ComboBox->addItems(GUI_CHART_SAMPLER::get_sample_modes());
+    ui->Sampling_ComboBox->setCurrentIndex(CHART_SAMPLE_MIN_MAX);
+    ui->Sampling_ComboBox->blockSignals(prev_block_status);
+
+    // Load spectrum settings (Hann window with 50% overlap by default)
+    QList<QComboBox*> fft_combos({ui->FFTSize_ComboBox, ui->FFTWindow_ComboBox, ui->FFTOverlap_ComboBox});
+    foreach (QComboBox *combo, fft_combos) combo->blockSignals(true);
+    ui->FFTSize_ComboBox->addItems(GUI_CHART_SPECTRUM::get_fft_sizes());
+    ui->FFTSize_ComboBox->setCurrentText(QString::number(CHART_FFT_DEFAULT_SIZE));
+    ui->FFTWindow_ComboBox->addItems(GUI_CHART_SPECTRUM::get_window_types());
+    ui->FFTWindow_ComboBox->setCurrentIndex(CHART_FFT_WINDOW_HANN);
+    ui->FFTOverlap_ComboBox->addItems(GUI_CHART_SPECTRUM::get_overlaps());
+    ui->FFTOverlap_ComboBox->setCurrentIndex(CHART_FFT_OVERLAP_50);
+    foreach (QComboBox *combo, fft_combos)
+    {
+        combo->blockSignals(false);
+        combo->setVisible(is_spectrum);
+    }
+
+    // Spectrum x axis is frequency (no duration, sampling or statistics)
+    ui->xDuration_LineEdit->setVisible(!is_spectrum);
+    ui->Sampling_ComboBox->setVisible(!is_spectrum);
+    ui->Stats_CheckBox->setVisible(!is_spectrum);
+
+    // Set & update chart ranges (spectrum in dB)
+    x_duration = 0;
+    ui->yMin_LineEdit->setText(is_spectrum ? "-120.0" : "0.0");
+    ui->yMax_LineEdit->setText(is_spectrum ? "0.0" : "1.0");
     ui->xDuration_LineEdit->setText("60");
     on_yMin_LineEdit_editingFinished();
     on_yMax_LineEdit_editingFinished();
     on_xDuration_LineEdit_editingFinished();
 
-    // Register QList<QString> metaType
-    qRegisterMetaType<QList<QString>>("QList<QString>");
-
     // Connect update receiver
     connect(this, SIGNAL(update_receive(QList<QVariant>)),
             this, SLOT(process_update(QList<QVariant>)),
             Qt::QueuedConnection);
 
-    // Setup, connect, and start the update rate
+    // Set update rate (samples pushed at this rate once subscribed)
     ui->UpdateRate_LineEdit->setText("1");
-    connect(&update_timer, SIGNAL(timeout()),
-            this, SLOT(update_data_series()),
-            Qt::DirectConnection);
     on_UpdateRate_LineEdit_editingFinished();
 
     // Create the chart element
@@ -88,6 +153,19 @@ GUI_CHART_ELEMENT::~GUI_CHART_ELEMENT()
     destroy_chart_element();
     destroy_data_map();
 
+    // Stop & delete sampler
+    sampler_thread.quit();
+    sampler_thread.wait();
+    delete sampler;
+
+    // Stop & delete spectrum
+    if (spectrum)
+    {
+        spectrum_thread.quit();
+        spectrum_thread.wait();
+        delete spectrum;
+    }
+
     // Delete ui
     delete ui;
 }
@@ -102,6 +180,67 @@ QStringList GUI_CHART_ELEMENT::get_supported_chart_types()
     return supportedChartsList;
 }
 
+void GUI_CHART_ELEMENT::set_series_store(GUI_CHART_STORE *store)
+{
+    // Own store if none given
+    if (!store) store = &local_store;
+    if (store == series_store) return;
+
+    // Switch sampler first (blocks so old store can be deleted after)
+    QMetaObject::invokeMethod(sampler, "set_store", Qt::BlockingQueuedConnection,
+                              Q_ARG(GUI_CHART_STORE*, store));
+
+    // Move series references to new store
+    series_store->release_all(this);
+    series_store = store;
+    update_series_refs();
+}
+
+void GUI_CHART_ELEMENT::push_update(double time_s)
+{
+    // Move window to update time
+    update_data_series(time_s);
+
+    // Verify chart element
+    if (!chart_element) return;
+
+    // Sample new stored points
+    QMetaObject::invokeMethod(sampler, "update_series", Qt::QueuedConnection,
+                              Q_ARG(QList<QString>, subscribed_uids));
+}
+
+int GUI_CHART_ELEMENT::get_history_samples()
+{
+    // Spectrum wants up to one FFT window of new samples
+    // (limited by pin history size)
+    return spectrum ? ui->FFTSize_ComboBox->currentText().toInt() : 0;
+}
+
+void GUI_CHART_ELEMENT::push_history(const QVector<QVector<Pin_Sample>> &samples)
+{
+    // Verify spectrum & samples match subscription
+    if (!spectrum || (samples.length() != subscribed_uids.length())) return;
+
+    // Resize spectrum points if plot width changed
+    if (update_sample_width())
+    {
+        QMetaObject::invokeMethod(spectrum, "set_width", Qt::QueuedConnection,
+                                  Q_ARG(int, sample_width));
+    }
+
+    // Send new samples of each series to spectrum (x in ms)
+    for (int i = 0; i < samples.length(); i++)
+    {
+        if (samples.at(i).isEmpty()) continue;
+        QVector<QPointF> points;
+        points.reserve(samples.at(i).length());
+        foreach (const Pin_Sample &sample, samples.at(i)) points.append(QPointF(sample.t, sample.v));
+        QMetaObject::invokeMethod(spectrum, "add_samples", Qt::QueuedConnection,
+                                  Q_ARG(QString, subscribed_uids.at(i)),
+                                  Q_ARG(QVector<QPointF>, points));
+    }
+}
+
 void GUI_CHART_ELEMENT::update_series_combo(QStringList new_data_series_list)
 {
     // Remove added elements that don't exist anymore
@@ -122,18 +261,11 @@ void GUI_CHART_ELEMENT::update_series_combo(QStringList new_data_series_list)
 
 void GUI_CHART_ELEMENT::on_UpdateRate_LineEdit_editingFinished()
 {
-    // Get new value
-    double update_interval = ui->UpdateRate_LineEdit->text().toDouble();
+    // Resubscribe at new rate (zero stops pushes)
+    request_subscription();
 
-    // If timeout zero, stop the timer
-    // Else, start timer with timeout
-    if (update_interval == 0.0)
-    {
-        update_timer.stop();
-    } else
-    {
-        update_timer.start(qRound(GUI_GENERIC_HELPER::S2MS * update_interval));
-    }
+    // Refit stored series to new rate
+    update_series_refs();
 }
 
 void GUI_CHART_ELEMENT::on_Legend_CheckBox_stateChanged(int)
@@ -155,6 +287,7 @@ void GUI_CHART_ELEMENT::on_Legend_CheckBox_stateChanged(int)
         case CHART_TYPE_3D_SCATTER:
         case CHART_TYPE_3D_BAR:
         case CHART_TYPE_3D_SURFACE:
+        case CHART_TYPE_FFT_SPECTRUM:
         {
             ((QChartView*) chart_element)->chart()->legend()->setVisible(showLegend);
             break;
@@ -164,6 +297,38 @@ void GUI_CHART_ELEMENT::on_Legend_CheckBox_stateChanged(int)
     }
 }
 
+void GUI_CHART_ELEMENT::on_Stats_CheckBox_stateChanged(int)
+{
+    // Show table (filled from latest statistics)
+    bool showStats = ui->Stats_CheckBox->isChecked();
+    stats_table->setVisible(showStats);
+    if (showStats) fill_stats_table();
+}
+
+void GUI_CHART_ELEMENT::on_Sampling_ComboBox_currentIndexChanged(int)
+{
+    // Resample with new mode
+    update_sampler_view();
+}
+
+void GUI_CHART_ELEMENT::on_FFTSize_ComboBox_currentIndexChanged(int)
+{
+    // Restart spectrum & refill window from history
+    request_subscription();
+}
+
+void GUI_CHART_ELEMENT::on_FFTWindow_ComboBox_currentIndexChanged(int)
+{
+    // Restart spectrum with new window
+    request_subscription();
+}
+
+void GUI_CHART_ELEMENT::on_FFTOverlap_ComboBox_currentIndexChanged(int)
+{
+    // Restart spectrum with new overlap
+    request_subscription();
+}
+
 void GUI_CHART_ELEMENT::on_Exit_Button_clicked()
 {
     // Parent handles exiting
@@ -196,6 +361,7 @@ void GUI_CHART_ELEMENT::on_Add_Button_clicked()
         case CHART_TYPE_3D_SCATTER:
         case CHART_TYPE_3D_BAR:
         case CHART_TYPE_3D_SURFACE:
+        case CHART_TYPE_FFT_SPECTRUM:
         {
             // Get chart and create new series
             QChart *chart = ((QChartView*) chart_element)->chart();
@@ -204,6 +370,9 @@ void GUI_CHART_ELEMENT::on_Add_Button_clicked()
 
             // Add series to map and chart
             addded_data_series_map.insert(series_uid, n_series);
+            update_series_refs();
+            QMetaObject::invokeMethod(get_series_worker(), "add_series", Qt::QueuedConnection,
+                                      Q_ARG(QString, series_uid));
             chart->addSeries(n_series);
 
             // Link chart axis to series
@@ -212,6 +381,9 @@ void GUI_CHART_ELEMENT::on_Add_Button_clicked()
 
             // Set series name
             n_series->setName(series_uid);
+
+            // Push samples for new series
+            request_subscription();
             break;
         }
         default:
@@ -241,9 +413,20 @@ void GUI_CHART_ELEMENT::on_Remove_Button_clicked()
         case CHART_TYPE_3D_SCATTER:
         case CHART_TYPE_3D_BAR:
         case CHART_TYPE_3D_SURFACE:
+        case CHART_TYPE_FFT_SPECTRUM:
         {
             QLineSeries *n_series = (QLineSeries*) addded_data_series_map.take(series_uid);
+            series_store->release(series_uid, this);
+            QMetaObject::invokeMethod(get_series_worker(), "remove_series", Qt::QueuedConnection,
+                                      Q_ARG(QString, series_uid));
             ((QChartView*) chart_element)->chart()->removeSeries(n_series);
+
+            // Stop samples for removed series
+            request_subscription();
+
+            // Drop series statistics
+            series_stats.remove(series_uid);
+            if (stats_table->isVisible()) fill_stats_table();
             break;
         }
         default:
@@ -270,6 +453,7 @@ void GUI_CHART_ELEMENT::on_yMin_LineEdit_editingFinished()
         case CHART_TYPE_3D_SCATTER:
         case CHART_TYPE_3D_BAR:
         case CHART_TYPE_3D_SURFACE:
+        case CHART_TYPE_FFT_SPECTRUM:
         {
             // Set y min of chart
             ((QChartView*) chart_element)->chart()->axisY()->setMin(y_min);
@@ -299,6 +483,7 @@ void GUI_CHART_ELEMENT::on_yMax_LineEdit_editingFinished()
         case CHART_TYPE_3D_SCATTER:
         case CHART_TYPE_3D_BAR:
         case CHART_TYPE_3D_SURFACE:
+        case CHART_TYPE_FFT_SPECTRUM:
         {
             // Set y min of chart
             ((QChartView*) chart_element)->chart()->axisY()->setMax(y_max);
@@ -311,8 +496,14 @@ void GUI_CHART_ELEMENT::on_yMax_LineEdit_editingFinished()
 
 void GUI_CHART_ELEMENT::on_xDuration_LineEdit_editingFinished()
 {
-    // Set new ymin
+    // Set new x duration (refit stored series & resample if changed)
+    double prev_duration = x_duration;
     x_duration = ui->xDuration_LineEdit->text().toDouble();
+    if (x_duration != prev_duration)
+    {
+        update_series_refs();
+        update_sampler_view();
+    }
 
     // Verify if chart exists
     if (!chart_element) return;
@@ -333,24 +524,39 @@ void GUI_CHART_ELEMENT::on_xDuration_LineEdit_editingFinished()
             ((QChartView*) chart_element)->chart()->axisX()->setRange(curr_time - x_duration, curr_time);
             break;
         }
+        case CHART_TYPE_FFT_SPECTRUM:
+        {
+            // Show up to highest spectrum frequency
+            ((QChartView*) chart_element)->chart()->axisX()->setRange(0, qMax(spectrum_max_hz, 1.0));
+            break;
+        }
         default:
             return;
     }
 }
 
-void GUI_CHART_ELEMENT::update_data_series()
+void GUI_CHART_ELEMENT::update_data_series(double time_s)
 {
-    // Get time
-    curr_time = ((double) QDateTime::currentMSecsSinceEpoch() / GUI_GENERIC_HELPER::S2MS);
+    // Set time
+    curr_time = time_s;
 
     // Update chart range
     on_xDuration_LineEdit_editingFinished();
 
-    // Check if anything to update
-    if (addded_data_series_map.isEmpty()) return;
+    // Resample if plot width changed
+    if (update_sample_width()) update_sampler_view();
+}
 
-    // Send data list update
-    emit update_request(addded_data_series_map.keys());
+bool GUI_CHART_ELEMENT::update_sample_width()
+{
+    // Verify chart element
+    if (!chart_element) return false;
+
+    // Set plot width (true if changed)
+    int plot_width = qRound(((QChartView*) chart_element)->chart()->plotArea().width());
+    if (plot_width == sample_width) return false;
+    sample_width = plot_width;
+    return true;
 }
 
 void GUI_CHART_ELEMENT::process_update(QList<QVariant> data_values)
@@ -363,6 +569,24 @@ void GUI_CHART_ELEMENT::process_update(QList<QVariant> data_values)
     int added_len = added_keys.length();
     if (added_len != data_values.length()) return;
 
+    // Move window to now
+    update_data_series((double) QDateTime::currentMSecsSinceEpoch() / GUI_GENERIC_HELPER::S2MS);
+
+    // Add value of each series
+    QVector<QPointF> points;
+    points.reserve(added_len);
+    for (int i = 0; i < added_len; i++)
+    {
+        points.append(QPointF(curr_time, data_values.at(i).toDouble()));
+    }
+    add_points(added_keys, points);
+}
+
+void GUI_CHART_ELEMENT::add_points(QList<QString> series_uids, QVector<QPointF> points)
+{
+    // Verify chart element
+    if (!chart_element) return;
+
     // Get new element adding technique
     switch (chart_type)
     {
@@ -375,17 +599,14 @@ void GUI_CHART_ELEMENT::process_update(QList<QVariant> data_values)
         case CHART_TYPE_3D_BAR:
         case CHART_TYPE_3D_SURFACE:
         {
-            // Add values to series
-            QLineSeries *data_series;
-            for (int i = 0; i < added_len; i++)
+            // Store new point of each series & sample
+            // (series replaced once sampled)
+            for (int i = 0; i < series_uids.length(); i++)
             {
-                // Get data series
-                data_series = (QLineSeries*) addded_data_series_map.value(added_keys.at(i));
-                if (!data_series) continue;
-
-                // Append data_point to series
-                data_series->append(curr_time, data_values.at(i).toDouble());
+                series_store->append(series_uids.at(i), points.at(i));
             }
+            QMetaObject::invokeMethod(sampler, "update_series", Qt::QueuedConnection,
+                                      Q_ARG(QList<QString>, series_uids));
             break;
         }
         default:
@@ -393,6 +614,18 @@ void GUI_CHART_ELEMENT::process_update(QList<QVariant> data_values)
     }
 }
 
+void GUI_CHART_ELEMENT::request_subscription()
+{
+    // Restart spectrum (history pushed again from new subscription)
+    update_spectrum_view();
+
+    // Pushed samples follow this order until next request
+    subscribed_uids = addded_data_series_map.keys();
+
+    // Zero rate (or no series) stops pushes
+    emit subscribe_request(subscribed_uids, get_interval_ms());
+}
+
 void GUI_CHART_ELEMENT::create_chart_element()
 {
     // Verify chart element empty
@@ -409,6 +642,7 @@ void GUI_CHART_ELEMENT::create_chart_element()
         case CHART_TYPE_3D_SCATTER:
         case CHART_TYPE_3D_BAR:
         case CHART_TYPE_3D_SURFACE:
+        case CHART_TYPE_FFT_SPECTRUM:
         {
             // Create chart and widget
             QChart *n_chart = new QChart();
@@ -421,7 +655,6 @@ void GUI_CHART_ELEMENT::create_chart_element()
             // Add basic axis
             n_chart->setAxisX(new QValueAxis());
             n_chart->setAxisY(new QValueAxis());
-            n_chart->axisX()->setRange(curr_time - x_duration, curr_time);
             n_chart->axisY()->setRange(y_min, y_max);
             break;
         }
@@ -430,6 +663,9 @@ void GUI_CHART_ELEMENT::create_chart_element()
     }
     if (!chart_element) return;
 
+    // Set x range for chart type
+    on_xDuration_LineEdit_editingFinished();
+
     chart_element->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
     ui->ChartGridLayout->addWidget(chart_element, 0, 0, 0, 0);
 }
@@ -450,6 +686,7 @@ void GUI_CHART_ELEMENT::destroy_chart_element()
         case CHART_TYPE_3D_SCATTER:
         case CHART_TYPE_3D_BAR:
         case CHART_TYPE_3D_SURFACE:
+        case CHART_TYPE_FFT_SPECTRUM:
         {
             // Get and delete chart
             QChart *chart = ((QChartView*) chart_element)->chart();
@@ -479,15 +716,136 @@ void GUI_CHART_ELEMENT::destroy_data_map()
         case CHART_TYPE_3D_SCATTER:
         case CHART_TYPE_3D_BAR:
         case CHART_TYPE_3D_SURFACE:
+        case CHART_TYPE_FFT_SPECTRUM:
         {
             // Delete all the elements
             foreach (QString key, addded_data_series_map.keys())
             {
                 delete (QLineSeries*) addded_data_series_map.take(key);
             }
+            QMetaObject::invokeMethod(get_series_worker(), "clear", Qt::QueuedConnection);
+            series_store->release_all(this);
             break;
         }
         default:
             return;
     }
 }
+
+int GUI_CHART_ELEMENT::get_interval_ms()
+{
+    // Update rate in ms (zero if stopped)
+    return qMax(0, qRound(GUI_GENERIC_HELPER::S2MS * ui->UpdateRate_LineEdit->text().toDouble()));
+}
+
+void GUI_CHART_ELEMENT::update_series_refs()
+{
+    // Spectrum charts read pin history instead
+    if (spectrum) return;
+
+    // Set window & rate of each series (store fits the widest & fastest chart)
+    int interval_ms = get_interval_ms();
+    foreach (QString series_uid, addded_data_series_map.keys())
+    {
+        series_store->reference(series_uid, this, x_duration, interval_ms);
+    }
+}
+
+void GUI_CHART_ELEMENT::update_sampler_view()
+{
+    // Send view to sampler (resamples every series)
+    QMetaObject::invokeMethod(sampler, "set_view", Qt::QueuedConnection,
+                              Q_ARG(double, x_duration),
+                              Q_ARG(int, sample_width),
+                              Q_ARG(int, ui->Sampling_ComboBox->currentIndex()));
+}
+
+void GUI_CHART_ELEMENT::update_spectrum_view()
+{
+    // Verify spectrum chart
+    if (!spectrum) return;
+
+    // Send settings to spectrum (restarts every series)
+    spectrum_max_hz = 0;
+    QMetaObject::invokeMethod(spectrum, "set_view", Qt::QueuedConnection,
+                              Q_ARG(int, ui->FFTSize_ComboBox->currentText().toInt()),
+                              Q_ARG(int, ui->FFTWindow_ComboBox->currentIndex()),
+                              Q_ARG(int, ui->FFTOverlap_ComboBox->currentIndex()));
+}
+
+QObject *GUI_CHART_ELEMENT::get_series_worker()
+{
+    // Spectrum charts transform series, others sample them
+    return spectrum ? (QObject*) spectrum : (QObject*) sampler;
+}
+
+void GUI_CHART_ELEMENT::replace_series(QString series_uid, QVector<QPointF> points)
+{
+    // Get series (may have been removed while sampling)
+    QLineSeries *data_series = (QLineSeries*) addded_data_series_map.value(series_uid);
+    if (!data_series) return;
+
+    // Replace series in one call (single redraw)
+    data_series->replace(points);
+
+    // Grow frequency axis to highest spectrum frequency
+    if (spectrum && !points.isEmpty() && (spectrum_max_hz < points.last().x()))
+    {
+        spectrum_max_hz = points.last().x();
+        on_xDuration_LineEdit_editingFinished();
+    }
+}
+
+void GUI_CHART_ELEMENT::update_series_stats(QString series_uid, Chart_Stats window, Chart_Stats total)
+{
+    // Ignore results for removed series
+    if (!addded_data_series_map.contains(series_uid)) return;
+
+    // Keep latest statistics (table rebuilt if new series)
+    bool new_series = !series_stats.contains(series_uid);
+    series_stats.insert(series_uid, qMakePair(window, total));
+    if (!stats_table->isVisible()) return;
+    if (new_series)
+    {
+        fill_stats_table();
+        return;
+    }
+
+    // Update only this series' rows
+    int row = 2 * series_stats.keys().indexOf(series_uid);
+    set_stats_row(row, series_uid + " (window)", window);
+    set_stats_row(row + 1, series_uid + " (total)", total);
+}
+
+void GUI_CHART_ELEMENT::fill_stats_table()
+{
+    // Two rows per series (sorted by series id)
+    stats_table->setRowCount(2 * series_stats.size());
+    int row = 0;
+    QMap<QString, QPair<Chart_Stats, Chart_Stats>>::const_iterator it;
+    for (it = series_stats.constBegin(); it != series_stats.constEnd(); it++)
+    {
+        set_stats_row(row++, it.key() + " (window)", it.value().first);
+        set_stats_row(row++, it.key() + " (total)", it.value().second);
+    }
+}
+
+void GUI_CHART_ELEMENT::set_stats_row(int row, QString label, const Chart_Stats &stats)
+{
+    // Set row text (items created on first use)
+    QStringList values({label, QString::number(stats.count),
+                        QString::number(stats.min), QString::number(stats.max),
+                        QString::number(stats.mean), QString::number(stats.rms),
+                        QString::number(stats.std)});
+    QTableWidgetItem *item;
+    for (int col = 0; col < values.length(); col++)
+    {
+        item = stats_table->item(row, col);
+        if (!item)
+        {
+            item = new QTableWidgetItem();
+            stats_table->setItem(row, col, item);
+        }
+        item->setText(values.at(col));
+    }
+}
@@ -26,10 +26,15 @@
 #include <QStringList>
 
 // Helpers
-#include <QTimer>
 #include <QMap>
 #include <QVariant>
+#include <QPointF>
+#include <QThread>
+#include <QTableWidget>
 #include "gui-generic-helper.hpp"
+#include "gui-chart-sampler.hpp"
+#include "gui-chart-spectrum.hpp"
+#include "gui-chart-store.hpp"
 
 // Needs to be in same order as supportedChartsList
 typedef enum {
@@ -42,7 +47,8 @@ typedef enum {
     CHART_TYPE_3D_LINE,
     CHART_TYPE_3D_SCATTER,
     CHART_TYPE_3D_BAR,
-    CHART_TYPE_3D_SURFACE
+    CHART_TYPE_3D_SURFACE,
+    CHART_TYPE_FFT_SPECTRUM
 } chart_types;
 
 namespace Ui {
@@ -60,9 +66,21 @@ public:
     int get_chart_type();
     static QStringList get_supported_chart_types();
 
+    // Read series points from store (own store if null)
+    void set_series_store(GUI_CHART_STORE *store);
+
+    // Sample subscribed series (new points already in store)
+    void push_update(double time_s);
+
+    // History samples wanted per series each push (0 if values pushed)
+    int get_history_samples();
+
+    // Add pushed history samples (new samples of each subscribed series)
+    void push_history(const QVector<QVector<Pin_Sample>> &samples);
+
 signals:
     void exit_clicked();
-    void update_request(QList<QString> data_points);
+    void subscribe_request(QList<QString> series_uids, int interval_ms);
     void update_receive(QList<QVariant> data_values);
 
 public slots:
@@ -71,6 +89,7 @@ public slots:
 private slots:
     void on_UpdateRate_LineEdit_editingFinished();
     void on_Legend_CheckBox_stateChanged(int);
+    void on_Stats_CheckBox_stateChanged(int);
 
     void on_Exit_Button_clicked();
     void on_Add_Button_clicked();
@@ -80,8 +99,14 @@ private slots:
     void on_yMax_LineEdit_editingFinished();
     void on_xDuration_LineEdit_editingFinished();
 
-    void update_data_series();
+    void on_Sampling_ComboBox_currentIndexChanged(int);
+    void on_FFTSize_ComboBox_currentIndexChanged(int);
+    void on_FFTWindow_ComboBox_currentIndexChanged(int);
+    void on_FFTOverlap_ComboBox_currentIndexChanged(int);
+
     void process_update(QList<QVariant> data_values);
+    void replace_series(QString series_uid, QVector<QPointF> points);
+    void update_series_stats(QString series_uid, Chart_Stats window, Chart_Stats total);
 
 private:
     Ui::GUI_CHART_ELEMENT *ui;
@@ -90,12 +115,33 @@ private:
     QWidget *chart_element;
     QMap<QString, void*> addded_data_series_map;
 
+    // Series points (shared store once subscribed, own store before)
+    GUI_CHART_STORE local_store;
+    GUI_CHART_STORE *series_store;
+
+    // Downsampled series points (sampled in sampler thread,
+    // whole series replaced with each result)
+    QThread sampler_thread;
+    GUI_CHART_SAMPLER *sampler;
+    int sample_width;
+
+    // Series spectrum (FFT charts only, transformed in spectrum thread)
+    QThread spectrum_thread;
+    GUI_CHART_SPECTRUM *spectrum;
+    double spectrum_max_hz;
+
+    // Series order of pushed samples
+    QList<QString> subscribed_uids;
+
+    // Series statistics (window & since added, two table rows each)
+    QMap<QString, QPair<Chart_Stats, Chart_Stats>> series_stats;
+    QTableWidget *stats_table;
+
     double y_min;
     double y_max;
     double x_duration;
 
     double curr_time;
-    QTimer update_timer;
 
     static QStringList supportedChartsList;
 
@@ -103,6 +149,23 @@ private:
     void create_chart_element();
     void destroy_chart_element();
     void destroy_data_map();
+
+    // Series point helpers
+    int get_interval_ms();
+    void update_series_refs();
+    void update_sampler_view();
+    void update_spectrum_view();
+    bool update_sample_width();
+    QObject *get_series_worker();
+    void update_data_series(double time_s);
+    void add_points(QList<QString> series_uids, QVector<QPointF> points);
+
+    // Request pushed samples for current series & rate
+    void request_subscription();
+
+    // Statistics table helpers
+    void fill_stats_table();
+    void set_stats_row(int row, QString label, const Chart_Stats &stats);
 };
 
 #endif // GUI_CHART_ELEMENT_H
@@ -0,0 +1,210 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "gui-chart-feed.hpp"
+
+#include <QDateTime>
+
+GUI_CHART_FEED::GUI_CHART_FEED(GUI_PIN_STORE *store, GUI_PIN_HISTORY *history, QObject *parent) :
+    QObject(parent)
+{
+    // Set store & history
+    pin_store = store;
+    pin_history = history;
+    sample_time = false;
+
+    // Set feed timer (single shot, set to next due chart)
+    feedTimer.setSingleShot(true);
+    feedTimer.setTimerType(Qt::PreciseTimer);
+    connect(&feedTimer, SIGNAL(timeout()),
+            this, SLOT(push_due()),
+            Qt::DirectConnection);
+}
+
+GUI_CHART_FEED::~GUI_CHART_FEED()
+{
+    // Return charts to their own stores (shared store deleted with feed)
+    foreach (QObject *element, attached)
+    {
+        disconnect(element, SIGNAL(destroyed(QObject*)),
+                   this, SLOT(element_destroyed(QObject*)));
+        ((GUI_CHART_ELEMENT*) element)->set_series_store(nullptr);
+    }
+}
+
+void GUI_CHART_FEED::subscribe(GUI_CHART_ELEMENT *element, QList<QString> series_uids,
+                               QVector<Chart_Series_Handle> handles, int interval_ms)
+{
+    if (!element) return;
+
+    // Give chart the shared store & watch for its deletion (first subscribe)
+    if (!attached.contains(element))
+    {
+        attached.insert(element);
+        connect(element, SIGNAL(destroyed(QObject*)),
+                this, SLOT(element_destroyed(QObject*)),
+                Qt::DirectConnection);
+        if (!element->get_history_samples()) element->set_series_store(&series_store);
+    }
+
+    // Drop subscription if nothing to push
+    if (handles.isEmpty() || (handles.length() != series_uids.length()) || (interval_ms <= 0))
+    {
+        unsubscribe(element);
+        return;
+    }
+
+    // Set subscription (first push on next loop)
+    Chart_Feed_Sub &sub = subs[element];
+    sub.series_uids = series_uids;
+    sub.handles = handles;
+    sub.interval_ms = interval_ms;
+    sub.next_ms = QDateTime::currentMSecsSinceEpoch();
+    sub.samples.resize(handles.length());
+    schedule();
+}
+
+void GUI_CHART_FEED::unsubscribe(GUI_CHART_ELEMENT *element)
+{
+    if (!subs.remove(element)) return;
+    schedule();
+}
+
+int GUI_CHART_FEED::get_num_subscribed()
+{
+    return subs.size();
+}
+
+GUI_CHART_STORE *GUI_CHART_FEED::get_series_store()
+{
+    return &series_store;
+}
+
+void GUI_CHART_FEED::set_sample_time(bool enable)
+{
+    sample_time = enable;
+}
+
+bool GUI_CHART_FEED::get_sample_time()
+{
+    return sample_time;
+}
+
+void GUI_CHART_FEED::push_due()
+{
+    // Push store values to each due chart
+    qint64 now_ms = QDateTime::currentMSecsSinceEpoch();
+    double now_s = ((double) now_ms) / 1000.0;
+    QMap<QObject*, Chart_Feed_Sub>::iterator it;
+    int num_vals, history_samples;
+    GUI_CHART_ELEMENT *element;
+    for (it = subs.begin(); it != subs.end(); it++)
+    {
+        Chart_Feed_Sub &sub = it.value();
+        if (now_ms < sub.next_ms) continue;
+        element = (GUI_CHART_ELEMENT*) it.key();
+        num_vals = sub.handles.length();
+
+        // Get new history samples or store values (handles index store directly)
+        // (store keeps one point when charts of a series are due together)
+        history_samples = element->get_history_samples();
+        if (history_samples)
+        {
+            for (int i = 0; i < num_vals; i++) sub.samples[i] = get_samples(&sub.handles[i], history_samples);
+            element->push_history(sub.samples);
+        } else
+        {
+            for (int i = 0; i < num_vals; i++)
+            {
+                series_store.append(sub.series_uids.at(i), get_point(&sub.handles[i], now_s));
+            }
+            element->push_update(now_s);
+        }
+
+        // Set next push (skips missed pushes)
+        sub.next_ms += sub.interval_ms;
+        if (sub.next_ms <= now_ms) sub.next_ms = now_ms + sub.interval_ms;
+    }
+
+    // Wait for next due chart
+    schedule();
+}
+
+void GUI_CHART_FEED::element_destroyed(QObject *element)
+{
+    // Chart already gone (only remove, chart released its series)
+    attached.remove(element);
+    subs.remove(element);
+    schedule();
+}
+
+bool GUI_CHART_FEED::resolve(Chart_Series_Handle *handle)
+{
+    // Get & verify table
+    const Pin_Table *table = pin_store->get_table(handle->pinType);
+    if (!table) return false;
+
+    // Re-resolve position if layout changed
+    if ((handle->pos < 0) || (table->pin_num.length() <= handle->pos)
+            || (table->pin_num.at(handle->pos) != handle->pin_num))
+    {
+        handle->pos = pin_store->get_pos(handle->pinType, handle->pin_num);
+        if (handle->pos < 0) return false;
+    }
+    return true;
+}
+
+QPointF GUI_CHART_FEED::get_point(Chart_Series_Handle *handle, double now_s)
+{
+    if (!resolve(handle)) return QPointF(now_s, -1.0);
+    const Pin_Table *table = pin_store->get_table(handle->pinType);
+
+    // Use update time if set (pins never updated use push time,
+    // unchanged times are skipped by the store)
+    qint64 timestamp = table->timestamp.at(handle->pos);
+    double time_s = (sample_time && (0 < timestamp)) ? (((double) timestamp) / 1000.0) : now_s;
+    return QPointF(time_s, table->scaled.at(handle->pos));
+}
+
+QVector<Pin_Sample> GUI_CHART_FEED::get_samples(Chart_Series_Handle *handle, int max_samples)
+{
+    if (!pin_history || !resolve(handle)) return QVector<Pin_Sample>();
+
+    // Restart count if history was reset (layout changed)
+    quint64 appended = pin_history->get_num_appended(handle->pinType, handle->pos);
+    if (appended < handle->seen) handle->seen = 0;
+
+    // Get samples added since last push (at most max samples)
+    int num_new = (int) qMin<quint64>(appended - handle->seen, max_samples);
+    handle->seen = appended;
+    return pin_history->get_newest(handle->pinType, handle->pos, num_new);
+}
+
+void GUI_CHART_FEED::schedule()
+{
+    // Stop if no charts
+    if (subs.isEmpty())
+    {
+        feedTimer.stop();
+        return;
+    }
+
+    // Start timer for earliest due chart
+    qint64 next_ms = subs.first().next_ms;
+    foreach (const Chart_Feed_Sub &sub, subs) next_ms = qMin(next_ms, sub.next_ms);
+    feedTimer.start((int) qMax<qint64>(0, next_ms - QDateTime::currentMSecsSinceEpoch()));
+}
@@ -0,0 +1,102 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef GUI_CHART_FEED_H
+#define GUI_CHART_FEED_H
+
+// Base object include
+#include <QObject>
+
+// Required object includes
+#include <QMap>
+#include <QSet>
+#include <QTimer>
+#include <QVector>
+
+// Local object includes
+#include "gui-pin-store.hpp"
+#include "gui-pin-history.hpp"
+#include "gui-chart-store.hpp"
+#include "gui-chart-element.hpp"
+
+// Pre-resolved chart series (position rechecked against pin num
+// so handles survive pin layout changes)
+typedef struct {
+    uint8_t pinType;
+    uint8_t pin_num;
+    int pos;
+    quint64 seen;   // History samples already pushed
+} Chart_Series_Handle;
+
+// Pushes pin store values to subscribed charts
+// One timer serves every chart (set to the next due chart). Values are
+// added once to a series store shared by every chart, charts then only
+// sample their own view of it. Charts wanting history (spectrum) get the
+// samples recorded since their last push instead. Points are at push
+// time unless sample time is set (pin update time, device time if sent).
+class GUI_CHART_FEED : public QObject
+{
+    Q_OBJECT
+
+public:
+    GUI_CHART_FEED(GUI_PIN_STORE *store, GUI_PIN_HISTORY *history, QObject *parent = 0);
+    ~GUI_CHART_FEED();
+
+    // Set chart series & push interval (replaces previous subscription)
+    // (no handles or zero interval unsubscribes, chart keeps shared store)
+    void subscribe(GUI_CHART_ELEMENT *element, QList<QString> series_uids,
+                   QVector<Chart_Series_Handle> handles, int interval_ms);
+    void unsubscribe(GUI_CHART_ELEMENT *element);
+    int get_num_subscribed();
+
+    // Shared series points
+    GUI_CHART_STORE *get_series_store();
+
+    // Place points at pin update time instead of push time
+    void set_sample_time(bool enable);
+    bool get_sample_time();
+
+private slots:
+    void push_due();
+    void element_destroyed(QObject *element);
+
+private:
+    // Chart subscription
+    typedef struct {
+        QList<QString> series_uids;
+        QVector<Chart_Series_Handle> handles;
+        int interval_ms;
+        qint64 next_ms;
+        QVector<QVector<Pin_Sample>> samples;
+    } Chart_Feed_Sub;
+
+    GUI_PIN_STORE *pin_store;
+    GUI_PIN_HISTORY *pin_history;
+    GUI_CHART_STORE series_store;
+    QMap<QObject*, Chart_Feed_Sub> subs;
+    QSet<QObject*> attached;    // Charts given the series store
+    QTimer feedTimer;
+    bool sample_time;
+
+    // Feed helpers
+    bool resolve(Chart_Series_Handle *handle);
+    QPointF get_point(Chart_Series_Handle *handle, double now_s);
+    QVector<Pin_Sample> get_samples(Chart_Series_Handle *handle, int max_samples);
+    void schedule();
+};
+
+#endif // GUI_CHART_FEED_H
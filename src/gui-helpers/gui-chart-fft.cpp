@@ -0,0 +1,151 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-chart-fft.hpp"
+
+#include <QtMath>
+
+GUI_CHART_FFT::GUI_CHART_FFT()
+{
+    size = 0;
+    half = 0;
+}
+
+GUI_CHART_FFT::~GUI_CHART_FFT()
+{
+    /* DO NOTHING */
+}
+
+bool GUI_CHART_FFT::set_size(int n)
+{
+    // Verify power of two
+    if ((n < 4) || (n & (n - 1))) return false;
+    if (n == size) return true;
+    size = n;
+    half = n / 2;
+
+    // Build bit reversal table for half size transform
+    int bits = 0;
+    while ((1 << bits) < half) bits++;
+    bit_reverse.resize(half);
+    int r;
+    for (int i = 0; i < half; i++)
+    {
+        r = 0;
+        for (int b = 0; b < bits; b++) r |= ((i >> b) & 1) << (bits - 1 - b);
+        bit_reverse[i] = r;
+    }
+
+    // Build twiddles for each stage (contiguous per stage)
+    stage_re.resize(qMax(half - 1, 1));
+    stage_im.resize(qMax(half - 1, 1));
+    double angle;
+    for (int span = 1; span < half; span *= 2)
+    {
+        for (int j = 0; j < span; j++)
+        {
+            angle = -M_PI * j / span;
+            stage_re[span - 1 + j] = (float) qCos(angle);
+            stage_im[span - 1 + j] = (float) qSin(angle);
+        }
+    }
+
+    // Build split twiddles (W_N^k)
+    split_re.resize(half + 1);
+    split_im.resize(half + 1);
+    for (int k = 0; k <= half; k++)
+    {
+        angle = -2.0 * M_PI * k / size;
+        split_re[k] = (float) qCos(angle);
+        split_im[k] = (float) qSin(angle);
+    }
+
+    // Size work arrays
+    work_re.resize(half);
+    work_im.resize(half);
+    return true;
+}
+
+int GUI_CHART_FFT::get_size()
+{
+    return size;
+}
+
+void GUI_CHART_FFT::forward(const float *in, float *out_re, float *out_im)
+{
+    if (!size) return;
+
+    // Pack even samples as real & odd samples as imaginary (bit reversed)
+    float *re = work_re.data();
+    float *im = work_im.data();
+    const int *rev = bit_reverse.constData();
+    for (int i = 0; i < half; i++)
+    {
+        re[rev[i]] = in[2 * i];
+        im[rev[i]] = in[2 * i + 1];
+    }
+
+    // Transform packed samples
+    complex_forward(re, im);
+
+    // Split into real spectrum:
+    // X[k] = (Z[k] + Z*[M-k]) / 2 - j W^k (Z[k] - Z*[M-k]) / 2
+    const float *wr = split_re.constData();
+    const float *wi = split_im.constData();
+    float er, ei, or_, oi;
+    int m;
+    for (int k = 0; k <= half; k++)
+    {
+        m = (half - k) % half;
+        er = 0.5f * (re[k % half] + re[m]);
+        ei = 0.5f * (im[k % half] - im[m]);
+        or_ = 0.5f * (im[k % half] + im[m]);
+        oi = -0.5f * (re[k % half] - re[m]);
+        out_re[k] = er + wr[k] * or_ - wi[k] * oi;
+        out_im[k] = ei + wr[k] * oi + wi[k] * or_;
+    }
+}
+
+void GUI_CHART_FFT::complex_forward(float *re, float *im)
+{
+    // Iterative radix-2 butterflies (input already bit reversed)
+    const float *tw_re, *tw_im;
+    float *a_re, *a_im, *b_re, *b_im;
+    float t_re, t_im;
+    for (int span = 1; span < half; span *= 2)
+    {
+        tw_re = stage_re.constData() + span - 1;
+        tw_im = stage_im.constData() + span - 1;
+        for (int start = 0; start < half; start += 2 * span)
+        {
+            a_re = re + start;
+            a_im = im + start;
+            b_re = a_re + span;
+            b_im = a_im + span;
+            for (int j = 0; j < span; j++)
+            {
+                t_re = b_re[j] * tw_re[j] - b_im[j] * tw_im[j];
+                t_im = b_re[j] * tw_im[j] + b_im[j] * tw_re[j];
+                b_re[j] = a_re[j] - t_re;
+                b_im[j] = a_im[j] - t_im;
+                a_re[j] += t_re;
+                a_im[j] += t_im;
+            }
+        }
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_CHART_FFT_H
+#define GUI_CHART_FFT_H
+
+#include <QVector>
+
+// Real-valued radix-2 FFT (size must be a power of two)
+// Packs N real samples as N/2 complex samples, transforms those & splits
+// the result into N/2 + 1 bins. Data is kept as separate real & imaginary
+// arrays with contiguous per-stage twiddles so inner loops auto-vectorize.
+class GUI_CHART_FFT
+{
+public:
+    GUI_CHART_FFT();
+    ~GUI_CHART_FFT();
+
+    // Build tables for size (false if not a power of two >= 4)
+    bool set_size(int n);
+    int get_size();
+
+    // Transform n samples into n/2 + 1 bins
+    void forward(const float *in, float *out_re, float *out_im);
+
+private:
+    int size;
+    int half;
+
+    // Complex transform tables (size/2 points)
+    QVector<int> bit_reverse;
+    QVector<float> stage_re;    // Stage twiddles (stage of span s at [s - 1, 2s - 1))
+    QVector<float> stage_im;
+
+    // Split tables (size points)
+    QVector<float> split_re;
+    QVector<float> split_im;
+
+    // Work arrays
+    QVector<float> work_re;
+    QVector<float> work_im;
+
+    void complex_forward(float *re, float *im);
+};
+
+#endif // GUI_CHART_FFT_H
@@ -0,0 +1,324 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "gui-chart-sampler.hpp"
+
+#include <limits>
+#include <QtMath>
+
+// Setup supported sampling modes list
+QStringList
+GUI_CHART_SAMPLER::supportedModesList({
+                                          "Min/Max",
+                                          "LTTB",
+                                          "Raw"
+                                      });
+
+GUI_CHART_SAMPLER::GUI_CHART_SAMPLER(GUI_CHART_STORE *series_store, QObject *parent) :
+    QObject(parent)
+{
+    // Set point store
+    store = series_store;
+
+    // Set view variables (sampling off until view set)
+    x_duration = 0;
+    width_px = 0;
+    mode = CHART_SAMPLE_RAW;
+    bucket_width = 0;
+    num_buckets = 0;
+}
+
+GUI_CHART_SAMPLER::~GUI_CHART_SAMPLER()
+{
+    /* DO NOTHING */
+}
+
+QStringList GUI_CHART_SAMPLER::get_sample_modes()
+{
+    return supportedModesList;
+}
+
+void GUI_CHART_SAMPLER::set_store(GUI_CHART_STORE *new_store)
+{
+    // Set store & restart every series (resampled on next update)
+    store = new_store;
+    QMap<QString, Sample_Series>::iterator it;
+    for (it = series.begin(); it != series.end(); it++) restart_series(&it.value());
+}
+
+void GUI_CHART_SAMPLER::set_view(double new_x_duration, int new_width_px, int new_mode)
+{
+    // Set view
+    x_duration = new_x_duration;
+    width_px = new_width_px;
+    mode = new_mode;
+
+    // Min/max keeps 2 points per bucket, LTTB keeps 1
+    num_buckets = (mode == CHART_SAMPLE_LTTB) ? (2 * width_px) : width_px;
+    bucket_width = ((0 < num_buckets) && (0 < x_duration)) ? (x_duration / num_buckets) : 0;
+
+    // Resample every series
+    QMap<QString, Sample_Series>::iterator it;
+    for (it = series.begin(); it != series.end(); it++)
+    {
+        reset_series(&it.value());
+        if (sample_stored(it.key(), &it.value())) emit series_sampled(it.key(), frame);
+    }
+}
+
+void GUI_CHART_SAMPLER::add_series(QString series_uid)
+{
+    Sample_Series &s = series[series_uid];
+    restart_series(&s);
+}
+
+void GUI_CHART_SAMPLER::remove_series(QString series_uid)
+{
+    series.remove(series_uid);
+}
+
+void GUI_CHART_SAMPLER::clear()
+{
+    series.clear();
+}
+
+void GUI_CHART_SAMPLER::update_series(QList<QString> series_uids)
+{
+    // Add stored points & resample each series
+    foreach (QString series_uid, series_uids)
+    {
+        if (!series.contains(series_uid)) continue;
+        Sample_Series &s = series[series_uid];
+        if (!sample_stored(series_uid, &s)) continue;
+
+        // Emit sampled points & statistics
+        emit series_sampled(series_uid, frame);
+        emit series_stats(series_uid, s.stats.get_window(), s.stats.get_total());
+    }
+}
+
+void GUI_CHART_SAMPLER::restart_series(Sample_Series *s)
+{
+    // Window starts at oldest stored point (points already stored by
+    // other charts show at once), statistics restart
+    s->first_seq = 0;
+    s->next_seq = 0;
+    s->stats.reset(0);
+    s->stats_capacity = 0;
+    s->stats_removed = 0;
+    reset_series(s);
+}
+
+void GUI_CHART_SAMPLER::reset_series(Sample_Series *s)
+{
+    // Drop finished buckets (next sample restarts at oldest point)
+    s->sampled.reset(2 * num_buckets + 8);
+    s->next_bucket = std::numeric_limits<qint64>::min();
+}
+
+bool GUI_CHART_SAMPLER::sample_stored(QString series_uid, Sample_Series *s)
+{
+    // Hold store for reading (appends wait until sampled)
+    if (!store) return false;
+    QReadLocker locker(store->get_lock());
+    const Chart_Store_Series *stored = store->find(series_uid);
+    if (!stored) return false;
+
+    // Restart if stored series restarted (re-added after release)
+    if (stored->appended < s->next_seq) restart_series(s);
+
+    // Restart window at oldest stored point if window points were overwritten
+    quint64 oldest = stored->appended - stored->points.length();
+    bool rebuild_stats = (s->stats_capacity != stored->points.capacity());
+    if (s->first_seq < oldest)
+    {
+        s->first_seq = oldest;
+        reset_series(s);
+        rebuild_stats = true;
+    }
+    if (s->next_seq < s->first_seq) s->next_seq = s->first_seq;
+
+    // Get window of added points (window statistics refit if store resized)
+    CHART_STORE_VIEW points(stored->points, (int) (s->first_seq - oldest), (int) (s->next_seq - s->first_seq));
+    if (rebuild_stats)
+    {
+        s->stats.set_window(points);
+        s->stats_capacity = points.capacity();
+        s->stats_removed = 0;
+    }
+
+    // Add new stored points
+    while (s->next_seq < stored->appended)
+    {
+        points.grow();
+        s->stats.add(points.at(points.length() - 1));
+        s->next_seq += 1;
+    }
+
+    // Sample window
+    sample_series(s, &points);
+    return true;
+}
+
+void GUI_CHART_SAMPLER::remove_oldest(Sample_Series *s, CHART_STORE_VIEW *points)
+{
+    if (!points->length()) return;
+
+    // Remove from window statistics & drop point
+    s->stats.remove(points->at(0));
+    points->drop_oldest();
+    s->first_seq += 1;
+
+    // Rebuild window statistics once per window (bounds rounding drift)
+    s->stats_removed += 1;
+    if (points->capacity() <= s->stats_removed)
+    {
+        s->stats.set_window(*points);
+        s->stats_removed = 0;
+    }
+}
+
+qint64 GUI_CHART_SAMPLER::get_bucket(double x)
+{
+    return (qint64) qFloor(x / bucket_width);
+}
+
+void GUI_CHART_SAMPLER::sample_series(Sample_Series *s, CHART_STORE_VIEW *window)
+{
+    CHART_STORE_VIEW &points = *window;
+    frame.clear();
+    if (!points.length()) return;
+
+    // Drop points left of window (keeps one so line reaches the edge)
+    double x_start = points.at(points.length() - 1).x() - x_duration;
+    while ((2 <= points.length()) && (points.at(1).x() <= x_start)) remove_oldest(s, window);
+    int num_points = points.length();
+
+    // Raw output if sampling off
+    if ((mode == CHART_SAMPLE_RAW) || (bucket_width <= 0))
+    {
+        frame.reserve(num_points);
+        for (int i = 0; i < num_points; i++) frame.append(points.at(i));
+        return;
+    }
+
+    // Find first point not yet in a finished bucket (points only append)
+    int start = num_points;
+    while ((0 < start) && (s->next_bucket <= get_bucket(points.at(start - 1).x()))) start--;
+
+    // Sample finished buckets (newest bucket is still filling)
+    qint64 open_bucket = get_bucket(points.at(num_points - 1).x());
+    qint64 bucket;
+    int end, next_end;
+    while (start < num_points)
+    {
+        // Get bucket range
+        bucket = get_bucket(points.at(start).x());
+        if (open_bucket <= bucket) break;
+        end = start;
+        while ((end < num_points) && (get_bucket(points.at(end).x()) == bucket)) end++;
+
+        if (mode == CHART_SAMPLE_LTTB)
+        {
+            // Next bucket must be finished too
+            if (open_bucket <= get_bucket(points.at(end).x())) break;
+            next_end = end;
+            double avg_x = 0, avg_y = 0;
+            while ((next_end < num_points) && (get_bucket(points.at(next_end).x()) == get_bucket(points.at(end).x())))
+            {
+                avg_x += points.at(next_end).x();
+                avg_y += points.at(next_end).y();
+                next_end++;
+            }
+            avg_x /= (next_end - end);
+            avg_y /= (next_end - end);
+
+            // Keep point with largest triangle (first bucket keeps its first point)
+            int keep = start;
+            if (s->sampled.length())
+            {
+                const QPointF &a = s->sampled.at(s->sampled.length() - 1).p;
+                double area, max_area = -1;
+                for (int i = start; i < end; i++)
+                {
+                    area = qAbs((a.x() - avg_x) * (points.at(i).y() - a.y())
+                                - (a.x() - points.at(i).x()) * (avg_y - a.y()));
+                    if (max_area < area)
+                    {
+                        max_area = area;
+                        keep = i;
+                    }
+                }
+            }
+            s->sampled.append(Sample_Point{.p=points.at(keep), .bucket=bucket});
+        } else
+        {
+            // Keep extremes in x order
+            QVector<QPointF> extremes;
+            append_min_max(points, start, end, &extremes);
+            foreach (QPointF p, extremes) s->sampled.append(Sample_Point{.p=p, .bucket=bucket});
+        }
+
+        // Bucket finished
+        s->next_bucket = bucket + 1;
+        start = end;
+    }
+
+    // Drop finished buckets left of window (keeps one for the edge)
+    qint64 start_bucket = get_bucket(x_start);
+    while ((2 <= s->sampled.length()) && (s->sampled.at(1).bucket < start_bucket)) s->sampled.drop_oldest();
+
+    // Show raw points if window already fits
+    if (num_points <= (2 * width_px))
+    {
+        frame.reserve(num_points);
+        for (int i = 0; i < num_points; i++) frame.append(points.at(i));
+        return;
+    }
+
+    // Output finished buckets
+    int num_sampled = s->sampled.length();
+    frame.reserve(num_sampled + 2 * (num_points - start) + 1);
+    for (int i = 0; i < num_sampled; i++) frame.append(s->sampled.at(i).p);
+
+    // Output extremes of unfinished buckets & newest point
+    while (start < num_points)
+    {
+        bucket = get_bucket(points.at(start).x());
+        end = start;
+        while ((end < num_points) && (get_bucket(points.at(end).x()) == bucket)) end++;
+        append_min_max(points, start, end, &frame);
+        start = end;
+    }
+    if (frame.last() != points.at(num_points - 1)) frame.append(points.at(num_points - 1));
+}
+
+void GUI_CHART_SAMPLER::append_min_max(const CHART_STORE_VIEW &points, int start, int end,
+                                       QVector<QPointF> *out)
+{
+    // Find extremes
+    int min_i = start, max_i = start;
+    for (int i = start + 1; i < end; i++)
+    {
+        if (points.at(i).y() < points.at(min_i).y()) min_i = i;
+        if (points.at(max_i).y() < points.at(i).y()) max_i = i;
+    }
+
+    // Append in x order (once if same point)
+    out->append(points.at(qMin(min_i, max_i)));
+    if (min_i != max_i) out->append(points.at(qMax(min_i, max_i)));
+}
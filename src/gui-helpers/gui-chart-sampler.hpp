@@ -0,0 +1,128 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef GUI_CHART_SAMPLER_H
+#define GUI_CHART_SAMPLER_H
+
+// Base object include
+#include <QObject>
+
+// Required object includes
+#include <QMap>
+#include <QPointF>
+#include <QVector>
+#include <QStringList>
+
+// Local object includes
+#include "gui-pin-history.hpp"
+#include "gui-chart-stats.hpp"
+#include "gui-chart-store.hpp"
+
+// Needs to be in same order as supportedModesList
+typedef enum {
+    CHART_SAMPLE_MIN_MAX = 0,
+    CHART_SAMPLE_LTTB,
+    CHART_SAMPLE_RAW
+} chart_sample_modes;
+
+// Downsamples chart series to about 2 points per plot pixel
+// Buckets are fixed in x (multiples of the bucket width) so finished
+// buckets never change as the window slides & each update only samples
+// the newest points. Min/max keeps each bucket's extremes, LTTB
+// (largest triangle three buckets) keeps the point forming the largest
+// triangle with the last kept point & the next bucket's average.
+// Points are read from a (possibly shared) series store, the sampler
+// only keeps each series' window position & sampled buckets.
+// Runs in the chart's sampler thread (all slots queued).
+class GUI_CHART_SAMPLER : public QObject
+{
+    Q_OBJECT
+
+public:
+    GUI_CHART_SAMPLER(GUI_CHART_STORE *series_store, QObject *parent = 0);
+    ~GUI_CHART_SAMPLER();
+
+    static QStringList get_sample_modes();
+
+signals:
+    // Points to show for series (whole series, x ascending)
+    void series_sampled(QString series_uid, QVector<QPointF> points);
+
+    // Statistics of raw points (window & since added)
+    void series_stats(QString series_uid, Chart_Stats window, Chart_Stats total);
+
+public slots:
+    // Store to read points from (restarts every series)
+    void set_store(GUI_CHART_STORE *new_store);
+
+    // View settings (resamples every series)
+    void set_view(double new_x_duration, int new_width_px, int new_mode);
+
+    // Series management
+    void add_series(QString series_uid);
+    void remove_series(QString series_uid);
+    void clear();
+
+    // Add points stored since last update & emit sampled series
+    void update_series(QList<QString> series_uids);
+
+private:
+    // Sampled point & its bucket
+    typedef struct {
+        QPointF p;
+        qint64 bucket;
+    } Sample_Point;
+
+    // Series state
+    typedef struct {
+        quint64 first_seq;                  // Oldest window point (store sequence)
+        quint64 next_seq;                   // First stored point not yet added
+        HISTORY_RING<Sample_Point> sampled; // Output of finished buckets
+        qint64 next_bucket;                 // First bucket not yet sampled
+        GUI_CHART_STATS stats;              // Raw point statistics
+        int stats_capacity;                 // Store size window stats fit
+        int stats_removed;                  // Window removals since rebuild
+    } Sample_Series;
+
+    // Point store
+    GUI_CHART_STORE *store;
+
+    // View variables
+    double x_duration;
+    int width_px;
+    int mode;
+    double bucket_width;
+    int num_buckets;
+
+    // Series states & reused output
+    QMap<QString, Sample_Series> series;
+    QVector<QPointF> frame;
+
+    static QStringList supportedModesList;
+
+    // Sampling helpers
+    void restart_series(Sample_Series *s);
+    void reset_series(Sample_Series *s);
+    bool sample_stored(QString series_uid, Sample_Series *s);
+    void remove_oldest(Sample_Series *s, CHART_STORE_VIEW *points);
+    qint64 get_bucket(double x);
+    void sample_series(Sample_Series *s, CHART_STORE_VIEW *points);
+    void append_min_max(const CHART_STORE_VIEW &points, int start, int end,
+                        QVector<QPointF> *out);
+};
+
+#endif // GUI_CHART_SAMPLER_H
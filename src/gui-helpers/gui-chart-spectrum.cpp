@@ -0,0 +1,258 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-chart-spectrum.hpp"
+
+#include <QtMath>
+
+// Setup supported windows list
+QStringList
+GUI_CHART_SPECTRUM::supportedWindowsList({
+                                             "Hann",
+                                             "Hamming",
+                                             "Blackman",
+                                             "Rectangular"
+                                         });
+
+// Setup supported overlaps list
+QStringList
+GUI_CHART_SPECTRUM::supportedOverlapsList({
+                                              "0%",
+                                              "50%",
+                                              "75%"
+                                          });
+
+GUI_CHART_SPECTRUM::GUI_CHART_SPECTRUM(QObject *parent) :
+    QObject(parent)
+{
+    // Set view variables (default view until set)
+    fft_size = 0;
+    hop = 0;
+    width_px = 0;
+    window_sum = 0;
+    set_view(CHART_FFT_DEFAULT_SIZE, CHART_FFT_WINDOW_HANN, CHART_FFT_OVERLAP_50);
+}
+
+GUI_CHART_SPECTRUM::~GUI_CHART_SPECTRUM()
+{
+    /* DO NOTHING */
+}
+
+QStringList GUI_CHART_SPECTRUM::get_fft_sizes()
+{
+    QStringList sizes;
+    for (int n = CHART_FFT_MIN_SIZE; n <= CHART_FFT_MAX_SIZE; n *= 2)
+    {
+        sizes.append(QString::number(n));
+    }
+    return sizes;
+}
+
+QStringList GUI_CHART_SPECTRUM::get_window_types()
+{
+    return supportedWindowsList;
+}
+
+QStringList GUI_CHART_SPECTRUM::get_overlaps()
+{
+    return supportedOverlapsList;
+}
+
+void GUI_CHART_SPECTRUM::set_view(int new_fft_size, int new_window_type, int new_overlap)
+{
+    // Set FFT size (keep previous if invalid)
+    new_fft_size = qBound(CHART_FFT_MIN_SIZE, new_fft_size, CHART_FFT_MAX_SIZE);
+    if (fft.set_size(new_fft_size)) fft_size = new_fft_size;
+
+    // Set hop from overlap
+    switch (new_overlap)
+    {
+        case CHART_FFT_OVERLAP_50:
+            hop = fft_size / 2;
+            break;
+        case CHART_FFT_OVERLAP_75:
+            hop = fft_size / 4;
+            break;
+        case CHART_FFT_OVERLAP_0:
+        default:
+            hop = fft_size;
+            break;
+    }
+
+    // Build window (periodic form)
+    window.resize(fft_size);
+    window_sum = 0;
+    double x;
+    for (int i = 0; i < fft_size; i++)
+    {
+        x = 2.0 * M_PI * i / fft_size;
+        switch (new_window_type)
+        {
+            case CHART_FFT_WINDOW_HANN:
+                window[i] = (float) (0.5 - 0.5 * qCos(x));
+                break;
+            case CHART_FFT_WINDOW_HAMMING:
+                window[i] = (float) (0.54 - 0.46 * qCos(x));
+                break;
+            case CHART_FFT_WINDOW_BLACKMAN:
+                window[i] = (float) (0.42 - 0.5 * qCos(x) + 0.08 * qCos(2.0 * x));
+                break;
+            case CHART_FFT_WINDOW_RECTANGULAR:
+            default:
+                window[i] = 1.0f;
+                break;
+        }
+        window_sum += window.at(i);
+    }
+
+    // Size buffers
+    frame_in.resize(fft_size);
+    frame_re.resize(fft_size / 2 + 1);
+    frame_im.resize(fft_size / 2 + 1);
+
+    // Restart every series
+    QMap<QString, Spectrum_Series>::iterator it;
+    for (it = series.begin(); it != series.end(); it++) reset_series(&it.value());
+}
+
+void GUI_CHART_SPECTRUM::set_width(int new_width_px)
+{
+    width_px = new_width_px;
+}
+
+void GUI_CHART_SPECTRUM::add_series(QString series_uid)
+{
+    reset_series(&series[series_uid]);
+}
+
+void GUI_CHART_SPECTRUM::remove_series(QString series_uid)
+{
+    series.remove(series_uid);
+}
+
+void GUI_CHART_SPECTRUM::clear()
+{
+    series.clear();
+}
+
+void GUI_CHART_SPECTRUM::add_samples(QString series_uid, QVector<QPointF> samples)
+{
+    // Verify series
+    if (!series.contains(series_uid)) return;
+    Spectrum_Series &s = series[series_uid];
+
+    // Skip samples older than the newest frames (bounds work per update)
+    int num_samples = samples.length();
+    // (window refilled from kept samples, first frame once full)
+    int start = qMax(0, num_samples - (fft_size + (CHART_FFT_MAX_FRAMES - 1) * hop));
+    if (start)
+    {
+        s.samples.clear();
+        s.since_frame = hop;
+    }
+
+    // Add samples (frame every hop once window full)
+    for (int i = start; i < num_samples; i++)
+    {
+        s.samples.append(samples.at(i));
+        s.since_frame += 1;
+        if ((s.samples.length() == fft_size) && (hop <= s.since_frame)) add_frame(&s);
+    }
+
+    // Send averaged spectrum if new frames
+    if (!s.num_frames) return;
+    build_spectrum(&s);
+    emit spectrum_ready(series_uid, spectrum);
+}
+
+void GUI_CHART_SPECTRUM::reset_series(Spectrum_Series *s)
+{
+    // Drop samples & frames (spectrum restarts once window fills)
+    s->samples.reset(fft_size);
+    s->since_frame = 0;
+    s->power_sum.fill(0, fft_size / 2 + 1);
+    s->num_frames = 0;
+    s->sample_rate = 0;
+}
+
+void GUI_CHART_SPECTRUM::add_frame(Spectrum_Series *s)
+{
+    s->since_frame = 0;
+
+    // Get sample rate from frame times (skip frame if no time span)
+    double span_ms = s->samples.at(fft_size - 1).x() - s->samples.at(0).x();
+    if (span_ms <= 0) return;
+    s->sample_rate = 1000.0 * (fft_size - 1) / span_ms;
+
+    // Resample onto even grid (polled sample times carry host jitter)
+    // & window samples (linear between the samples around each point)
+    float *in = frame_in.data();
+    const float *w = window.constData();
+    double t0 = s->samples.at(0).x();
+    double step_ms = span_ms / (fft_size - 1);
+    double t, frac;
+    int j = 0;
+    for (int i = 0; i < fft_size; i++)
+    {
+        t = t0 + i * step_ms;
+        while ((j < (fft_size - 2)) && (s->samples.at(j + 1).x() < t)) j++;
+        const QPointF &a = s->samples.at(j);
+        const QPointF &b = s->samples.at(j + 1);
+        frac = (a.x() < b.x()) ? qBound(0.0, (t - a.x()) / (b.x() - a.x()), 1.0) : 0.0;
+        in[i] = w[i] * (float) (a.y() + frac * (b.y() - a.y()));
+    }
+    fft.forward(in, frame_re.data(), frame_im.data());
+
+    // Add frame power
+    const float *re = frame_re.constData();
+    const float *im = frame_im.constData();
+    double *power = s->power_sum.data();
+    int num_bins = fft_size / 2 + 1;
+    for (int k = 0; k < num_bins; k++) power[k] += (double) re[k] * re[k] + (double) im[k] * im[k];
+    s->num_frames += 1;
+}
+
+void GUI_CHART_SPECTRUM::build_spectrum(Spectrum_Series *s)
+{
+    // Amplitude scale (single sided & window gain corrected)
+    int num_bins = fft_size / 2 + 1;
+    double scale = 4.0 / (window_sum * window_sum * s->num_frames);
+    double bin_hz = s->sample_rate / fft_size;
+
+    // One point per bin or loudest bin per pixel if bins outnumber pixels
+    int bins_per_point = ((0 < width_px) && ((2 * width_px) < num_bins)) ? qCeil((double) num_bins / width_px) : 1;
+    spectrum.clear();
+    spectrum.reserve(num_bins / bins_per_point + 1);
+    double *power = s->power_sum.data();
+    int end, max_k;
+    double bin_scale;
+    for (int k = 0; k < num_bins; k = end)
+    {
+        end = qMin(num_bins, k + bins_per_point);
+        max_k = k;
+        for (int i = k + 1; i < end; i++) if (power[max_k] < power[i]) max_k = i;
+
+        // DC & Nyquist bins are not doubled
+        bin_scale = ((max_k == 0) || (max_k == (num_bins - 1))) ? (scale / 4.0) : scale;
+        spectrum.append(QPointF(max_k * bin_hz, 10.0 * log10(qMax(power[max_k] * bin_scale, 1e-30))));
+    }
+
+    // Restart average
+    s->power_sum.fill(0);
+    s->num_frames = 0;
+}
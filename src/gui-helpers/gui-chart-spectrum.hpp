@@ -0,0 +1,132 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_CHART_SPECTRUM_H
+#define GUI_CHART_SPECTRUM_H
+
+// Base object include
+#include <QObject>
+
+// Required object includes
+#include <QMap>
+#include <QPointF>
+#include <QVector>
+#include <QStringList>
+
+// Local object includes
+#include "gui-pin-history.hpp"
+#include "gui-chart-fft.hpp"
+
+// Spectrum sizes (FFT points, powers of two)
+#define CHART_FFT_MIN_SIZE 256
+#define CHART_FFT_MAX_SIZE 65536
+#define CHART_FFT_DEFAULT_SIZE 4096
+
+// Most FFT frames computed per update (older frames skipped)
+#define CHART_FFT_MAX_FRAMES 8
+
+// Needs to be in same order as supportedWindowsList
+typedef enum {
+    CHART_FFT_WINDOW_HANN = 0,
+    CHART_FFT_WINDOW_HAMMING,
+    CHART_FFT_WINDOW_BLACKMAN,
+    CHART_FFT_WINDOW_RECTANGULAR
+} chart_fft_windows;
+
+// Needs to be in same order as supportedOverlapsList
+typedef enum {
+    CHART_FFT_OVERLAP_0 = 0,
+    CHART_FFT_OVERLAP_50,
+    CHART_FFT_OVERLAP_75
+} chart_fft_overlaps;
+
+// Amplitude spectrum of chart series (dB, single sided)
+// Each series keeps its newest FFT size samples. A new frame is
+// transformed every hop (FFT size less overlap) of new samples & frames
+// since the last update are power averaged (Welch) into one spectrum.
+// Frames are resampled onto an even grid over their sample times, so
+// polled samples (uneven host times) are not taken as evenly spaced.
+// Runs in the chart's spectrum thread (all slots queued).
+class GUI_CHART_SPECTRUM : public QObject
+{
+    Q_OBJECT
+
+public:
+    GUI_CHART_SPECTRUM(QObject *parent = 0);
+    ~GUI_CHART_SPECTRUM();
+
+    static QStringList get_fft_sizes();
+    static QStringList get_window_types();
+    static QStringList get_overlaps();
+
+signals:
+    // Spectrum to show for series (whole series, frequency ascending)
+    void spectrum_ready(QString series_uid, QVector<QPointF> points);
+
+public slots:
+    // Spectrum settings (restarts every series)
+    void set_view(int new_fft_size, int new_window_type, int new_overlap);
+
+    // Plot width (points per spectrum, next spectrum onwards)
+    void set_width(int new_width_px);
+
+    // Series management
+    void add_series(QString series_uid);
+    void remove_series(QString series_uid);
+    void clear();
+
+    // Add new samples of series (x in ms) & emit spectrum if new frames
+    void add_samples(QString series_uid, QVector<QPointF> samples);
+
+private:
+    // Series state
+    typedef struct {
+        HISTORY_RING<QPointF> samples;  // Newest FFT size samples
+        int since_frame;                // Samples since last frame
+        QVector<double> power_sum;      // Frame power since last update
+        int num_frames;                 // Frames in power sum
+        double sample_rate;             // Newest frame sample rate (Hz)
+    } Spectrum_Series;
+
+    // View variables
+    int fft_size;
+    int hop;
+    int width_px;
+    QVector<float> window;
+    double window_sum;
+
+    // FFT & reused buffers
+    GUI_CHART_FFT fft;
+    QVector<float> frame_in;
+    QVector<float> frame_re;
+    QVector<float> frame_im;
+    QVector<QPointF> spectrum;
+
+    // Series states
+    QMap<QString, Spectrum_Series> series;
+
+    static QStringList supportedWindowsList;
+    static QStringList supportedOverlapsList;
+
+    // Spectrum helpers
+    void reset_series(Spectrum_Series *s);
+    void add_frame(Spectrum_Series *s);
+    void build_spectrum(Spectrum_Series *s);
+};
+
+#endif // GUI_CHART_SPECTRUM_H
@@ -0,0 +1,129 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "gui-chart-stats.hpp"
+
+#include <QtMath>
+
+GUI_CHART_STATS::GUI_CHART_STATS()
+{
+    reset(0);
+}
+
+GUI_CHART_STATS::~GUI_CHART_STATS()
+{
+    /* DO NOTHING */
+}
+
+void GUI_CHART_STATS::reset(int capacity)
+{
+    // Clear window
+    window = Welford_State{.n=0, .mean=0, .m2=0};
+    window_min.reset(capacity);
+    window_max.reset(capacity);
+
+    // Clear since start
+    total = Welford_State{.n=0, .mean=0, .m2=0};
+    total_min = 0;
+    total_max = 0;
+}
+
+void GUI_CHART_STATS::add(QPointF p)
+{
+    double y = p.y();
+
+    // Update since start
+    if (!total.n) total_min = total_max = y;
+    total_min = qMin(total_min, y);
+    total_max = qMax(total_max, y);
+    welford_add(&total, y);
+
+    // Update window
+    window_add(p);
+}
+
+void GUI_CHART_STATS::remove(QPointF p)
+{
+    if (!window.n) return;
+
+    // Update window mean & variance
+    welford_remove(&window, p.y());
+
+    // Drop fronts leaving window
+    if (window_min.length() && (window_min.at(0) == p)) window_min.drop_oldest();
+    if (window_max.length() && (window_max.at(0) == p)) window_max.drop_oldest();
+}
+
+Chart_Stats GUI_CHART_STATS::get_window()
+{
+    if (!window.n) return Chart_Stats_DEFAULT;
+    return get_stats(window, window_min.at(0).y(), window_max.at(0).y());
+}
+
+Chart_Stats GUI_CHART_STATS::get_total()
+{
+    return get_stats(total, total_min, total_max);
+}
+
+void GUI_CHART_STATS::window_add(QPointF p)
+{
+    double y = p.y();
+
+    // Update window mean & variance
+    welford_add(&window, y);
+
+    // Drop deque entries the new sample outranks (fronts stay extremes)
+    while (window_min.length() && (y <= window_min.at(window_min.length() - 1).y())) window_min.drop_newest();
+    while (window_max.length() && (window_max.at(window_max.length() - 1).y() <= y)) window_max.drop_newest();
+    window_min.append(p);
+    window_max.append(p);
+}
+
+void GUI_CHART_STATS::welford_add(Welford_State *state, double y)
+{
+    state->n += 1;
+    double delta = y - state->mean;
+    state->mean += delta / state->n;
+    state->m2 += delta * (y - state->mean);
+}
+
+void GUI_CHART_STATS::welford_remove(Welford_State *state, double y)
+{
+    // Last sample leaves empty state
+    if (state->n <= 1)
+    {
+        *state = Welford_State{.n=0, .mean=0, .m2=0};
+        return;
+    }
+
+    // Reverse of add (rounding can leave m2 slightly negative)
+    double delta = y - state->mean;
+    state->mean -= delta / (state->n - 1);
+    state->m2 = qMax(0.0, state->m2 - delta * (y - state->mean));
+    state->n -= 1;
+}
+
+Chart_Stats GUI_CHART_STATS::get_stats(const Welford_State &state, double min, double max)
+{
+    if (!state.n) return Chart_Stats_DEFAULT;
+
+    // RMS from variance & mean (population), std is sample deviation
+    double var_pop = state.m2 / state.n;
+    return Chart_Stats{.count=state.n, .min=min, .max=max, .mean=state.mean,
+                       .rms=qSqrt(var_pop + state.mean * state.mean),
+                       .std=(1 < state.n) ? qSqrt(state.m2 / (state.n - 1)) : 0.0};
+}
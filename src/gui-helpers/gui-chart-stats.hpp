@@ -0,0 +1,102 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef GUI_CHART_STATS_H
+#define GUI_CHART_STATS_H
+
+#include <QPointF>
+#include <QMetaType>
+
+#include "gui-pin-history.hpp"
+
+// Series statistics
+typedef struct {
+    quint64 count;
+    double min;
+    double max;
+    double mean;
+    double rms;
+    double std;     // Sample standard deviation
+} Chart_Stats;
+#define Chart_Stats_DEFAULT Chart_Stats{\
+    .count=0, .min=0, .max=0, .mean=0, .rms=0, .std=0}
+Q_DECLARE_METATYPE(Chart_Stats)
+
+// Window & since start statistics with O(1) updates
+// Mean & variance use Welford's method (window also removes samples),
+// window min/max use monotonic deques (front is the window extreme)
+class GUI_CHART_STATS
+{
+public:
+    GUI_CHART_STATS();
+    ~GUI_CHART_STATS();
+
+    // Clear all (capacity is most samples in window)
+    void reset(int capacity);
+
+    // Sample enters window & since start
+    void add(QPointF p);
+
+    // Oldest window sample leaves (must be removed in add order)
+    void remove(QPointF p);
+
+    // Restart window from points (since start kept)
+    // (any ring or view of points, deques sized to its capacity)
+    template <typename T>
+    void set_window(const T &points)
+    {
+        // Clear window
+        window = Welford_State{.n=0, .mean=0, .m2=0};
+        window_min.reset(points.capacity());
+        window_max.reset(points.capacity());
+
+        // Re-add window points (only window updated)
+        for (int i = 0; i < points.length(); i++) window_add(points.at(i));
+    }
+
+    // Current statistics
+    Chart_Stats get_window();
+    Chart_Stats get_total();
+
+private:
+    // Running mean & sum of squared differences
+    typedef struct {
+        quint64 n;
+        double mean;
+        double m2;
+    } Welford_State;
+
+    // Window state
+    Welford_State window;
+    HISTORY_RING<QPointF> window_min;
+    HISTORY_RING<QPointF> window_max;
+
+    // Since start state
+    Welford_State total;
+    double total_min;
+    double total_max;
+
+    // Window helper
+    void window_add(QPointF p);
+
+    // Welford helpers
+    static void welford_add(Welford_State *state, double y);
+    static void welford_remove(Welford_State *state, double y);
+    static Chart_Stats get_stats(const Welford_State &state, double min, double max);
+};
+
+#endif // GUI_CHART_STATS_H
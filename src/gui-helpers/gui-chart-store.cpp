@@ -0,0 +1,160 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-chart-store.hpp"
+
+#include <QtMath>
+
+GUI_CHART_STORE::GUI_CHART_STORE()
+{
+    /* DO NOTHING */
+}
+
+GUI_CHART_STORE::~GUI_CHART_STORE()
+{
+    /* DO NOTHING */
+}
+
+void GUI_CHART_STORE::reference(QString series_uid, const void *owner, double duration_s, int interval_ms)
+{
+    QWriteLocker locker(&lock);
+
+    // Add series on first reference
+    if (!series.contains(series_uid))
+    {
+        Chart_Store_Series &n_series = series[series_uid];
+        n_series.points.reset(0);
+        n_series.appended = 0;
+        n_series.min_gap_s = 0;
+    }
+
+    // Set reference & fit series
+    Chart_Store_Series &s = series[series_uid];
+    s.refs.insert(owner, qMakePair(duration_s, interval_ms));
+    update_capacity(&s);
+}
+
+void GUI_CHART_STORE::release(QString series_uid, const void *owner)
+{
+    QWriteLocker locker(&lock);
+
+    // Verify referenced
+    QMap<QString, Chart_Store_Series>::iterator it = series.find(series_uid);
+    if ((it == series.end()) || !it.value().refs.remove(owner)) return;
+
+    // Remove unreferenced series or fit remaining references
+    if (it.value().refs.isEmpty()) series.erase(it);
+    else update_capacity(&it.value());
+}
+
+void GUI_CHART_STORE::release_all(const void *owner)
+{
+    QWriteLocker locker(&lock);
+
+    // Drop owner from every series
+    QMap<QString, Chart_Store_Series>::iterator it = series.begin();
+    while (it != series.end())
+    {
+        if (!it.value().refs.remove(owner))
+        {
+            it++;
+        } else if (it.value().refs.isEmpty())
+        {
+            it = series.erase(it);
+        } else
+        {
+            update_capacity(&it.value());
+            it++;
+        }
+    }
+}
+
+int GUI_CHART_STORE::get_refs(QString series_uid)
+{
+    QReadLocker locker(&lock);
+    QMap<QString, Chart_Store_Series>::const_iterator it = series.constFind(series_uid);
+    return (it == series.constEnd()) ? 0 : it.value().refs.size();
+}
+
+int GUI_CHART_STORE::get_num_series()
+{
+    QReadLocker locker(&lock);
+    return series.size();
+}
+
+bool GUI_CHART_STORE::append(QString series_uid, QPointF p)
+{
+    QWriteLocker locker(&lock);
+
+    // Verify referenced
+    QMap<QString, Chart_Store_Series>::iterator it = series.find(series_uid);
+    if (it == series.end()) return false;
+    Chart_Store_Series &s = it.value();
+
+    // Skip points not after or too close to newest
+    // (charts due together share a point)
+    int num_points = s.points.length();
+    if (num_points)
+    {
+        double gap_s = p.x() - s.points.at(num_points - 1).x();
+        if ((gap_s <= 0.0) || (gap_s < s.min_gap_s)) return false;
+    }
+
+    // Add point
+    s.points.append(p);
+    s.appended += 1;
+    return true;
+}
+
+QReadWriteLock *GUI_CHART_STORE::get_lock()
+{
+    return &lock;
+}
+
+const Chart_Store_Series *GUI_CHART_STORE::find(QString series_uid)
+{
+    QMap<QString, Chart_Store_Series>::const_iterator it = series.constFind(series_uid);
+    return (it == series.constEnd()) ? nullptr : &it.value();
+}
+
+void GUI_CHART_STORE::update_capacity(Chart_Store_Series *s)
+{
+    // Get longest window & fastest rate
+    double duration_s = 0;
+    int interval_ms = 0;
+    foreach (const QPair<double, int> &ref, s->refs)
+    {
+        duration_s = qMax(duration_s, ref.first);
+        if ((0 < ref.second) && (!interval_ms || (ref.second < interval_ms))) interval_ms = ref.second;
+    }
+
+    // Points closer than a fraction of fastest rate are skipped
+    double interval_s = ((double) interval_ms) / 1000.0;
+    s->min_gap_s = CHART_SERIES_MIN_GAP * interval_s;
+
+    // Fit longest window at fastest rate (keeps size if either unknown)
+    if ((interval_ms <= 0) || (duration_s <= 0.0))
+    {
+        if (!s->points.capacity()) s->points.resize(CHART_SERIES_MIN_POINTS);
+        return;
+    }
+    double window_points = CHART_SERIES_MARGIN * (duration_s / s->min_gap_s);
+    int capacity = (int) qBound<double>(CHART_SERIES_MIN_POINTS, qCeil(window_points) + 2,
+                                        CHART_SERIES_MAX_POINTS);
+    if (capacity != s->points.capacity()) s->points.resize(capacity);
+}
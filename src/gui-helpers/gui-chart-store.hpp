@@ -0,0 +1,103 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_CHART_STORE_H
+#define GUI_CHART_STORE_H
+
+#include <QMap>
+#include <QString>
+#include <QPointF>
+#include <QReadWriteLock>
+
+#include "gui-pin-history.hpp"
+
+// Series points kept (longest referencing window at the fastest
+// referencing rate plus margin, stored points at least min gap apart)
+#define CHART_SERIES_MARGIN 1.25
+#define CHART_SERIES_MIN_GAP 0.75
+#define CHART_SERIES_MIN_POINTS 16
+#define CHART_SERIES_MAX_POINTS (1 << 20)
+
+// Stored series (sequence numbers count every appended point,
+// oldest kept point is appended - points.length())
+typedef struct {
+    HISTORY_RING<QPointF> points;
+    quint64 appended;
+    double min_gap_s;
+    QMap<const void*, QPair<double, int>> refs;  // Owner window (s) & rate (ms)
+} Chart_Store_Series;
+
+// Window of a stored series (oldest window point at 0)
+class CHART_STORE_VIEW
+{
+public:
+    CHART_STORE_VIEW(const HISTORY_RING<QPointF> &ring, int first, int count) :
+        points(ring), offset(first), num(count) {}
+
+    void grow() { num++; }
+    void drop_oldest() { if (num) { offset++; num--; } }
+
+    int length() const { return num; }
+    int capacity() const { return points.capacity(); }
+    const QPointF &at(int i) const { return points.at(offset + i); }
+
+private:
+    const HISTORY_RING<QPointF> &points;
+    int offset;
+    int num;
+};
+
+// Chart series shared by every chart plotting them
+// Series are reference counted by owner (chart) & sized to fit every
+// owner's window, so another chart of a plotted series adds no points.
+// Owners keep their own view (window, range & sampling). Appends are
+// made from the GUI thread, readers (sampler threads) hold the read lock
+// while using a found series.
+class GUI_CHART_STORE
+{
+public:
+    GUI_CHART_STORE();
+    ~GUI_CHART_STORE();
+
+    // Reference series for owner (adds series on first reference,
+    // updates window & rate if owner already references it)
+    void reference(QString series_uid, const void *owner, double duration_s, int interval_ms);
+
+    // Drop owner references (series removed once unreferenced)
+    void release(QString series_uid, const void *owner);
+    void release_all(const void *owner);
+
+    int get_refs(QString series_uid);
+    int get_num_series();
+
+    // Add point to referenced series (false if not min gap after newest)
+    bool append(QString series_uid, QPointF p);
+
+    // Readers lock for read while using found series
+    QReadWriteLock *get_lock();
+    const Chart_Store_Series *find(QString series_uid);
+
+private:
+    QReadWriteLock lock;
+    QMap<QString, Chart_Store_Series> series;
+
+    // Resize series to fit every reference
+    void update_capacity(Chart_Store_Series *s);
+};
+
+#endif // GUI_CHART_STORE_H
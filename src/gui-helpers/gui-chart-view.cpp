@@ -93,14 +93,14 @@ void GUI_CHART_VIEW::set_data_list(QStringList new_data_series_list)
     }
 }
 
-void GUI_CHART_VIEW::element_data_request(QList<QString> data_points)
+void GUI_CHART_VIEW::element_subscribe_request(QList<QString> series_uids, int interval_ms)
 {
     // Get sending element
     GUI_CHART_ELEMENT *elem = (GUI_CHART_ELEMENT*) sender();
     if (!elem) return;
 
-    // Emit update to parent
-    emit update_request(data_points, elem);
+    // Emit subscription to parent
+    emit subscribe_request(series_uids, interval_ms, elem);
 }
 
 void GUI_CHART_VIEW::on_AddChart_Button_clicked()
@@ -118,10 +118,11 @@ void GUI_CHART_VIEW::on_AddChart_Button_clicked()
             this, SLOT(destroy_chart_element()),
             Qt::QueuedConnection);
 
-    // Connect to update slots
-    connect(new_elem, SIGNAL(update_request(QList<QString>)),
-            this, SLOT(element_data_request(QList<QString>)),
-            Qt::QueuedConnection);
+    // Connect to subscribe slots
+    // (direct so element is still valid when subscribed)
+    connect(new_elem, SIGNAL(subscribe_request(QList<QString>, int)),
+            this, SLOT(element_subscribe_request(QList<QString>, int)),
+            Qt::DirectConnection);
 
     // Append to charts
     charts.append(new_elem);
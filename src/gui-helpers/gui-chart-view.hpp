@@ -36,13 +36,13 @@ public:
     ~GUI_CHART_VIEW();
 
 signals:
-    void update_request(QList<QString> data_points, GUI_CHART_ELEMENT *target_element);
+    void subscribe_request(QList<QString> series_uids, int interval_ms, GUI_CHART_ELEMENT *target_element);
 
 public slots:
     void reset_gui();
     void destroy_chart_element();
     void set_data_list(QStringList new_data_series_list);
-    void element_data_request(QList<QString> data_points);
+    void element_subscribe_request(QList<QString> series_uids, int interval_ms);
 
 private slots:
     void on_AddChart_Button_clicked();
@@ -33,13 +33,18 @@ GUI_COMM_BRIDGE::supportedChecksums({
         });
 
 GUI_COMM_BRIDGE::GUI_COMM_BRIDGE(uint8_t num_guis, QObject *parent) :
-    QObject(parent)
+    QObject(parent),
+    ackTimer(this),
+    ackLoop(this),
+    devReadyLoop(this)
 {
     // Setup base flags
     bridge_flags = 0x00;
 
     // Setup dev variables
     dev_status = false;
+    link_suspended = false;
+    tx_sequence = 0;
 
     // Setup Ack variables
     ack_status = false;
@@ -48,6 +53,11 @@ GUI_COMM_BRIDGE::GUI_COMM_BRIDGE(uint8_t num_guis, QObject *parent) :
     // Set generic defaults
     chunk_size = GUI_COMM_BRIDGE::default_chunk_size;
 
+    // Register slot metaTypes (pooled bridges are invoked across threads)
+    qRegisterMetaType<uint8_t>("uint8_t");
+    qRegisterMetaType<uint32_t>("uint32_t");
+    qRegisterMetaType<QMap<QString, QVariant>*>("QMap<QString,QVariant>*");
+
     // Init storage lists
     for (uint8_t i = 0; i < num_guis; i++)
     {
@@ -63,6 +73,9 @@ GUI_COMM_BRIDGE::GUI_COMM_BRIDGE(uint8_t num_guis, QObject *parent) :
     connect(this, SIGNAL(reset()),
             &devReadyLoop, SLOT(quit()),
             Qt::DirectConnection);
+    connect(this, SIGNAL(resumed()),
+            &devReadyLoop, SLOT(quit()),
+            Qt::DirectConnection);
 
     // Connect ack loop signals and slots
     // All internal object connections so direct is okay
@@ -78,6 +91,9 @@ GUI_COMM_BRIDGE::GUI_COMM_BRIDGE(uint8_t num_guis, QObject *parent) :
     connect(this, SIGNAL(reset()),
             &ackLoop, SLOT(quit()),
             Qt::DirectConnection);
+    connect(this, SIGNAL(resumed()),
+            &ackLoop, SLOT(quit()),
+            Qt::DirectConnection);
 
     // Connect re-emit signals to slots
     // Use queued connections to return to main event loop first
@@ -189,6 +205,46 @@ void GUI_COMM_BRIDGE::reset_remote()
     send_chunk(MAJOR_KEY_RESET, 0);
 }
 
+void GUI_COMM_BRIDGE::attach_device(COMMS_BASE *new_device)
+{
+    // Remove any previous device
+    detach_device();
+    if (!new_device) return;
+    device = new_device;
+
+    // Connect device queue wakeups
+    // Use queued connection for thread expansion
+    connect(device, SIGNAL(dataAvailable()),
+            this, SLOT(receive_queued()),
+            Qt::QueuedConnection);
+    connect(device, SIGNAL(writeSpaceAvailable()),
+            this, SLOT(retry_writes()),
+            Qt::QueuedConnection);
+}
+
+void GUI_COMM_BRIDGE::detach_device()
+{
+    // Remove device queue wakeups
+    if (!device) return;
+    disconnect(device, SIGNAL(dataAvailable()),
+               this, SLOT(receive_queued()));
+    disconnect(device, SIGNAL(writeSpaceAvailable()),
+               this, SLOT(retry_writes()));
+    device = nullptr;
+}
+
+void GUI_COMM_BRIDGE::receive_queued()
+{
+    // Drain everything the device has queued
+    if (device) receive(device->readQueued());
+}
+
+void GUI_COMM_BRIDGE::retry_writes()
+{
+    // Push held overflow now that the device has space
+    if (device) device->writeQueued(QByteArray());
+}
+
 void GUI_COMM_BRIDGE::receive(QByteArray recvData)
 {
     // Check if recieving empty data array or exiting
@@ -322,8 +378,14 @@ void GUI_COMM_BRIDGE::receive(QByteArray recvData)
                 }
 
                 // Clear array if error, else remove packet from rcvd
-                if (exit_recv) rcvd_raw.clear();
-                else rcvd_raw.remove(0, expected_len+checksum_size);
+                if (exit_recv)
+                {
+                    rcvd_raw.clear();
+                } else
+                {
+                    add_stats(&rx_stats, major_key, minor_key, expected_len+checksum_size);
+                    rcvd_raw.remove(0, expected_len+checksum_size);
+                }
 
                 // Break out of Key Switch
                 break;
@@ -374,8 +436,9 @@ void GUI_COMM_BRIDGE::receive(QByteArray recvData)
                 tmp.append((char) minor_key);
                 tmp.append(rcvd_raw.mid(s1_end_loc+num_s2_bits, num_s2_bytes));
 
-                // Ack success
-                send_ack(major_key);
+                // Ack success (streamed packets are acked in batches)
+                if (is_stream_packet(major_key, minor_key)) ack_stream(major_key);
+                else send_ack(major_key);
 
                 // Emit readyRead - Send to all registered base guis
                 // (Indexing without check encforced by switch statement case)
@@ -389,6 +452,7 @@ void GUI_COMM_BRIDGE::receive(QByteArray recvData)
                 }
 
                 // Remove data from rcvd_raw
+                add_stats(&rx_stats, major_key, minor_key, expected_len+checksum_size);
                 rcvd_raw.remove(0, expected_len+checksum_size);
 
                 // Break out of Key Switch
@@ -554,14 +618,76 @@ void GUI_COMM_BRIDGE::send_chunk_pack(quint8 major_key, quint8 minor_key,
     handle_next_send();
 }
 
+void GUI_COMM_BRIDGE::suspend_bridge()
+{
+    // Stop writing to the device (send loops keep retrying the
+    // current packet so nothing acked is sent again)
+    link_suspended = true;
+}
+
+void GUI_COMM_BRIDGE::resume_bridge()
+{
+    // Verify suspended
+    if (!link_suspended) return;
+    link_suspended = false;
+
+    // Drop any partial packet from before the drop
+    // (skip if receive() active, it owns the buffer)
+    if (rcvLock.tryLock())
+    {
+        rcvd_raw.clear();
+        rcvLock.unlock();
+    }
+
+    // Break out of ack & dev ready waits to resend now
+    // (a dev ready sent while the link was down is lost)
+    emit resumed();
+}
+
+Bridge_Stats GUI_COMM_BRIDGE::get_rx_stats(uint8_t major_key, uint8_t minor_key)
+{
+    // Get received key totals
+    QMutexLocker locker(&statsLock);
+    return rx_stats.value((major_key << 8) | minor_key, Bridge_Stats_DEFAULT);
+}
+
+Bridge_Stats GUI_COMM_BRIDGE::get_tx_stats(uint8_t major_key, uint8_t minor_key)
+{
+    // Get written key totals
+    QMutexLocker locker(&statsLock);
+    return tx_stats.value((major_key << 8) | minor_key, Bridge_Stats_DEFAULT);
+}
+
+void GUI_COMM_BRIDGE::clear_stats()
+{
+    // Clear all totals
+    QMutexLocker locker(&statsLock);
+    rx_stats.clear();
+    tx_stats.clear();
+}
+
+void GUI_COMM_BRIDGE::add_stats(QMap<uint16_t, Bridge_Stats> *stats, uint8_t major_key,
+                                uint8_t minor_key, quint64 num_bytes)
+{
+    // Add packet to key totals
+    QMutexLocker locker(&statsLock);
+    Bridge_Stats &key_stats = (*stats)[(major_key << 8) | minor_key];
+    key_stats.packets += 1;
+    key_stats.bytes += num_bytes;
+}
+
 bool GUI_COMM_BRIDGE::open_bridge()
 {
     // Clear everything but the exit flag
     bridge_flags &= bridge_exit_flag;
 
+    // Clear any suspend from a previous link
+    link_suspended = false;
+
     // Clear any accidental sends/recvs
     transmitList.clear();
     rcvd_raw.clear();
+    stream_unacked.clear();
 
     // True if all flags cleared, false if bridge_exit_flag set
     return !bridge_flags;
@@ -634,7 +760,7 @@ void GUI_COMM_BRIDGE::send_ack(uint8_t majorKey)
 
     // Send ack immediately
     // Not expecting ack back (makes this possible)
-    emit write_data(ack_packet);
+    write_device(ack_packet);
 }
 
 void GUI_COMM_BRIDGE::waitForAck(int msecs)
@@ -809,6 +935,36 @@ void GUI_COMM_BRIDGE::check_packet(uint8_t major_key)
     }
 }
 
+bool GUI_COMM_BRIDGE::is_stream_packet(uint8_t major_key, uint8_t minor_key)
+{
+    // Check if the receiving gui marks the key as streamed
+    foreach (GUI_BASE *gui, known_guis)
+    {
+        if ((gui->get_gui_key() == major_key)
+                && gui->isStreamKey(minor_key))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void GUI_COMM_BRIDGE::ack_stream(uint8_t major_key)
+{
+    // Only ack every stream_ack_interval packets
+    // (device holds the stream if too many go unacked)
+    uint32_t unacked = stream_unacked.value(major_key, 0) + 1;
+    if (unacked < stream_ack_interval)
+    {
+        stream_unacked.insert(major_key, unacked);
+        return;
+    }
+
+    // Ack batch (marked so device never takes it for a packet ack)
+    stream_unacked.insert(major_key, 0);
+    send_ack(major_key | stream_ack_flag);
+}
+
 bool GUI_COMM_BRIDGE::get_send_lock(uint8_t major_key, uint8_t minor_key,
                                     QVariant data, GUI_BASE *sending_gui,
                                     uint8_t target, uint8_t base,
@@ -1118,8 +1274,9 @@ QByteArray GUI_COMM_BRIDGE::prepare_data(quint8 major_key, quint8 minor_key, QBy
     else if (data_len <= 0xFFFF) num_s2_bits = num_s2_bits_2;
     else num_s2_bits = num_s2_bits_3;
 
-    // Load into data array
-    ret_data.append((char) (major_key | (num_s2_bits << s1_num_s2_bits_byte_shift)));
+    // Load into data array (resets restart the device sequence)
+    uint8_t sequence = (major_key == MAJOR_KEY_RESET) ? 0 : tx_sequence;
+    ret_data.append((char) (major_key | sequence | (num_s2_bits << s1_num_s2_bits_byte_shift)));
     ret_data.append((char) minor_key);
 
     // Adjust byte length of 3 (want uint32_t not uint24_t)
@@ -1157,10 +1314,12 @@ void GUI_COMM_BRIDGE::transmit_data(QByteArray data)
     bool isReset = (ack_key == MAJOR_KEY_RESET);
 
     // Send data and verify ack
+    // (packet written before the link dropped may have run with its ack
+    // lost, the device acks the resend without running it again)
     do
     {
-        // Emit write command to connected device
-        emit write_data(data);
+        // Write command to connected device (dropped while suspended)
+        write_device(data);
 
         // Wait for CMD ack back
         waitForAck(packet_timeout);
@@ -1168,6 +1327,9 @@ void GUI_COMM_BRIDGE::transmit_data(QByteArray data)
              && (!(bridge_flags & bridge_reset_flag) || isReset)
              && !(bridge_flags & bridge_close_flag));
 
+    // Next new packet flips sequence bit
+    if (ack_status && !isReset) tx_sequence ^= s1_sequence_flag;
+
     // Check if reseting and if CMD was reset
     if ((bridge_flags & bridge_reset_flag) && isReset)
     {
@@ -1182,3 +1344,20 @@ void GUI_COMM_BRIDGE::transmit_data(QByteArray data)
     // If exiting, check if ready
     if (bridge_flags & bridge_close_flag) close_bridge();
 }
+
+void GUI_COMM_BRIDGE::write_device(QByteArray data)
+{
+    // Drop writes while link is down (resent after resume)
+    if (link_suspended) return;
+
+    // Count write (resends included)
+    if (num_s1_bytes <= data.length())
+    {
+        add_stats(&tx_stats, data.at(s1_major_key_loc) & s1_major_key_byte_mask,
+                  data.at(s1_minor_key_loc), data.length());
+    }
+
+    // Queue for device if attached, else let connections handle it
+    if (device) device->writeQueued(data);
+    else emit write_data(data);
+}
@@ -27,6 +27,7 @@
 #include <QMutex>
 #include <QTimer>
 #include <QVariant>
+#include <QPointer>
 #include <QEventLoop>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
@@ -35,8 +36,16 @@
 #include "../user-interfaces/gui-base-major-keys.h"
 #include "../user-interfaces/gui-base.hpp"
 #include "../checksums/checksums.h"
+#include "../communication/comms-base.hpp"
 #include "gui-generic-helper.hpp"
 
+// Packet statistics (per major & minor key)
+typedef struct {
+    quint64 packets;
+    quint64 bytes;      // Full packet length (keys, length, data & checksum)
+} Bridge_Stats;
+#define Bridge_Stats_DEFAULT Bridge_Stats{.packets=0, .bytes=0}
+
 class GUI_COMM_BRIDGE : public QObject
 {
     Q_OBJECT
@@ -45,28 +54,21 @@ public:
     GUI_COMM_BRIDGE(uint8_t num_guis, QObject *parent = 0);
     ~GUI_COMM_BRIDGE();
 
-    // Chunk getter & setters
+    // Chunk getter
     uint32_t get_chunk_size();
-    void set_chunk_size(uint32_t chunk);
 
     // Supported checksums
     static QStringList get_supported_checksums();
 
-    // Checksum setters
-    void set_tab_checksum(uint8_t gui_key, QStringList new_tab_checksum);
-
-    // Parse input array
-    void parseGenericConfigMap(QMap<QString, QVariant> *configMap);
-
-    // Add/remove knowns guis
-    void add_gui(GUI_BASE *new_gui);
-    void remove_gui(GUI_BASE *old_gui);
+    // Packet statistics getters (safe from any thread)
+    Bridge_Stats get_rx_stats(uint8_t major_key, uint8_t minor_key);
+    Bridge_Stats get_tx_stats(uint8_t major_key, uint8_t minor_key);
 
     // Default chunk size
     static const uint32_t default_chunk_size = 32;
 
 signals:
-    // Write data
+    // Write data (only used when no device attached)
     void write_data(QByteArray data);
 
     // Ack info
@@ -79,6 +81,9 @@ signals:
     // Reset connected GUIs
     void reset();
 
+    // Link back after a suspend
+    void resumed();
+
     // File transmits
     void transmit_file(quint8 major_key, quint8 minor_key,
                        QString filePath, quint8 base,
@@ -96,9 +101,30 @@ signals:
                              QString encoding, GUI_BASE *sender);
 
 public slots:
+    // Chunk setter
+    void set_chunk_size(uint32_t chunk);
+
+    // Clear packet statistics
+    void clear_stats();
+
+    // Checksum setters
+    void set_tab_checksum(uint8_t gui_key, QStringList new_tab_checksum);
+
+    // Parse input array
+    void parseGenericConfigMap(QMap<QString, QVariant> *configMap);
+
+    // Add/remove knowns guis
+    // (slots so bridges running in a worker thread can be invoked)
+    void add_gui(GUI_BASE *new_gui);
+    void remove_gui(GUI_BASE *old_gui);
+
     // Reset remtoe
     void reset_remote();
 
+    // Attach/detach device queues
+    void attach_device(COMMS_BASE *new_device);
+    void detach_device();
+
     // Receive data
     void receive(QByteArray recvData);
 
@@ -121,6 +147,12 @@ public slots:
                          QString encoding = "^(.*)",
                          GUI_BASE *sender = nullptr);
 
+    // Hold or continue sends while the link is down
+    // (state is kept & the unacked packet resent on resume, the device
+    // skips running it again if it already ran)
+    void suspend_bridge();
+    void resume_bridge();
+
     // Signal bridge to open, close, or exit
     bool open_bridge();
     bool close_bridge();
@@ -132,6 +164,10 @@ private slots:
     void waitForAck(int msecs = 5000);
     void checkAck(QByteArray ack);
 
+    // Device queue wakeups
+    void receive_queued();
+    void retry_writes();
+
 private:
     /* Bridge flag. Bits as follows:
      *  1) Exit Bridge
@@ -182,17 +218,26 @@ private:
 
     // Ack helper variables
     bool ack_status;
+    QMap<uint8_t, uint32_t> stream_unacked;
     uint8_t ack_key;
     QTimer ackTimer;
     QEventLoop ackLoop;
 
     // Device helper variables
+    QPointer<COMMS_BASE> device;
+    bool link_suspended;
+    uint8_t tx_sequence;        // Sequence bit of next new packet
     bool dev_status;
     QEventLoop devReadyLoop;
 
     // Chunk variables
     uint32_t chunk_size;
 
+    // Packet statistics (key is major << 8 | minor)
+    QMutex statsLock;
+    QMap<uint16_t, Bridge_Stats> rx_stats;
+    QMap<uint16_t, Bridge_Stats> tx_stats;
+
     // GUI List - Position == key
     QList<GUI_BASE*> known_guis;
 
@@ -214,6 +259,14 @@ private:
     // Checks if packet requires special action
     void check_packet(uint8_t major_key);
 
+    // Packet statistics helper
+    void add_stats(QMap<uint16_t, Bridge_Stats> *stats, uint8_t major_key,
+                   uint8_t minor_key, quint64 num_bytes);
+
+    // Streamed packet helpers (acked in batches)
+    bool is_stream_packet(uint8_t major_key, uint8_t minor_key);
+    void ack_stream(uint8_t major_key);
+
     // Try to acquire sendLock
     bool get_send_lock(uint8_t major_key, uint8_t minor_key,
                        QVariant data, GUI_BASE *sending_gui,
@@ -234,6 +287,7 @@ private:
                           quint32 c_pos = 0, quint32 t_pos = 0);
     QByteArray prepare_data(quint8 major_key, quint8 minor_key, QByteArray chunk = QByteArray());
     void transmit_data(QByteArray data);
+    void write_device(QByteArray data);
 };
 
 #endif // GUI_COMM_BRIDGE_H
@@ -0,0 +1,93 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-comm-pool.hpp"
+
+GUI_COMM_POOL::GUI_COMM_POOL(int num_threads, QObject *parent) :
+    QObject(parent)
+{
+    // Default to one worker per core
+    if (num_threads <= 0) num_threads = QThread::idealThreadCount();
+    if (num_threads <= 0) num_threads = 1;
+
+    // Start all workers
+    QThread *worker;
+    for (int i = 0; i < num_threads; i++)
+    {
+        worker = new QThread(this);
+        worker->start();
+
+        workers.append(worker);
+        worker_loads.append(0);
+    }
+}
+
+GUI_COMM_POOL::~GUI_COMM_POOL()
+{
+    // Stop all workers
+    // (pending deleteLater() calls are run as each thread finishes)
+    foreach (QThread *worker, workers)
+    {
+        worker->quit();
+        worker->wait();
+    }
+}
+
+bool GUI_COMM_POOL::attach(QList<QObject*> group)
+{
+    // Verify group & that it is not already attached
+    if (group.isEmpty() || group_map.contains(group.first())) return false;
+
+    // Find least loaded worker
+    int pos = 0;
+    for (int i = 1; i < workers.length(); i++)
+    {
+        if (worker_loads.at(i) < worker_loads.at(pos)) pos = i;
+    }
+
+    // Move each object (must be parentless & owned by calling thread)
+    foreach (QObject *obj, group)
+    {
+        if (obj) obj->moveToThread(workers.at(pos));
+    }
+
+    // Update load info
+    worker_loads[pos] += 1;
+    group_map.insert(group.first(), pos);
+    return true;
+}
+
+void GUI_COMM_POOL::detach(QList<QObject*> group)
+{
+    // Verify group attached
+    if (group.isEmpty() || !group_map.contains(group.first())) return;
+
+    // Update load info
+    // (objects remain in worker until they are deleted)
+    worker_loads[group_map.take(group.first())] -= 1;
+}
+
+int GUI_COMM_POOL::get_num_threads()
+{
+    return workers.length();
+}
+
+int GUI_COMM_POOL::get_num_groups()
+{
+    return group_map.size();
+}
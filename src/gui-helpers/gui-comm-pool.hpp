@@ -0,0 +1,58 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_COMM_POOL_H
+#define GUI_COMM_POOL_H
+
+// Base object include
+#include <QObject>
+
+// Required object includes
+#include <QList>
+#include <QMap>
+#include <QThread>
+
+class GUI_COMM_POOL : public QObject
+{
+    Q_OBJECT
+
+public:
+    GUI_COMM_POOL(int num_threads = 0, QObject *parent = 0);
+    ~GUI_COMM_POOL();
+
+    // Move a group of parentless objects onto the least loaded worker
+    // (objects in a group share a thread so their connections stay ordered)
+    bool attach(QList<QObject*> group);
+
+    // Release a group from its worker's load count
+    void detach(QList<QObject*> group);
+
+    // Pool info
+    int get_num_threads();
+    int get_num_groups();
+
+private:
+    // Worker threads & number of groups running on each
+    QList<QThread*> workers;
+    QList<int> worker_loads;
+
+    // Group owner (first object) to worker position
+    QMap<QObject*, int> group_map;
+};
+
+#endif // GUI_COMM_POOL_H
@@ -0,0 +1,172 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-device-clock.hpp"
+
+#include <QDateTime>
+
+GUI_DEVICE_CLOCK::GUI_DEVICE_CLOCK()
+{
+    reset();
+}
+
+GUI_DEVICE_CLOCK::~GUI_DEVICE_CLOCK()
+{
+    /* DO NOTHING */
+}
+
+void GUI_DEVICE_CLOCK::reset()
+{
+    // Forget unwrap state
+    last_us = 0;
+    wraps_us = 0;
+    last_device_us = 0;
+    last_host_us = 0;
+    unwrap_valid = false;
+
+    // Forget estimate
+    blocks.reset(DEVICE_CLOCK_BLOCKS - 1);
+    block_min = Clock_Point{.device_us=0, .offset_us=0};
+    block_num = 0;
+    block_valid = false;
+    fit_base_us = 0;
+    fit_ref_us = 0;
+    fit_intercept_us = 0;
+    fit_drift = 0;
+}
+
+qint64 GUI_DEVICE_CLOCK::unwrap(uint32_t time_us, qint64 host_us)
+{
+    // Count wraps of the 32 bit us counter
+    if (host_us < 0) host_us = QDateTime::currentMSecsSinceEpoch() * 1000;
+    qint64 wraps = wraps_us;
+    if ((time_us < last_us) && (0x80000000 < (last_us - time_us)))
+        wraps += Q_INT64_C(0x100000000);
+    qint64 device_us = wraps + time_us;
+
+    // Device time must step with host time (within packet delays & drift),
+    // else device restarted (counter from zero) & estimate starts over
+    if (unwrap_valid)
+    {
+        qint64 host_step_us = host_us - last_host_us;
+        double max_diff_us = DEVICE_CLOCK_RESTART_US + DEVICE_CLOCK_MAX_DRIFT * qAbs(host_step_us);
+        if (max_diff_us < qAbs((device_us - last_device_us) - host_step_us))
+        {
+            reset();
+            wraps = 0;
+            device_us = time_us;
+        }
+    }
+
+    // Save unwrap state
+    wraps_us = wraps;
+    last_us = time_us;
+    last_device_us = device_us;
+    last_host_us = host_us;
+    unwrap_valid = true;
+    return device_us;
+}
+
+void GUI_DEVICE_CLOCK::update(qint64 device_us, qint64 host_us)
+{
+    // Get host minus device time
+    if (host_us < 0) host_us = QDateTime::currentMSecsSinceEpoch() * 1000;
+    Clock_Point point = Clock_Point{.device_us=device_us, .offset_us=host_us - device_us};
+    qint64 point_block = device_us / DEVICE_CLOCK_BLOCK_US;
+
+    // Keep lowest offset of current block (finished block kept on new block)
+    if (!block_valid || (point_block != block_num))
+    {
+        if (block_valid) blocks.append(block_min);
+        block_min = point;
+        block_num = point_block;
+        block_valid = true;
+    } else if (point.offset_us < block_min.offset_us)
+    {
+        block_min = point;
+    } else
+    {
+        // Estimate unchanged
+        return;
+    }
+
+    // Refit with new minimum
+    fit();
+}
+
+bool GUI_DEVICE_CLOCK::is_valid()
+{
+    return block_valid;
+}
+
+double GUI_DEVICE_CLOCK::get_drift_ppm()
+{
+    return fit_drift * 1e6;
+}
+
+qint64 GUI_DEVICE_CLOCK::to_host_us(qint64 device_us)
+{
+    if (!block_valid) return device_us;
+    return device_us + fit_base_us + qRound64(fit_intercept_us + fit_drift * (device_us - fit_ref_us));
+}
+
+qint64 GUI_DEVICE_CLOCK::to_host_ms(qint64 device_us)
+{
+    return to_host_us(device_us) / 1000;
+}
+
+void GUI_DEVICE_CLOCK::fit()
+{
+    // Fit relative to current block (keeps doubles small)
+    fit_base_us = block_min.offset_us;
+    fit_ref_us = block_min.device_us;
+    fit_intercept_us = 0;
+    fit_drift = 0;
+    int num_blocks = blocks.length();
+    if (!num_blocks) return;
+
+    // Least squares line through block minima (including current)
+    double x, y, sum_x = 0, sum_y = 0, sum_xx = 0, sum_xy = 0;
+    int num_points = num_blocks + 1;
+    for (int i = 0; i < num_blocks; i++)
+    {
+        x = blocks.at(i).device_us - fit_ref_us;
+        y = blocks.at(i).offset_us - fit_base_us;
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x * x;
+        sum_xy += x * y;
+    }
+    double denom = num_points * sum_xx - sum_x * sum_x;
+    if (0 < denom)
+    {
+        fit_drift = qBound(-DEVICE_CLOCK_MAX_DRIFT, (num_points * sum_xy - sum_x * sum_y) / denom,
+                           DEVICE_CLOCK_MAX_DRIFT);
+    }
+    fit_intercept_us = (sum_y - fit_drift * sum_x) / num_points;
+
+    // Lower line to lowest minimum (current block is at x = y = 0)
+    double lowest = -fit_intercept_us;
+    for (int i = 0; i < num_blocks; i++)
+    {
+        x = blocks.at(i).device_us - fit_ref_us;
+        y = blocks.at(i).offset_us - fit_base_us;
+        lowest = qMin(lowest, y - (fit_intercept_us + fit_drift * x));
+    }
+    fit_intercept_us += lowest;
+}
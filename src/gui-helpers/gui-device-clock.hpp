@@ -0,0 +1,93 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_DEVICE_CLOCK_H
+#define GUI_DEVICE_CLOCK_H
+
+#include <QtGlobal>
+
+#include "gui-pin-history.hpp"
+
+// Device clock estimator settings
+#define DEVICE_CLOCK_BLOCK_US 1000000   // Device time per offset minimum
+#define DEVICE_CLOCK_BLOCKS 32          // Block minima fitted for drift
+#define DEVICE_CLOCK_MAX_DRIFT 0.001    // Largest drift accepted (1000 ppm)
+#define DEVICE_CLOCK_RESTART_US 5000000 // Device & host time steps this far apart mean a restart
+
+// Maps device times (32 bit us counter) to host epoch time
+// Host minus device time is smallest for the least delayed packets, so
+// the lowest offset of each block of device time is kept & a line fitted
+// through the newest block minima (least squares) gives offset & drift.
+// The line is then lowered to the lowest minimum so it follows the least
+// delayed packets. A single block uses its lowest offset (no drift).
+// Device time stepping unlike host time (counter jumped back or wrapped
+// early) means the device restarted, so the estimate starts over.
+class GUI_DEVICE_CLOCK
+{
+public:
+    GUI_DEVICE_CLOCK();
+    ~GUI_DEVICE_CLOCK();
+
+    // Forget offset, drift & unwrap state (device restarted)
+    void reset();
+
+    // Unwrap 32 bit device us received at host time (-1 for now)
+    // (assumes times within 2^31 us of last, restarts on device restart)
+    qint64 unwrap(uint32_t time_us, qint64 host_us = -1);
+
+    // Add device time received at host time (-1 for now)
+    void update(qint64 device_us, qint64 host_us = -1);
+
+    // Estimate state
+    bool is_valid();
+    double get_drift_ppm();
+
+    // Host epoch time of device time (device time if no estimate)
+    qint64 to_host_us(qint64 device_us);
+    qint64 to_host_ms(qint64 device_us);
+
+private:
+    // Device time & host minus device time
+    typedef struct {
+        qint64 device_us;
+        qint64 offset_us;
+    } Clock_Point;
+
+    // Unwrap state (last unwrapped time & host time it arrived)
+    uint32_t last_us;
+    qint64 wraps_us;
+    qint64 last_device_us;
+    qint64 last_host_us;
+    bool unwrap_valid;
+
+    // Finished block minima & current block minimum
+    HISTORY_RING<Clock_Point> blocks;
+    Clock_Point block_min;
+    qint64 block_num;
+    bool block_valid;
+
+    // Fitted line (offset = base + intercept + drift * (device - ref))
+    qint64 fit_base_us;
+    qint64 fit_ref_us;
+    double fit_intercept_us;
+    double fit_drift;
+
+    void fit();
+};
+
+#endif // GUI_DEVICE_CLOCK_H
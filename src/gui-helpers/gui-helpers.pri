@@ -1,17 +1,47 @@
 SOURCES += \
     $$PWD/gui-comm-bridge.cpp \
+    $$PWD/gui-comm-pool.cpp \
+    $$PWD/gui-pin-store.cpp \
+    $$PWD/gui-pin-history.cpp \
+    $$PWD/gui-pin-scheduler.cpp \
+    $$PWD/gui-pin-model.cpp \
+    $$PWD/gui-pin-log.cpp \
+    $$PWD/gui-log-writer.cpp \
+    $$PWD/gui-log-replay.cpp \
+    $$PWD/gui-device-clock.cpp \
     $$PWD/gui-more-options.cpp \
     $$PWD/gui-create-new-tabs.cpp \
     $$PWD/gui-generic-helper.cpp \
     $$PWD/gui-chart-element.cpp \
+    $$PWD/gui-chart-sampler.cpp \
+    $$PWD/gui-chart-stats.cpp \
+    $$PWD/gui-chart-store.cpp \
+    $$PWD/gui-chart-fft.cpp \
+    $$PWD/gui-chart-spectrum.cpp \
+    $$PWD/gui-chart-feed.cpp \
     $$PWD/gui-chart-view.cpp
 
 HEADERS += \
     $$PWD/gui-comm-bridge.hpp \
+    $$PWD/gui-comm-pool.hpp \
+    $$PWD/gui-pin-store.hpp \
+    $$PWD/gui-pin-history.hpp \
+    $$PWD/gui-pin-scheduler.hpp \
+    $$PWD/gui-pin-model.hpp \
+    $$PWD/gui-pin-log.hpp \
+    $$PWD/gui-log-writer.hpp \
+    $$PWD/gui-log-replay.hpp \
+    $$PWD/gui-device-clock.hpp \
     $$PWD/gui-more-options.hpp \
     $$PWD/gui-create-new-tabs.hpp \
     $$PWD/gui-generic-helper.hpp \
     $$PWD/gui-chart-element.hpp \
+    $$PWD/gui-chart-sampler.hpp \
+    $$PWD/gui-chart-stats.hpp \
+    $$PWD/gui-chart-store.hpp \
+    $$PWD/gui-chart-fft.hpp \
+    $$PWD/gui-chart-spectrum.hpp \
+    $$PWD/gui-chart-feed.hpp \
     $$PWD/gui-chart-view.hpp
 
 FORMS += \
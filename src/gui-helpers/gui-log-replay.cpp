@@ -0,0 +1,325 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "gui-log-replay.hpp"
+#include "gui-log-writer.hpp"
+
+#include <QFile>
+#include <QDateTime>
+#include <QRegularExpression>
+
+GUI_LOG_REPLAY::GUI_LOG_REPLAY(QObject *parent) :
+    QObject(parent)
+{
+    // Set clock variables
+    speed = 1.0;
+    clock_ms = 0;
+    next_frame = 0;
+    binary = false;
+
+    // Set clock timer
+    replayTimer.setTimerType(Qt::PreciseTimer);
+    connect(&replayTimer, SIGNAL(timeout()),
+            this, SLOT(advance()),
+            Qt::DirectConnection);
+}
+
+GUI_LOG_REPLAY::~GUI_LOG_REPLAY()
+{
+    close();
+}
+
+bool GUI_LOG_REPLAY::open(QString filePath, QList<uint8_t> pinTypes)
+{
+    // Close any open log
+    close();
+
+    // Try binary first (fails on text magic)
+    if (open_binary(filePath)) binary = true;
+    else if (!open_text(filePath, pinTypes)) return false;
+
+    // Reset clock to first frame
+    seek(get_start_ms());
+    return true;
+}
+
+bool GUI_LOG_REPLAY::is_open()
+{
+    return binary ? reader.is_open() : !frames.isEmpty();
+}
+
+void GUI_LOG_REPLAY::close()
+{
+    // Stop clock
+    replayTimer.stop();
+    next_frame = 0;
+    clock_ms = 0;
+
+    // Drop log
+    binary = false;
+    frames.clear();
+    reader.close();
+    bin_rows.clear();
+    bin_row_cols.clear();
+}
+
+quint64 GUI_LOG_REPLAY::get_num_frames()
+{
+    return binary ? reader.get_num_records() : frames.length();
+}
+
+qint64 GUI_LOG_REPLAY::get_start_ms()
+{
+    return get_num_frames() ? get_frame_time(0) : 0;
+}
+
+qint64 GUI_LOG_REPLAY::get_end_ms()
+{
+    quint64 num_frames = get_num_frames();
+    return num_frames ? get_frame_time(num_frames - 1) : 0;
+}
+
+qint64 GUI_LOG_REPLAY::get_time_ms()
+{
+    return (qint64) clock_ms;
+}
+
+bool GUI_LOG_REPLAY::is_running()
+{
+    return replayTimer.isActive();
+}
+
+void GUI_LOG_REPLAY::start(double new_speed)
+{
+    if (!is_open() || (new_speed < 0)) return;
+
+    // Set speed & restart wall reference
+    speed = new_speed;
+    wallTimer.start();
+
+    // Replay first batch now, then every tick (or every loop if unpaced)
+    replayTimer.start((speed == 0) ? 0 : GUI_LOG_REPLAY_TICK_MS);
+    advance();
+}
+
+void GUI_LOG_REPLAY::pause()
+{
+    replayTimer.stop();
+}
+
+void GUI_LOG_REPLAY::seek(qint64 time_ms)
+{
+    // Move clock (next frame is first at or after it)
+    next_frame = find_frame(time_ms);
+    clock_ms = time_ms;
+    wallTimer.start();
+}
+
+void GUI_LOG_REPLAY::stop()
+{
+    // Hold clock & rewind
+    replayTimer.stop();
+    if (is_open()) seek(get_start_ms());
+}
+
+void GUI_LOG_REPLAY::advance()
+{
+    // Move clock by scaled wall time since last update
+    quint64 num_frames = get_num_frames();
+    if (speed != 0)
+    {
+        clock_ms += speed * (wallTimer.nsecsElapsed() / 1000000.0);
+        wallTimer.start();
+    }
+
+    // Replay due frames (all frames are due when unpaced)
+    int batch = 0;
+    while ((next_frame < num_frames) && (batch < GUI_LOG_REPLAY_BATCH_FRAMES))
+    {
+        if ((speed != 0) && (clock_ms < get_frame_time(next_frame))) break;
+        replay_frame(next_frame);
+        next_frame += 1;
+        batch += 1;
+    }
+
+    // Hold clock at last frame if unpaced or behind
+    if ((speed == 0) || (batch == GUI_LOG_REPLAY_BATCH_FRAMES))
+    {
+        if (next_frame) clock_ms = get_frame_time(next_frame - 1);
+    }
+    if (batch) emit replay_tick((qint64) clock_ms);
+
+    // Stop at end of log
+    if (num_frames <= next_frame)
+    {
+        replayTimer.stop();
+        emit replay_done();
+    }
+}
+
+bool GUI_LOG_REPLAY::open_text(QString filePath, QList<uint8_t> pinTypes)
+{
+    // Read log (completed segments may be compressed)
+    QFile logFile(filePath);
+    if (!logFile.open(QIODevice::ReadOnly)) return false;
+    QByteArray data = logFile.readAll();
+    logFile.close();
+    if (data.startsWith(GUI_LOG_WRITER_QZ_MAGIC)) data = GUI_LOG_WRITER::decompress_data(data);
+
+    // Start lines give the time & period of following rows
+    // (each append adds a new start line)
+    QRegularExpression startLine("^Started: (.*?) (with update rate ([0-9.]+) seconds|exported from binary log)");
+    QRegularExpressionMatch startMatch;
+
+    // Setup parse variables
+    qint64 base_ms = 0;
+    double rate_ms = GUI_LOG_REPLAY_DEFAULT_RATE_MS;
+    qint64 tick = -1;
+    QList<uint8_t> tick_types;
+    QList<QByteArray> fields;
+    Log_Replay_Row row;
+    qint64 time_ms;
+    bool ok;
+
+    // Parse each row
+    foreach (QByteArray line, data.split('\n'))
+    {
+        line = line.trimmed();
+        if (line.isEmpty()) continue;
+
+        // Restart rows at each start line
+        startMatch = startLine.match(QString(line));
+        if (startMatch.hasMatch())
+        {
+            QDateTime started = QDateTime::fromString(startMatch.captured(1), Qt::TextDate);
+            started.setTimeSpec(Qt::UTC);
+            if (started.isValid()) base_ms = started.toMSecsSinceEpoch();
+            else if (!frames.isEmpty()) base_ms = frames.last().time_ms + (qint64) rate_ms;
+
+            rate_ms = startMatch.captured(3).toDouble(&ok) * 1000.0;
+            if (!ok || (rate_ms <= 0)) rate_ms = GUI_LOG_REPLAY_DEFAULT_RATE_MS;
+            tick = -1;
+            tick_types.clear();
+            continue;
+        }
+
+        // Only keep rows of requested pin types (skips events & bursts)
+        fields = line.split(',');
+        row.pinType = fields.at(0).toUInt(&ok);
+        if (!ok || !pinTypes.contains(row.pinType)) continue;
+
+        // Get values (skip partial rows)
+        row.values.resize(fields.length() - 1);
+        for (int i = 1; ok && (i < fields.length()); i++)
+        {
+            row.values[i-1] = fields.at(i).toFloat(&ok);
+        }
+        if (!ok) continue;
+
+        // Each pin type is logged once per tick
+        if ((tick < 0) || tick_types.contains(row.pinType))
+        {
+            tick += 1;
+            tick_types.clear();
+
+            // Keep frames in time order (clock may step back between appends)
+            time_ms = base_ms + (qint64) (tick * rate_ms);
+            if (!frames.isEmpty()) time_ms = qMax(time_ms, frames.last().time_ms);
+            frames.append(Log_Replay_Frame{.time_ms=time_ms, .rows={}});
+        }
+        tick_types.append(row.pinType);
+        frames.last().rows.append(row);
+    }
+
+    return !frames.isEmpty();
+}
+
+bool GUI_LOG_REPLAY::open_binary(QString filePath)
+{
+    if (!reader.open(filePath)) return false;
+
+    // Group columns by pin type (one row per group)
+    QList<Pin_Log_Column> columns = reader.get_columns();
+    int num_cols = columns.length();
+    for (int c = 0; c < num_cols; c++)
+    {
+        if ((c == 0) || (columns.at(c).pinType != columns.at(c-1).pinType))
+        {
+            bin_rows.append(Log_Replay_Row{.pinType=columns.at(c).pinType, .pin_nums={}, .values={}});
+            bin_row_cols.append(c);
+        }
+        bin_rows.last().pin_nums.append(columns.at(c).pin_num);
+    }
+    return true;
+}
+
+qint64 GUI_LOG_REPLAY::get_frame_time(quint64 i)
+{
+    return binary ? reader.get_time(i) : frames.at(i).time_ms;
+}
+
+void GUI_LOG_REPLAY::get_frame(quint64 i, Log_Replay_Frame *frame)
+{
+    // Text frames are already parsed
+    if (!binary)
+    {
+        *frame = frames.at(i);
+        return;
+    }
+
+    // Fill each row from record columns
+    frame->time_ms = reader.get_time(i);
+    frame->rows = bin_rows;
+    int num_vals;
+    for (int r = 0; r < bin_rows.length(); r++)
+    {
+        Log_Replay_Row &row = frame->rows[r];
+        num_vals = row.pin_nums.length();
+        row.values.resize(num_vals);
+        for (int v = 0; v < num_vals; v++)
+        {
+            row.values[v] = reader.get_value(i, bin_row_cols.at(r) + v);
+        }
+    }
+}
+
+quint64 GUI_LOG_REPLAY::find_frame(qint64 time_ms)
+{
+    // Binary logs search with their index
+    if (binary) return reader.find_record(time_ms);
+
+    // Text frames are in time order
+    quint64 lo = 0, hi = frames.length(), mid;
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (frames.at(mid).time_ms < time_ms) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+void GUI_LOG_REPLAY::replay_frame(quint64 i)
+{
+    // Emit each row of frame
+    Log_Replay_Frame frame;
+    get_frame(i, &frame);
+    foreach (Log_Replay_Row row, frame.rows)
+    {
+        emit replay_values(row.pinType, row.pin_nums, row.values, frame.time_ms);
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef GUI_LOG_REPLAY_H
+#define GUI_LOG_REPLAY_H
+
+// Base object include
+#include <QObject>
+
+// Required object includes
+#include <QList>
+#include <QTimer>
+#include <QVector>
+#include <QElapsedTimer>
+
+// Local object includes
+#include "gui-pin-log.hpp"
+
+// Replay settings
+#define GUI_LOG_REPLAY_TICK_MS 10           // Clock update period
+#define GUI_LOG_REPLAY_BATCH_FRAMES 4096    // Most frames replayed per update
+#define GUI_LOG_REPLAY_DEFAULT_RATE_MS 1000 // Text row period if start line has none
+
+// Values of one pin type
+typedef struct {
+    uint8_t pinType;
+    QList<uint8_t> pin_nums;    // Empty if values are in pin position order
+    QVector<float> values;
+} Log_Replay_Row;
+
+// Rows logged at the same time
+typedef struct {
+    qint64 time_ms;
+    QList<Log_Replay_Row> rows;
+} Log_Replay_Frame;
+
+// Replays a text or binary pin log on a virtual clock
+// Clock runs at speed log ms per wall ms (0 replays as fast as possible)
+// & never skips frames (falls behind if a batch fills instead)
+class GUI_LOG_REPLAY : public QObject
+{
+    Q_OBJECT
+
+public:
+    GUI_LOG_REPLAY(QObject *parent = 0);
+    ~GUI_LOG_REPLAY();
+
+    // Load log (text rows of other pin types are skipped)
+    bool open(QString filePath, QList<uint8_t> pinTypes);
+    bool is_open();
+    void close();
+
+    // Log span
+    quint64 get_num_frames();
+    qint64 get_start_ms();
+    qint64 get_end_ms();
+
+    // Clock state
+    qint64 get_time_ms();
+    bool is_running();
+
+signals:
+    // Replayed values (log time of frame)
+    void replay_values(uint8_t pinType, QList<uint8_t> pin_nums,
+                       QVector<float> values, qint64 time_ms);
+
+    // Emitted after each batch of frames & once the log ends
+    void replay_tick(qint64 time_ms);
+    void replay_done();
+
+public slots:
+    // Run, hold or move clock
+    void start(double new_speed = 1.0);
+    void pause();
+    void seek(qint64 time_ms);
+    void stop();
+
+private slots:
+    void advance();
+
+private:
+    // Clock variables
+    QTimer replayTimer;
+    QElapsedTimer wallTimer;
+    double speed;
+    double clock_ms;
+    quint64 next_frame;
+
+    // Text log (parsed on open)
+    bool binary;
+    QVector<Log_Replay_Frame> frames;
+
+    // Binary log (rows built from record columns)
+    GUI_PIN_LOG_READER reader;
+    QList<Log_Replay_Row> bin_rows;
+    QList<int> bin_row_cols;
+
+    // Log helpers
+    bool open_text(QString filePath, QList<uint8_t> pinTypes);
+    bool open_binary(QString filePath);
+    qint64 get_frame_time(quint64 i);
+    void get_frame(quint64 i, Log_Replay_Frame *frame);
+    quint64 find_frame(qint64 time_ms);
+    void replay_frame(quint64 i);
+};
+
+#endif // GUI_LOG_REPLAY_H
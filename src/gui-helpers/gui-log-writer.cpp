@@ -0,0 +1,404 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-log-writer.hpp"
+
+#include <climits>
+#include <QtEndian>
+#include <QDateTime>
+#include <QFileInfo>
+#include <QDir>
+
+GUI_LOG_WRITER::GUI_LOG_WRITER(QObject *parent) :
+    QThread(parent)
+{
+    // Set writer variables
+    settings = Log_Writer_Settings_DEFAULT;
+    next_settings = settings;
+    stopping = false;
+    dropped = 0;
+    log_open = false;
+    binary = false;
+    failed = false;
+    segment_num = 0;
+    segment_start_ms = 0;
+    last_flush_ms = 0;
+}
+
+GUI_LOG_WRITER::~GUI_LOG_WRITER()
+{
+    close();
+}
+
+void GUI_LOG_WRITER::set_settings(Log_Writer_Settings new_settings)
+{
+    // Running worker keeps its settings until next open
+    next_settings = new_settings;
+    if (!next_settings.queue_rows) next_settings.queue_rows = 1;
+}
+
+bool GUI_LOG_WRITER::open_text(QString filePath, bool append, QString header)
+{
+    // Close any open log & apply settings
+    close();
+    settings = next_settings;
+
+    // Set text log info
+    binary = false;
+    text_header = header;
+    base_path = filePath;
+
+    // Open first segment
+    segment_num = 0;
+    segments.clear();
+    dropped = 0;
+    failed = false;
+    if (!open_segment(append)) return false;
+
+    // Start worker
+    start_worker();
+    return true;
+}
+
+bool GUI_LOG_WRITER::open_binary(QString filePath, QList<Pin_Log_Column> columns)
+{
+    // Close any open log & apply settings
+    close();
+    settings = next_settings;
+
+    // Set binary log info
+    binary = true;
+    log_columns = columns;
+    base_path = filePath;
+
+    // Open first segment (binary logs are never appended to)
+    segment_num = 0;
+    segments.clear();
+    dropped = 0;
+    failed = false;
+    if (!open_segment(false)) return false;
+
+    // Start worker
+    start_worker();
+    return true;
+}
+
+bool GUI_LOG_WRITER::is_open()
+{
+    return log_open;
+}
+
+bool GUI_LOG_WRITER::is_binary()
+{
+    return binary;
+}
+
+bool GUI_LOG_WRITER::write_text(QString text)
+{
+    if (!log_open || binary) return false;
+    return queue_row(Log_Row{.time_ms=QDateTime::currentMSecsSinceEpoch(), .text=text, .values=QVector<float>()});
+}
+
+bool GUI_LOG_WRITER::write_record(qint64 time_ms, QVector<float> values)
+{
+    if (!log_open || !binary) return false;
+
+    // Stop log if pins changed since open (rows so far are kept)
+    if (values.length() != log_columns.length())
+    {
+        emit write_error("Error: Pins changed while logging, log stopped!");
+        stop();
+        return false;
+    }
+    return queue_row(Log_Row{.time_ms=time_ms, .text=QString(), .values=values});
+}
+
+void GUI_LOG_WRITER::stop()
+{
+    if (!log_open) return;
+    log_open = false;
+
+    // Stop worker (writes all queued rows, then closes last segment)
+    queueLock.lock();
+    stopping = true;
+    queueReady.wakeAll();
+    queueLock.unlock();
+
+    // Unthreaded logs start worker only to close last segment
+    if (!settings.threaded) start();
+}
+
+void GUI_LOG_WRITER::close()
+{
+    // Stop & wait for last segment
+    stop();
+    wait();
+}
+
+QStringList GUI_LOG_WRITER::get_segments()
+{
+    return segments;
+}
+
+quint64 GUI_LOG_WRITER::get_dropped()
+{
+    QMutexLocker locker(&queueLock);
+    return dropped;
+}
+
+bool GUI_LOG_WRITER::compress_file(QString srcPath, QString dstPath)
+{
+    // Open files
+    QFile srcFile(srcPath), dstFile(dstPath);
+    if (!srcFile.open(QIODevice::ReadOnly)) return false;
+    if (!dstFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) return false;
+
+    // Write magic then each compressed block
+    bool success = (dstFile.write(GUI_LOG_WRITER_QZ_MAGIC) == 8);
+    QByteArray block;
+    uchar block_len[4];
+    while (success && !srcFile.atEnd())
+    {
+        block = qCompress(srcFile.read(GUI_LOG_WRITER_QZ_BLOCK_LEN));
+        qToLittleEndian<quint32>(block.length(), block_len);
+        success = (dstFile.write((const char*) block_len, 4) == 4)
+                && (dstFile.write(block) == block.length());
+    }
+
+    // Close & remove partial output on failure
+    success = success && dstFile.flush();
+    dstFile.close();
+    if (!success) dstFile.remove();
+    return success;
+}
+
+QByteArray GUI_LOG_WRITER::decompress_data(QByteArray data)
+{
+    // Verify magic
+    if (!data.startsWith(GUI_LOG_WRITER_QZ_MAGIC)) return QByteArray();
+
+    // Unpack each block (stops at first bad block)
+    QByteArray unpacked, block;
+    int pos = 8;
+    quint32 block_len;
+    while ((pos + 4) <= data.length())
+    {
+        block_len = qFromLittleEndian<quint32>((const uchar*) data.constData() + pos);
+        pos += 4;
+        if ((quint32) (data.length() - pos) < block_len) break;
+        block = qUncompress((const uchar*) data.constData() + pos, block_len);
+        if (block.isEmpty()) break;
+        unpacked.append(block);
+        pos += block_len;
+    }
+    return unpacked;
+}
+
+void GUI_LOG_WRITER::run()
+{
+    QList<Log_Row> rows;
+    bool stop = false;
+    while (!stop)
+    {
+        // Wait for rows or until held rows are due
+        queueLock.lock();
+        if (queue.isEmpty() && !stopping)
+            queueReady.wait(&queueLock, settings.flush_ms ? settings.flush_ms : ULONG_MAX);
+        rows.swap(queue);
+        stop = stopping;
+        queueLock.unlock();
+
+        // Write rows
+        foreach (const Log_Row &row, rows) write_row(row);
+        rows.clear();
+
+        // Write held rows if due (every pass if no flush time)
+        if (settings.flush_ms <= (QDateTime::currentMSecsSinceEpoch() - last_flush_ms))
+        {
+            flush_segment();
+        }
+    }
+
+    // Close & compress last segment (keeps caller responsive)
+    close_segment();
+}
+
+void GUI_LOG_WRITER::start_worker()
+{
+    // Start worker (unthreaded logs are written on call)
+    log_open = true;
+    stopping = false;
+    if (settings.threaded) start();
+}
+
+bool GUI_LOG_WRITER::open_segment(bool append)
+{
+    // Set segment info
+    segment_path = get_segment_path(segment_num);
+    segment_start_ms = QDateTime::currentMSecsSinceEpoch();
+    last_flush_ms = segment_start_ms;
+
+    // Open binary segment
+    if (binary) return binLog.open(segment_path, log_columns, segment_start_ms);
+
+    // Open text segment & write header
+    textFile.setFileName(segment_path);
+    if (!textFile.open(QIODevice::WriteOnly | (append ? QIODevice::Append : QIODevice::Truncate)))
+        return false;
+    textBuffer = text_header.toUtf8();
+    return flush_segment();
+}
+
+void GUI_LOG_WRITER::write_row(const Log_Row &row)
+{
+    if (failed) return;
+
+    // Start new segment if current one is full or too old
+    qint64 segment_size = binary ? binLog.get_size() : (textFile.size() + textBuffer.length());
+    if ((settings.rotate_bytes && (settings.rotate_bytes <= (quint64) segment_size))
+            || (settings.rotate_secs && (((qint64) settings.rotate_secs * 1000) <= (row.time_ms - segment_start_ms))))
+    {
+        close_segment();
+        segment_num += 1;
+        if (!open_segment(false))
+        {
+            set_failed("Error: Couldn't open log segment!");
+            return;
+        }
+    }
+
+    // Hold row
+    if (binary)
+    {
+        if (!binLog.append(row.time_ms, row.values))
+        {
+            set_failed("Error: Couldn't write log file!");
+            return;
+        }
+    } else
+    {
+        textBuffer.append(row.text.toUtf8());
+    }
+
+    // Write if buffer full, otherwise if not threaded write text rows
+    // now & binary rows once due (each write rewrites the footer)
+    qint64 held = binary ? binLog.get_held() : textBuffer.length();
+    bool due = (settings.buffer_bytes <= held);
+    if (!settings.threaded)
+    {
+        due = due || !binary
+                || (settings.flush_ms <= (QDateTime::currentMSecsSinceEpoch() - last_flush_ms));
+    }
+    if (due)
+    {
+        if (!flush_segment()) set_failed("Error: Couldn't write log file!");
+    }
+}
+
+bool GUI_LOG_WRITER::flush_segment()
+{
+    // Write held rows
+    last_flush_ms = QDateTime::currentMSecsSinceEpoch();
+    if (binary) return binLog.flush();
+    if (!textFile.isOpen()) return false;
+    if (textBuffer.isEmpty()) return true;
+    bool success = (textFile.write(textBuffer) == textBuffer.length()) && textFile.flush();
+    textBuffer.clear();
+    return success;
+}
+
+void GUI_LOG_WRITER::close_segment()
+{
+    // Write & close segment
+    if (binary)
+    {
+        if (!binLog.is_open()) return;
+        binLog.close();
+    } else
+    {
+        if (!textFile.isOpen()) return;
+        flush_segment();
+        textFile.close();
+    }
+
+    // Compress completed segment
+    QString done_path = segment_path;
+    if (settings.compress)
+    {
+        if (compress_file(segment_path, segment_path + GUI_LOG_WRITER_QZ_SUFFIX))
+        {
+            QFile::remove(segment_path);
+            done_path += GUI_LOG_WRITER_QZ_SUFFIX;
+        } else
+        {
+            emit write_error("Error: Couldn't compress log segment!");
+        }
+    }
+    segments.append(done_path);
+
+    // Export CSV copy (reader unpacks compressed segments)
+    if (binary && settings.export_csv)
+    {
+        GUI_PIN_LOG_READER reader;
+        if (!reader.open(done_path) || !reader.export_csv(done_path + ".csv"))
+            emit write_error("Error: Couldn't export log to CSV!");
+    }
+}
+
+QString GUI_LOG_WRITER::get_segment_path(int num)
+{
+    // First segment uses given path
+    if (num == 0) return base_path;
+
+    // Insert segment number before suffix
+    QFileInfo info(base_path);
+    QString name = info.completeBaseName() + "_" + QString::number(num);
+    if (!info.suffix().isEmpty()) name += "." + info.suffix();
+    return info.dir().filePath(name);
+}
+
+bool GUI_LOG_WRITER::queue_row(const Log_Row &row)
+{
+    // Write directly if not threaded
+    if (!settings.threaded)
+    {
+        write_row(row);
+        return !failed;
+    }
+
+    // Add to queue (drop if full, never block caller)
+    QMutexLocker locker(&queueLock);
+    if (failed || (settings.queue_rows <= (uint32_t) queue.length()))
+    {
+        dropped += 1;
+        return false;
+    }
+    queue.append(row);
+    queueReady.wakeOne();
+    return true;
+}
+
+void GUI_LOG_WRITER::set_failed(QString msg)
+{
+    // Stop writing & report once
+    queueLock.lock();
+    bool prev_failed = failed;
+    failed = true;
+    queueLock.unlock();
+    if (!prev_failed) emit write_error(msg);
+}
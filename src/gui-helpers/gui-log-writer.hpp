@@ -0,0 +1,149 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_LOG_WRITER_H
+#define GUI_LOG_WRITER_H
+
+// Base object include
+#include <QThread>
+
+// Required object includes
+#include <QFile>
+#include <QList>
+#include <QMutex>
+#include <QVector>
+#include <QWaitCondition>
+
+// Local object includes
+#include "gui-pin-log.hpp"
+
+// Compressed segment layout:
+//  [magic(8), (block_len(4), qCompress block) per block...]
+#define GUI_LOG_WRITER_QZ_MAGIC QByteArray("UCLOGQZ1")
+#define GUI_LOG_WRITER_QZ_SUFFIX ".qz"
+#define GUI_LOG_WRITER_QZ_BLOCK_LEN (1 << 20)
+
+// Writer settings
+typedef struct {
+    bool threaded;          // Write from worker thread (otherwise written on call)
+    uint32_t queue_rows;    // Rows queued before new rows are dropped
+    uint32_t buffer_bytes;  // Bytes held before each write
+    uint32_t flush_ms;      // Longest a row is held before being written
+    quint64 rotate_bytes;   // Start new segment after this size (0 = never)
+    uint32_t rotate_secs;   // Start new segment after this time (0 = never)
+    bool compress;          // Compress each completed segment
+    bool export_csv;        // Export CSV copy of each completed binary segment
+} Log_Writer_Settings;
+#define Log_Writer_Settings_DEFAULT Log_Writer_Settings{\
+    .threaded=false, .queue_rows=65536, .buffer_bytes=262144,\
+    .flush_ms=1000, .rotate_bytes=0, .rotate_secs=0, .compress=false,\
+    .export_csv=false}
+
+// Text or binary log split into segments (segment 0 is the given path,
+// others insert "_<num>" before the suffix)
+class GUI_LOG_WRITER : public QThread
+{
+    Q_OBJECT
+
+public:
+    GUI_LOG_WRITER(QObject *parent = 0);
+    ~GUI_LOG_WRITER();
+
+    // Settings (applied on next open)
+    void set_settings(Log_Writer_Settings new_settings);
+
+    // Open first segment & start writer (header starts each text segment)
+    bool open_text(QString filePath, bool append, QString header);
+    bool open_binary(QString filePath, QList<Pin_Log_Column> columns);
+    bool is_open();
+    bool is_binary();
+
+    // Queue a row (false if dropped: not open, other format or queue full)
+    // Binary records not matching the columns stop the log
+    bool write_text(QString text);
+    bool write_record(qint64 time_ms, QVector<float> values);
+
+    // Write queued rows, close & compress last segment from the worker
+    // (stop returns right away, close waits for the worker to finish)
+    void stop();
+    void close();
+
+    // Completed segment paths of last log & rows dropped
+    QStringList get_segments();
+    quint64 get_dropped();
+
+    // Segment codec (qCompress blocks)
+    static bool compress_file(QString srcPath, QString dstPath);
+    static QByteArray decompress_data(QByteArray data);
+
+signals:
+    void write_error(QString msg);
+
+protected:
+    virtual void run();
+
+private:
+    // Queued row
+    typedef struct {
+        qint64 time_ms;
+        QString text;
+        QVector<float> values;
+    } Log_Row;
+
+    Log_Writer_Settings settings;
+    Log_Writer_Settings next_settings;
+
+    // Queue (shared with worker)
+    QMutex queueLock;
+    QWaitCondition queueReady;
+    QList<Log_Row> queue;
+    bool stopping;
+    quint64 dropped;
+
+    // Log state (worker only while running)
+    bool log_open;
+    bool binary;
+    bool failed;
+    QString base_path;
+    int segment_num;
+    QString segment_path;
+    qint64 segment_start_ms;
+    qint64 last_flush_ms;
+    QStringList segments;
+
+    // Text segment
+    QString text_header;
+    QFile textFile;
+    QByteArray textBuffer;
+
+    // Binary segment
+    QList<Pin_Log_Column> log_columns;
+    GUI_PIN_LOG_WRITER binLog;
+
+    // Segment helpers
+    void start_worker();
+    bool open_segment(bool append);
+    void write_row(const Log_Row &row);
+    bool flush_segment();
+    void close_segment();
+    QString get_segment_path(int num);
+    bool queue_row(const Log_Row &row);
+    void set_failed(QString msg);
+};
+
+#endif // GUI_LOG_WRITER_H
@@ -0,0 +1,253 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-pin-history.hpp"
+
+#include <QtGlobal>
+
+GUI_PIN_HISTORY::GUI_PIN_HISTORY() :
+    settings(Pin_History_Settings_DEFAULT)
+{
+    /* DO NOTHING */
+}
+
+GUI_PIN_HISTORY::~GUI_PIN_HISTORY()
+{
+    /* DO NOTHING */
+}
+
+void GUI_PIN_HISTORY::set_settings(Pin_History_Settings new_settings)
+{
+    // Keep sizes sane (factor must merge at least two entries)
+    settings = new_settings;
+    settings.samples = qMax<uint32_t>(settings.samples, 1);
+    settings.factor = qMax<uint32_t>(settings.factor, 2);
+    settings.buckets = qMax<uint32_t>(settings.buckets, 1);
+}
+
+Pin_History_Settings GUI_PIN_HISTORY::get_settings()
+{
+    return settings;
+}
+
+void GUI_PIN_HISTORY::clear()
+{
+    histories.clear();
+}
+
+void GUI_PIN_HISTORY::set_pins(uint8_t pinType, int num_pins)
+{
+    // Build empty histories
+    QVector<Pin_History> pin_histories(qMax(num_pins, 0));
+    for (Pin_History &history : pin_histories)
+    {
+        history.raw.reset(settings.samples);
+        history.tiers.resize(settings.tiers);
+        for (HISTORY_RING<Pin_Bucket> &tier : history.tiers)
+        {
+            tier.reset(settings.buckets);
+        }
+        history.partial.resize(settings.tiers);
+        history.partial_count.fill(0, settings.tiers);
+        history.appended = 0;
+    }
+
+    // Replace old histories
+    histories.insert(pinType, pin_histories);
+}
+
+void GUI_PIN_HISTORY::append(uint8_t pinType, int pos, qint64 t, double v)
+{
+    // Get & verify history
+    Pin_History *history = get_history(pinType, pos);
+    if (!history) return;
+
+    // Add raw sample
+    history->raw.append(Pin_Sample{.t=t, .v=v});
+    history->appended += 1;
+
+    // Feed summary tiers
+    if (!history->tiers.isEmpty())
+    {
+        add_to_tier(history, 0, Pin_Bucket{.t_start=t, .t_end=t, .min=v, .max=v});
+    }
+}
+
+QVector<Pin_Sample> GUI_PIN_HISTORY::get_samples(uint8_t pinType, int pos, qint64 t_start, qint64 t_end)
+{
+    // Get & verify history
+    QVector<Pin_Sample> samples;
+    Pin_History *history = get_history(pinType, pos);
+    if (!history || (t_end < t_start)) return samples;
+
+    // Copy samples in window
+    int last = upper_index(history->raw, t_end);
+    for (int i = lower_index(history->raw, t_start); i < last; i++)
+    {
+        samples.append(history->raw.at(i));
+    }
+    return samples;
+}
+
+quint64 GUI_PIN_HISTORY::get_num_appended(uint8_t pinType, int pos)
+{
+    Pin_History *history = get_history(pinType, pos);
+    return history ? history->appended : 0;
+}
+
+QVector<Pin_Sample> GUI_PIN_HISTORY::get_newest(uint8_t pinType, int pos, int num_samples)
+{
+    // Get & verify history
+    QVector<Pin_Sample> samples;
+    Pin_History *history = get_history(pinType, pos);
+    if (!history) return samples;
+
+    // Copy newest samples (oldest first)
+    int num_raw = history->raw.length();
+    int first = num_raw - qBound(0, num_samples, num_raw);
+    samples.reserve(num_raw - first);
+    for (int i = first; i < num_raw; i++)
+    {
+        samples.append(history->raw.at(i));
+    }
+    return samples;
+}
+
+QVector<Pin_Bucket> GUI_PIN_HISTORY::get_range(uint8_t pinType, int pos, qint64 t_start,
+                                               qint64 t_end, int max_points)
+{
+    // Get & verify history
+    QVector<Pin_Bucket> buckets;
+    Pin_History *history = get_history(pinType, pos);
+    if (!history || (t_end < t_start) || (max_points <= 0)) return buckets;
+
+    // Use raw samples if they fit and reach back far enough
+    // (or if there are no tiers to fall back on)
+    const HISTORY_RING<Pin_Sample> &raw = history->raw;
+    int first = lower_index(raw, t_start);
+    int last = upper_index(raw, t_end);
+    int num_tiers = history->tiers.length();
+    bool covers = (raw.length() == 0) || (raw.at(0).t <= t_start);
+    if ((((last - first) <= max_points) && covers) || (num_tiers == 0))
+    {
+        // Skip oldest samples if too many
+        first = qMax(first, last - max_points);
+        for (int i = first; i < last; i++)
+        {
+            const Pin_Sample &s = raw.at(i);
+            buckets.append(Pin_Bucket{.t_start=s.t, .t_end=s.t, .min=s.v, .max=s.v});
+        }
+        return buckets;
+    }
+
+    // Find finest tier that fits
+    int tier_num;
+    for (tier_num = 0; tier_num < num_tiers; tier_num++)
+    {
+        const HISTORY_RING<Pin_Bucket> &tier = history->tiers.at(tier_num);
+        first = lower_index(tier, t_start);
+        last = upper_index(tier, t_end);
+        covers = (tier.length() == 0) || (tier.at(0).t_start <= t_start);
+        if (((last - first) < max_points) && covers) break;
+    }
+    tier_num = qMin(tier_num, num_tiers - 1);
+
+    // Copy buckets (leaving room for partial bucket)
+    const HISTORY_RING<Pin_Bucket> &tier = history->tiers.at(tier_num);
+    first = lower_index(tier, t_start);
+    last = upper_index(tier, t_end);
+    first = qMax(first, last - (max_points - 1));
+    for (int i = first; i < last; i++)
+    {
+        buckets.append(tier.at(i));
+    }
+
+    // Add partial bucket (newest data not yet summarised)
+    if (history->partial_count.at(tier_num)
+            && (history->partial.at(tier_num).t_start <= t_end))
+    {
+        buckets.append(history->partial.at(tier_num));
+    }
+    return buckets;
+}
+
+GUI_PIN_HISTORY::Pin_History *GUI_PIN_HISTORY::get_history(uint8_t pinType, int pos)
+{
+    // Find history & verify position
+    QMap<uint8_t, QVector<Pin_History>>::iterator pin_histories = histories.find(pinType);
+    if ((pin_histories == histories.end()) || (pos < 0) || (pin_histories.value().length() <= pos))
+        return nullptr;
+    return &pin_histories.value()[pos];
+}
+
+void GUI_PIN_HISTORY::add_to_tier(Pin_History *history, int tier, const Pin_Bucket &bucket)
+{
+    // Merge into partial bucket
+    Pin_Bucket &partial = history->partial[tier];
+    uint32_t &count = history->partial_count[tier];
+    if (count == 0)
+    {
+        partial = bucket;
+    } else
+    {
+        partial.t_end = bucket.t_end;
+        partial.min = qMin(partial.min, bucket.min);
+        partial.max = qMax(partial.max, bucket.max);
+    }
+    count += 1;
+
+    // Keep building until full
+    if (count < settings.factor) return;
+
+    // Store full bucket & propogate to next tier
+    Pin_Bucket full = partial;
+    count = 0;
+    history->tiers[tier].append(full);
+    if ((tier + 1) < history->tiers.length())
+    {
+        add_to_tier(history, tier + 1, full);
+    }
+}
+
+template <typename T>
+int GUI_PIN_HISTORY::lower_index(const HISTORY_RING<T> &ring, qint64 t)
+{
+    // First entry ending at or after t
+    int low = 0, high = ring.length(), mid;
+    while (low < high)
+    {
+        mid = (low + high) / 2;
+        if (get_end(ring.at(mid)) < t) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+template <typename T>
+int GUI_PIN_HISTORY::upper_index(const HISTORY_RING<T> &ring, qint64 t)
+{
+    // First entry starting after t
+    int low = 0, high = ring.length(), mid;
+    while (low < high)
+    {
+        mid = (low + high) / 2;
+        if (get_start(ring.at(mid)) <= t) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
@@ -0,0 +1,170 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_PIN_HISTORY_H
+#define GUI_PIN_HISTORY_H
+
+#include <QMap>
+#include <QVector>
+
+// Single pin sample
+typedef struct {
+    qint64 t;       // Sample time (ms since epoch)
+    double v;       // Scaled value
+} Pin_Sample;
+
+// Min/max summary of consecutive samples
+typedef struct {
+    qint64 t_start; // First sample time
+    qint64 t_end;   // Last sample time
+    double min;
+    double max;
+} Pin_Bucket;
+
+// History sizing (memory per pin is roughly
+// samples*16 + tiers*buckets*32 bytes)
+typedef struct {
+    uint32_t samples;   // Raw samples kept per pin
+    uint32_t factor;    // Entries merged into each summary bucket
+    uint32_t tiers;     // Number of summary tiers
+    uint32_t buckets;   // Buckets kept per tier
+} Pin_History_Settings;
+#define Pin_History_Settings_DEFAULT Pin_History_Settings{\
+    .samples=4096, .factor=16, .tiers=3, .buckets=1024}
+
+// Fixed size ring (oldest entry at 0, overwrites when full)
+template <typename T>
+class HISTORY_RING
+{
+public:
+    HISTORY_RING() : head(0), count(0) {}
+
+    void reset(int capacity)
+    {
+        data.fill(T(), capacity);
+        head = 0;
+        count = 0;
+    }
+
+    void append(const T &item)
+    {
+        if (data.isEmpty()) return;
+        data[head] = item;
+        head = (head + 1) % data.length();
+        if (count < data.length()) count++;
+    }
+
+    // Keep newest entries that fit new capacity
+    void resize(int capacity)
+    {
+        QVector<T> kept;
+        int num_kept = qMin(count, capacity);
+        kept.reserve(capacity);
+        for (int i = count - num_kept; i < count; i++) kept.append(at(i));
+        kept.resize(capacity);
+        data = kept;
+        head = (capacity == 0) ? 0 : (num_kept % capacity);
+        count = num_kept;
+    }
+
+    void drop_oldest()
+    {
+        if (count) count--;
+    }
+
+    void drop_newest()
+    {
+        if (!count) return;
+        head = (head - 1 + data.length()) % data.length();
+        count--;
+    }
+
+    void clear()
+    {
+        head = 0;
+        count = 0;
+    }
+
+    int length() const { return count; }
+    int capacity() const { return data.length(); }
+    const T &at(int i) const { return data.at((head - count + i + data.length()) % data.length()); }
+
+private:
+    QVector<T> data;
+    int head;
+    int count;
+};
+
+class GUI_PIN_HISTORY
+{
+public:
+    GUI_PIN_HISTORY();
+    ~GUI_PIN_HISTORY();
+
+    // Settings (applied on next set_pins)
+    void set_settings(Pin_History_Settings new_settings);
+    Pin_History_Settings get_settings();
+
+    // Layout (resets history for the pin type)
+    void clear();
+    void set_pins(uint8_t pinType, int num_pins);
+
+    // Add a sample (timestamps must not decrease)
+    void append(uint8_t pinType, int pos, qint64 t, double v);
+
+    // Raw samples in [t_start, t_end]
+    QVector<Pin_Sample> get_samples(uint8_t pinType, int pos, qint64 t_start, qint64 t_end);
+
+    // Samples appended since layout set & newest raw samples
+    // (lets readers fetch only samples added since their last read)
+    quint64 get_num_appended(uint8_t pinType, int pos);
+    QVector<Pin_Sample> get_newest(uint8_t pinType, int pos, int num_samples);
+
+    // At most max_points entries covering [t_start, t_end],
+    // taken from the finest tier that fits
+    // (raw samples are returned as buckets with min == max)
+    QVector<Pin_Bucket> get_range(uint8_t pinType, int pos, qint64 t_start,
+                                  qint64 t_end, int max_points);
+
+private:
+    typedef struct {
+        HISTORY_RING<Pin_Sample> raw;
+        QVector<HISTORY_RING<Pin_Bucket>> tiers;
+        QVector<Pin_Bucket> partial;        // Bucket being built per tier
+        QVector<uint32_t> partial_count;    // Entries merged into partial
+        quint64 appended;                   // Samples appended since set_pins
+    } Pin_History;
+
+    Pin_History_Settings settings;
+    QMap<uint8_t, QVector<Pin_History>> histories;
+
+    Pin_History *get_history(uint8_t pinType, int pos);
+    void add_to_tier(Pin_History *history, int tier, const Pin_Bucket &bucket);
+
+    // Index helpers ([first, last) of entries overlapping window)
+    template <typename T>
+    static int lower_index(const HISTORY_RING<T> &ring, qint64 t);
+    template <typename T>
+    static int upper_index(const HISTORY_RING<T> &ring, qint64 t);
+    static qint64 get_end(const Pin_Sample &s) { return s.t; }
+    static qint64 get_end(const Pin_Bucket &b) { return b.t_end; }
+    static qint64 get_start(const Pin_Sample &s) { return s.t; }
+    static qint64 get_start(const Pin_Bucket &b) { return b.t_start; }
+};
+
+#endif // GUI_PIN_HISTORY_H
@@ -0,0 +1,441 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-pin-log.hpp"
+#include "gui-log-writer.hpp"
+
+#include <cstring>
+#include <QtEndian>
+#include <QDateTime>
+#include <QTextStream>
+
+GUI_PIN_LOG_WRITER::GUI_PIN_LOG_WRITER()
+{
+    num_cols = 0;
+    stride = PIN_LOG_INDEX_STRIDE_DEFAULT;
+    num_records = 0;
+    records_end = 0;
+    last_ms = 0;
+}
+
+GUI_PIN_LOG_WRITER::~GUI_PIN_LOG_WRITER()
+{
+    close();
+}
+
+bool GUI_PIN_LOG_WRITER::open(QString filePath, QList<Pin_Log_Column> columns, qint64 start_ms,
+                              uint32_t index_stride)
+{
+    // Close any open log
+    close();
+
+    // Open file
+    logFile.setFileName(filePath);
+    if (!logFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) return false;
+
+    // Set record variables
+    num_cols = columns.length();
+    stride = index_stride ? index_stride : PIN_LOG_INDEX_STRIDE_DEFAULT;
+    num_records = 0;
+    last_ms = start_ms;
+    record.resize(8 + 4*num_cols);
+    pending.clear();
+    index.clear();
+
+    // Build header
+    QByteArray header(pin_log_cols_loc + (pin_log_col_len * num_cols), 0);
+    uchar *h = (uchar*) header.data();
+    memcpy(h + pin_log_magic_loc, PIN_LOG_MAGIC, 8);
+    qToLittleEndian<quint16>(PIN_LOG_VERSION, h + pin_log_version_loc);
+    qToLittleEndian<quint16>(num_cols, h + pin_log_num_cols_loc);
+    qToLittleEndian<quint32>(record.length(), h + pin_log_record_len_loc);
+    qToLittleEndian<quint32>(stride, h + pin_log_index_stride_loc);
+    qToLittleEndian<qint64>(start_ms, h + pin_log_start_ms_loc);
+
+    // Add columns
+    uchar *c;
+    quint32 div;
+    for (int i = 0; i < num_cols; i++)
+    {
+        const Pin_Log_Column &col = columns.at(i);
+        c = h + pin_log_cols_loc + (pin_log_col_len * i);
+        c[pin_log_col_pin_type_loc] = col.pinType;
+        c[pin_log_col_pin_num_loc] = col.pin_num;
+        c[pin_log_col_mode_loc] = col.mode;
+        qToLittleEndian<qint32>(col.range.min, c + pin_log_col_min_loc);
+        qToLittleEndian<qint32>(col.range.max, c + pin_log_col_max_loc);
+        qToLittleEndian<qint32>(col.range.step, c + pin_log_col_step_loc);
+        memcpy(&div, &col.range.div, 4);
+        qToLittleEndian<quint32>(div, c + pin_log_col_div_loc);
+    }
+
+    // Write header & empty footer
+    records_end = header.length();
+    if ((logFile.write(header) != header.length()) || !flush())
+    {
+        logFile.close();
+        return false;
+    }
+    return true;
+}
+
+bool GUI_PIN_LOG_WRITER::is_open()
+{
+    return logFile.isOpen();
+}
+
+bool GUI_PIN_LOG_WRITER::append(qint64 time_ms, const QVector<float> &values)
+{
+    // Verify open & record width
+    if (!logFile.isOpen() || (values.length() != num_cols)) return false;
+
+    // Keep times ascending (seeks rely on it)
+    if (time_ms < last_ms) time_ms = last_ms;
+    last_ms = time_ms;
+
+    // Add index entry every stride records
+    if ((num_records % stride) == 0) index.append(qMakePair(time_ms, num_records));
+
+    // Build & hold record
+    uchar *r = (uchar*) record.data();
+    quint32 bits;
+    qToLittleEndian<qint64>(time_ms, r);
+    for (int i = 0; i < num_cols; i++)
+    {
+        memcpy(&bits, &values.at(i), 4);
+        qToLittleEndian<quint32>(bits, r + 8 + 4*i);
+    }
+    pending.append(record);
+
+    num_records += 1;
+    return true;
+}
+
+bool GUI_PIN_LOG_WRITER::flush()
+{
+    if (!logFile.isOpen()) return false;
+
+    // Build footer
+    QByteArray footer(pin_log_footer_head_len + PIN_LOG_INDEX_ENTRY_LEN * index.length()
+                      + pin_log_footer_tail_len, 0);
+    uchar *f = (uchar*) footer.data();
+    memcpy(f + pin_log_footer_magic_loc, PIN_LOG_INDEX_MAGIC, 8);
+    qToLittleEndian<quint64>(num_records, f + pin_log_footer_num_records_loc);
+    qToLittleEndian<quint32>(index.length(), f + pin_log_footer_num_entries_loc);
+    f += pin_log_footer_index_loc;
+    for (int i = 0; i < index.length(); i++, f += PIN_LOG_INDEX_ENTRY_LEN)
+    {
+        qToLittleEndian<qint64>(index.at(i).first, f);
+        qToLittleEndian<quint64>(index.at(i).second, f + 8);
+    }
+    qToLittleEndian<qint64>(records_end + pending.length(), f);
+    memcpy(f + 8, PIN_LOG_INDEX_MAGIC, 8);
+
+    // Cut old footer, add held records then new footer
+    if (!logFile.resize(records_end) || !logFile.seek(records_end)
+            || (logFile.write(pending) != pending.length()))
+    {
+        return false;
+    }
+    records_end += pending.length();
+    pending.clear();
+    if (logFile.write(footer) != footer.length()) return false;
+    return logFile.flush();
+}
+
+qint64 GUI_PIN_LOG_WRITER::get_size()
+{
+    return records_end + pending.length() + pin_log_footer_head_len
+            + (PIN_LOG_INDEX_ENTRY_LEN * index.length()) + pin_log_footer_tail_len;
+}
+
+qint64 GUI_PIN_LOG_WRITER::get_held()
+{
+    return pending.length();
+}
+
+void GUI_PIN_LOG_WRITER::close()
+{
+    if (!logFile.isOpen()) return;
+
+    // Write final records & footer then close
+    flush();
+    logFile.close();
+    pending.clear();
+    index.clear();
+}
+
+GUI_PIN_LOG_READER::GUI_PIN_LOG_READER()
+{
+    map = nullptr;
+    map_len = 0;
+    start_ms = 0;
+    record_len = 0;
+    records_loc = 0;
+    num_records = 0;
+    index_loc = 0;
+    num_entries = 0;
+}
+
+GUI_PIN_LOG_READER::~GUI_PIN_LOG_READER()
+{
+    close();
+}
+
+bool GUI_PIN_LOG_READER::open(QString filePath)
+{
+    // Close any open log
+    close();
+
+    // Open file
+    logFile.setFileName(filePath);
+    if (!logFile.open(QIODevice::ReadOnly)) return false;
+
+    // Unpack compressed segments, otherwise map file
+    if (logFile.peek(8) == GUI_LOG_WRITER_QZ_MAGIC)
+    {
+        unpacked = GUI_LOG_WRITER::decompress_data(logFile.readAll());
+        logFile.close();
+        map_len = unpacked.length();
+        map = (map_len < pin_log_cols_loc) ? nullptr : (uchar*) unpacked.data();
+    } else
+    {
+        map_len = logFile.size();
+        if (pin_log_cols_loc <= map_len) map = logFile.map(0, map_len);
+    }
+    if (!map)
+    {
+        close();
+        return false;
+    }
+
+    // Verify header
+    uint16_t num_cols = qFromLittleEndian<quint16>(map + pin_log_num_cols_loc);
+    record_len = qFromLittleEndian<quint32>(map + pin_log_record_len_loc);
+    records_loc = pin_log_cols_loc + (pin_log_col_len * num_cols);
+    if ((memcmp(map + pin_log_magic_loc, PIN_LOG_MAGIC, 8) != 0)
+            || (qFromLittleEndian<quint16>(map + pin_log_version_loc) != PIN_LOG_VERSION)
+            || (record_len != (uint32_t) (8 + 4*num_cols))
+            || (map_len < records_loc))
+    {
+        close();
+        return false;
+    }
+    start_ms = qFromLittleEndian<qint64>(map + pin_log_start_ms_loc);
+
+    // Parse columns
+    const uchar *c;
+    quint32 div;
+    Pin_Log_Column col;
+    for (int i = 0; i < num_cols; i++)
+    {
+        c = map + pin_log_cols_loc + (pin_log_col_len * i);
+        col.pinType = c[pin_log_col_pin_type_loc];
+        col.pin_num = c[pin_log_col_pin_num_loc];
+        col.mode = c[pin_log_col_mode_loc];
+        col.range.min = qFromLittleEndian<qint32>(c + pin_log_col_min_loc);
+        col.range.max = qFromLittleEndian<qint32>(c + pin_log_col_max_loc);
+        col.range.step = qFromLittleEndian<qint32>(c + pin_log_col_step_loc);
+        div = qFromLittleEndian<quint32>(c + pin_log_col_div_loc);
+        memcpy(&col.range.div, &div, 4);
+        cols.append(col);
+    }
+
+    // Use footer if valid
+    qint64 footer_loc = -1;
+    const uchar *f = map + map_len - pin_log_footer_tail_len;
+    if (((records_loc + pin_log_footer_head_len + pin_log_footer_tail_len) <= map_len)
+            && (memcmp(f + 8, PIN_LOG_INDEX_MAGIC, 8) == 0))
+    {
+        footer_loc = qFromLittleEndian<qint64>(f);
+        if ((footer_loc < records_loc) || (map_len < (footer_loc + pin_log_footer_head_len))
+                || (((footer_loc - records_loc) % record_len) != 0)
+                || (memcmp(map + footer_loc + pin_log_footer_magic_loc, PIN_LOG_INDEX_MAGIC, 8) != 0))
+        {
+            footer_loc = -1;
+        }
+    }
+    if (0 <= footer_loc)
+    {
+        num_records = (footer_loc - records_loc) / record_len;
+        num_entries = qFromLittleEndian<quint32>(map + footer_loc + pin_log_footer_num_entries_loc);
+        index_loc = footer_loc + pin_log_footer_index_loc;
+
+        // Verify footer against file
+        if ((qFromLittleEndian<quint64>(map + footer_loc + pin_log_footer_num_records_loc) != num_records)
+                || ((index_loc + (qint64) num_entries * PIN_LOG_INDEX_ENTRY_LEN + pin_log_footer_tail_len) != map_len))
+        {
+            footer_loc = -1;
+        }
+    }
+
+    // Otherwise take all complete records (cut at a partial footer)
+    if (footer_loc < 0)
+    {
+        num_records = (map_len - records_loc) / record_len;
+        index_loc = 0;
+        num_entries = 0;
+
+        // Partial footer is at most one footer long
+        uint32_t stride = qMax<quint32>(1, qFromLittleEndian<quint32>(map + pin_log_index_stride_loc));
+        quint64 max_footer = pin_log_footer_head_len + pin_log_footer_tail_len
+                + PIN_LOG_INDEX_ENTRY_LEN * (num_records / stride + 1);
+        quint64 check_records = max_footer / record_len + 1;
+        for (quint64 i = (check_records < num_records) ? (num_records - check_records) : 0; i < num_records; i++)
+        {
+            if (memcmp(map + records_loc + i * record_len, PIN_LOG_INDEX_MAGIC, 8) == 0)
+            {
+                num_records = i;
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool GUI_PIN_LOG_READER::is_open()
+{
+    return (map != nullptr);
+}
+
+void GUI_PIN_LOG_READER::close()
+{
+    // Unmap & close file
+    if (map && unpacked.isEmpty()) logFile.unmap(map);
+    if (logFile.isOpen()) logFile.close();
+
+    // Reset variables
+    map = nullptr;
+    map_len = 0;
+    unpacked.clear();
+    cols.clear();
+    start_ms = 0;
+    record_len = 0;
+    records_loc = 0;
+    num_records = 0;
+    index_loc = 0;
+    num_entries = 0;
+}
+
+QList<Pin_Log_Column> GUI_PIN_LOG_READER::get_columns()
+{
+    return cols;
+}
+
+qint64 GUI_PIN_LOG_READER::get_start_ms()
+{
+    return start_ms;
+}
+
+quint64 GUI_PIN_LOG_READER::get_num_records()
+{
+    return num_records;
+}
+
+qint64 GUI_PIN_LOG_READER::get_time(quint64 i)
+{
+    const uchar *r = get_record(i);
+    return r ? qFromLittleEndian<qint64>(r) : -1;
+}
+
+float GUI_PIN_LOG_READER::get_value(quint64 i, int col)
+{
+    // Get & verify record
+    const uchar *r = get_record(i);
+    if (!r || (col < 0) || (cols.length() <= col)) return 0;
+
+    // Read value bits
+    quint32 bits = qFromLittleEndian<quint32>(r + 8 + 4*col);
+    float value;
+    memcpy(&value, &bits, 4);
+    return value;
+}
+
+quint64 GUI_PIN_LOG_READER::find_record(qint64 time_ms)
+{
+    // Narrow search with index (first entry at or after time_ms)
+    quint64 lo = 0, hi = num_records;
+    if (num_entries)
+    {
+        quint32 e_lo = 0, e_hi = num_entries, e_mid;
+        while (e_lo < e_hi)
+        {
+            e_mid = e_lo + ((e_hi - e_lo) >> 1);
+            if (qFromLittleEndian<qint64>(map + index_loc + (qint64) e_mid * PIN_LOG_INDEX_ENTRY_LEN) < time_ms)
+                e_lo = e_mid + 1;
+            else
+                e_hi = e_mid;
+        }
+
+        // Record is after previous entry & at or before found entry
+        if (0 < e_lo) lo = qFromLittleEndian<quint64>(map + index_loc + (qint64) (e_lo - 1) * PIN_LOG_INDEX_ENTRY_LEN + 8) + 1;
+        if (e_lo < num_entries) hi = qFromLittleEndian<quint64>(map + index_loc + (qint64) e_lo * PIN_LOG_INDEX_ENTRY_LEN + 8);
+    }
+
+    // Binary search records
+    quint64 mid;
+    while (lo < hi)
+    {
+        mid = lo + ((hi - lo) >> 1);
+        if (get_time(mid) < time_ms) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+bool GUI_PIN_LOG_READER::export_csv(QString filePath)
+{
+    if (!is_open()) return false;
+
+    // Open export file
+    QFile csvFile(filePath);
+    if (!csvFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) return false;
+    QTextStream csvStream(&csvFile);
+
+    // Same start line as text logs
+    csvStream << "Started: " << QDateTime::fromMSecsSinceEpoch(start_ms, Qt::UTC).toString() << " ";
+    csvStream << "exported from binary log\n";
+
+    // Write each record (columns are grouped by pin type)
+    int num_cols = cols.length();
+    for (quint64 i = 0; i < num_records; i++)
+    {
+        for (int c = 0; c < num_cols; c++)
+        {
+            if ((c == 0) || (cols.at(c).pinType != cols.at(c-1).pinType))
+            {
+                if (c != 0) csvStream << "\n";
+                csvStream << cols.at(c).pinType;
+            }
+            csvStream << "," << QString::number(get_value(i, c));
+        }
+        if (num_cols) csvStream << "\n";
+    }
+
+    // Flush & close
+    csvStream.flush();
+    csvFile.close();
+    return (csvStream.status() == QTextStream::Ok);
+}
+
+const uchar *GUI_PIN_LOG_READER::get_record(quint64 i)
+{
+    if (!map || (num_records <= i)) return nullptr;
+    return map + records_loc + i * record_len;
+}
@@ -0,0 +1,177 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_PIN_LOG_H
+#define GUI_PIN_LOG_H
+
+#include <QFile>
+#include <QList>
+#include <QVector>
+#include <QString>
+
+#include "gui-pin-store.hpp"
+
+/* Binary pin log layout (all values little endian)
+ *
+ * Header:
+ *  [magic(8), version(2), num_cols(2), record_len(4), index_stride(4),
+ *   start_ms(8), columns(num_cols * 20)]
+ *  Each column is [pinType(1), pin_num(1), mode(1), reserved(1),
+ *                  min(4), max(4), step(4), div(4, float)]
+ *
+ * Records (fixed width, one per logged row, time ascending):
+ *  [time_ms(8), value(4, float) per column]
+ *
+ * Footer (sparse time index, rewritten after every flush):
+ *  [index_magic(8), num_records(8), num_entries(4), reserved(4),
+ *   (time_ms(8), record(8)) every index_stride records...,
+ *   footer_loc(8), index_magic(8)]
+ *
+ * The file is cut back to the last record before each flush so a crash
+ * leaves complete records followed by at most a partial record or a
+ * partial footer. Files without a valid footer are read up to the last
+ * complete record (a partial footer starts with the magic at a record
+ * boundary & is dropped) & seeks then search the records.
+ */
+typedef enum {
+    pin_log_magic_loc = 0,
+    pin_log_version_loc = 8,
+    pin_log_num_cols_loc = 10,
+    pin_log_record_len_loc = 12,
+    pin_log_index_stride_loc = 16,
+    pin_log_start_ms_loc = 20,
+    pin_log_cols_loc = 28
+} Pin_Log_Header;
+
+typedef enum {
+    pin_log_col_pin_type_loc = 0,
+    pin_log_col_pin_num_loc = 1,
+    pin_log_col_mode_loc = 2,
+    pin_log_col_min_loc = 4,
+    pin_log_col_max_loc = 8,
+    pin_log_col_step_loc = 12,
+    pin_log_col_div_loc = 16,
+    pin_log_col_len = 20
+} Pin_Log_Column_Layout;
+
+typedef enum {
+    pin_log_footer_magic_loc = 0,
+    pin_log_footer_num_records_loc = 8,
+    pin_log_footer_num_entries_loc = 16,
+    pin_log_footer_index_loc = 24,
+    pin_log_footer_head_len = 24,
+    pin_log_footer_tail_len = 16
+} Pin_Log_Footer;
+
+#define PIN_LOG_MAGIC "UCPINLOG"
+#define PIN_LOG_INDEX_MAGIC "UCPINIDX"
+#define PIN_LOG_VERSION 2
+#define PIN_LOG_INDEX_STRIDE_DEFAULT 256
+#define PIN_LOG_INDEX_ENTRY_LEN 16
+
+// Logged pin (one record column)
+typedef struct {
+    uint8_t pinType;
+    uint8_t pin_num;
+    uint8_t mode;
+    RangeList range;
+} Pin_Log_Column;
+
+class GUI_PIN_LOG_WRITER
+{
+public:
+    GUI_PIN_LOG_WRITER();
+    ~GUI_PIN_LOG_WRITER();
+
+    // Create file & write header (truncates existing file)
+    bool open(QString filePath, QList<Pin_Log_Column> columns, qint64 start_ms,
+              uint32_t index_stride = PIN_LOG_INDEX_STRIDE_DEFAULT);
+    bool is_open();
+
+    // Append one record (values in column order, false if length mismatch)
+    // (records are held in memory until the next flush)
+    bool append(qint64 time_ms, const QVector<float> &values);
+
+    // Write held records & footer (file is readable after each flush)
+    bool flush();
+
+    // Size on disk after next flush & bytes held for it
+    qint64 get_size();
+    qint64 get_held();
+
+    // Flush then close
+    void close();
+
+private:
+    QFile logFile;
+    int num_cols;
+    uint32_t stride;
+    quint64 num_records;
+    qint64 records_end;
+    qint64 last_ms;
+    QByteArray record;
+    QByteArray pending;
+    QList<QPair<qint64, quint64>> index;
+};
+
+class GUI_PIN_LOG_READER
+{
+public:
+    GUI_PIN_LOG_READER();
+    ~GUI_PIN_LOG_READER();
+
+    // Map file & parse header/footer
+    // (compressed segments are unpacked into memory instead)
+    bool open(QString filePath);
+    bool is_open();
+    void close();
+
+    // Header info
+    QList<Pin_Log_Column> get_columns();
+    qint64 get_start_ms();
+
+    // Record access (i < get_num_records())
+    quint64 get_num_records();
+    qint64 get_time(quint64 i);
+    float get_value(quint64 i, int col);
+
+    // First record at or after time_ms (num records if none)
+    quint64 find_record(qint64 time_ms);
+
+    // Write records in the text log format
+    // (one "pinType,values..." line per pin type per record)
+    bool export_csv(QString filePath);
+
+private:
+    QFile logFile;
+    uchar *map;
+    qint64 map_len;
+    QByteArray unpacked;
+
+    QList<Pin_Log_Column> cols;
+    qint64 start_ms;
+    uint32_t record_len;
+    qint64 records_loc;
+    quint64 num_records;
+    qint64 index_loc;
+    quint32 num_entries;
+
+    const uchar *get_record(quint64 i);
+};
+
+#endif // GUI_PIN_LOG_H
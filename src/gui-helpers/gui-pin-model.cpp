@@ -0,0 +1,258 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-pin-model.hpp"
+
+#include <QTimer>
+#include <QComboBox>
+#include <QLineEdit>
+
+GUI_PIN_MODEL::GUI_PIN_MODEL(uint8_t pinType, GUI_PIN_STORE *store, QObject *parent) :
+    QAbstractTableModel(parent)
+{
+    // Set model variables
+    model_pinType = pinType;
+    pin_store = store;
+    changed_first = -1;
+    changed_last = -1;
+}
+
+GUI_PIN_MODEL::~GUI_PIN_MODEL()
+{
+    /* DO NOTHING */
+}
+
+void GUI_PIN_MODEL::set_pins(QList<QStringList> combos, QMap<QString, uint8_t> controls)
+{
+    beginResetModel();
+
+    // Set row combos
+    pin_combos = combos.toVector();
+
+    // Build mode to combo text map
+    mode_names.clear();
+    foreach (QString key, controls.keys())
+    {
+        mode_names.insert(controls.value(key), key);
+    }
+
+    // Drop pending changes (view reloads all rows)
+    changed_first = -1;
+    changed_last = -1;
+
+    endResetModel();
+}
+
+QString GUI_PIN_MODEL::get_combo(int pos, int index)
+{
+    if ((pos < 0) || (pin_combos.length() <= pos)) return QString();
+    return pin_combos.at(pos).value(index);
+}
+
+void GUI_PIN_MODEL::mark_changed(int pos)
+{
+    // Verify row
+    if ((pos < 0) || (pin_combos.length() <= pos)) return;
+
+    // Schedule flush on first change
+    if (changed_first < 0)
+    {
+        changed_first = pos;
+        changed_last = pos;
+        QTimer::singleShot(0, this, SLOT(flush_changes()));
+        return;
+    }
+
+    // Widen pending range
+    changed_first = qMin(changed_first, pos);
+    changed_last = qMax(changed_last, pos);
+}
+
+int GUI_PIN_MODEL::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : pin_combos.length();
+}
+
+int GUI_PIN_MODEL::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : pin_model_num_cols;
+}
+
+QVariant GUI_PIN_MODEL::data(const QModelIndex &index, int role) const
+{
+    // Get & verify table
+    const Pin_Table *table = pin_store->get_table(model_pinType);
+    if (!table || !index.isValid() || (table->pin_num.length() <= index.row())) return QVariant();
+    int pos = index.row();
+
+    switch (role)
+    {
+        case Qt::DisplayRole:
+        case Qt::EditRole:
+        {
+            switch (index.column())
+            {
+                case pin_model_pin_col:
+                    return QString("%1").arg(table->pin_num.at(pos), 2, 10, QChar('0'));
+                case pin_model_mode_col:
+                    return mode_names.value(table->mode.at(pos));
+                case pin_model_value_col:
+                    return QString::number(table->scaled.at(pos));
+            }
+            break;
+        }
+        case Qt::UserRole:
+        {
+            // Mode editor items
+            if ((index.column() == pin_model_mode_col) && (pos < pin_combos.length()))
+                return pin_combos.at(pos);
+            break;
+        }
+        case Qt::TextAlignmentRole:
+        {
+            // Match pin widget alignment
+            if (index.column() != pin_model_mode_col)
+                return (int) (Qt::AlignVCenter | Qt::AlignRight);
+            break;
+        }
+    }
+
+    return QVariant();
+}
+
+QVariant GUI_PIN_MODEL::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if ((orientation != Qt::Horizontal) || (role != Qt::DisplayRole)) return QVariant();
+
+    switch (section)
+    {
+        case pin_model_pin_col:
+            return QString("Pin");
+        case pin_model_mode_col:
+            return QString("Mode");
+        case pin_model_value_col:
+            return QString("Value");
+        default:
+            return QVariant();
+    }
+}
+
+Qt::ItemFlags GUI_PIN_MODEL::flags(const QModelIndex &index) const
+{
+    // Get & verify table
+    const Pin_Table *table = pin_store->get_table(model_pinType);
+    if (!table || !index.isValid() || (table->pin_num.length() <= index.row())) return Qt::NoItemFlags;
+
+    // Mode always editable, value only if not an input
+    Qt::ItemFlags item_flags = Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+    if ((index.column() == pin_model_mode_col)
+            || ((index.column() == pin_model_value_col) && !table->input.at(index.row())))
+    {
+        item_flags |= Qt::ItemIsEditable;
+    }
+    return item_flags;
+}
+
+bool GUI_PIN_MODEL::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+    // Only accept edits to editable cells
+    if ((role != Qt::EditRole) || !(flags(index) & Qt::ItemIsEditable)) return false;
+
+    // Pass to receiver (marks row changed once stored)
+    emit pin_edited(model_pinType, index.row(), index.column(), value);
+    return true;
+}
+
+void GUI_PIN_MODEL::flush_changes()
+{
+    // Verify pending range
+    if (changed_first < 0) return;
+
+    // Send range & clear
+    int first = changed_first, last = changed_last;
+    changed_first = -1;
+    changed_last = -1;
+    emit dataChanged(index(first, pin_model_mode_col), index(last, pin_model_value_col));
+}
+
+GUI_PIN_DELEGATE::GUI_PIN_DELEGATE(QObject *parent) :
+    QStyledItemDelegate(parent)
+{
+    /* DO NOTHING */
+}
+
+GUI_PIN_DELEGATE::~GUI_PIN_DELEGATE()
+{
+    /* DO NOTHING */
+}
+
+QWidget *GUI_PIN_DELEGATE::createEditor(QWidget *parent, const QStyleOptionViewItem &option,
+                                        const QModelIndex &index) const
+{
+    switch (index.column())
+    {
+        case pin_model_mode_col:
+        {
+            // Combo of the row modes
+            QComboBox *editor = new QComboBox(parent);
+            editor->addItems(index.data(Qt::UserRole).toStringList());
+            return editor;
+        }
+        case pin_model_value_col:
+        {
+            QLineEdit *editor = new QLineEdit(parent);
+            editor->setAlignment(Qt::AlignVCenter | Qt::AlignRight);
+            return editor;
+        }
+        default:
+            return QStyledItemDelegate::createEditor(parent, option, index);
+    }
+}
+
+void GUI_PIN_DELEGATE::setEditorData(QWidget *editor, const QModelIndex &index) const
+{
+    switch (index.column())
+    {
+        case pin_model_mode_col:
+            ((QComboBox*) editor)->setCurrentText(index.data(Qt::EditRole).toString());
+            break;
+        case pin_model_value_col:
+            ((QLineEdit*) editor)->setText(index.data(Qt::EditRole).toString());
+            break;
+        default:
+            QStyledItemDelegate::setEditorData(editor, index);
+            break;
+    }
+}
+
+void GUI_PIN_DELEGATE::setModelData(QWidget *editor, QAbstractItemModel *model,
+                                    const QModelIndex &index) const
+{
+    switch (index.column())
+    {
+        case pin_model_mode_col:
+            model->setData(index, ((QComboBox*) editor)->currentText());
+            break;
+        case pin_model_value_col:
+            model->setData(index, ((QLineEdit*) editor)->text());
+            break;
+        default:
+            QStyledItemDelegate::setModelData(editor, model, index);
+            break;
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_PIN_MODEL_H
+#define GUI_PIN_MODEL_H
+
+// Base object includes
+#include <QAbstractTableModel>
+#include <QStyledItemDelegate>
+
+// Required object includes
+#include <QMap>
+#include <QVector>
+#include <QStringList>
+
+// Local object includes
+#include "gui-pin-store.hpp"
+
+// Pin model columns
+typedef enum {
+    pin_model_pin_col = 0,
+    pin_model_mode_col,
+    pin_model_value_col,
+    pin_model_num_cols
+} pin_model_columns;
+
+// Table model over one pin type of a pin store
+// (rows are store positions, views only ask for visible rows)
+class GUI_PIN_MODEL : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    GUI_PIN_MODEL(uint8_t pinType, GUI_PIN_STORE *store, QObject *parent = 0);
+    ~GUI_PIN_MODEL();
+
+    // Set row combos (in store order) & combo text to mode map
+    void set_pins(QList<QStringList> combos, QMap<QString, uint8_t> controls);
+
+    // Combo text at index for row (empty if invalid)
+    QString get_combo(int pos, int index);
+
+    // Mark row as changed (rows changed before the next event
+    // loop pass are sent as a single dataChanged range)
+    void mark_changed(int pos);
+
+    // Model overrides
+    int rowCount(const QModelIndex &parent = QModelIndex()) const;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
+    Qt::ItemFlags flags(const QModelIndex &index) const;
+    bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole);
+
+signals:
+    // User edited a mode or value (store is updated by the receiver)
+    void pin_edited(uint8_t pinType, int pos, int column, QVariant value);
+
+private slots:
+    void flush_changes();
+
+private:
+    uint8_t model_pinType;
+    GUI_PIN_STORE *pin_store;
+
+    // Row combos & mode to combo text map
+    QVector<QStringList> pin_combos;
+    QMap<uint8_t, QString> mode_names;
+
+    // Pending dataChanged range (-1 if none)
+    int changed_first;
+    int changed_last;
+};
+
+// Delegate creating editors only for the cell being edited
+class GUI_PIN_DELEGATE : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    GUI_PIN_DELEGATE(QObject *parent = 0);
+    ~GUI_PIN_DELEGATE();
+
+    // Delegate overrides
+    QWidget *createEditor(QWidget *parent, const QStyleOptionViewItem &option,
+                          const QModelIndex &index) const;
+    void setEditorData(QWidget *editor, const QModelIndex &index) const;
+    void setModelData(QWidget *editor, QAbstractItemModel *model,
+                      const QModelIndex &index) const;
+};
+
+#endif // GUI_PIN_MODEL_H
@@ -0,0 +1,143 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-pin-scheduler.hpp"
+
+GUI_PIN_SCHEDULER::GUI_PIN_SCHEDULER()
+{
+    /* DO NOTHING */
+}
+
+GUI_PIN_SCHEDULER::~GUI_PIN_SCHEDULER()
+{
+    /* DO NOTHING */
+}
+
+void GUI_PIN_SCHEDULER::clear()
+{
+    schedules.clear();
+}
+
+void GUI_PIN_SCHEDULER::set_pins(uint8_t pinType, int num_pins)
+{
+    // Build schedule without own rates (keeps default)
+    Pin_Schedule schedule;
+    schedule.period_ms.fill(0, qMax(num_pins, 0));
+    schedule.next_ms.fill(0, qMax(num_pins, 0));
+    schedule.default_ms = schedules.contains(pinType) ? schedules.value(pinType).default_ms : 0;
+    schedule.enabled = schedules.contains(pinType) && schedules.value(pinType).enabled;
+
+    // Replace old schedule
+    schedules.insert(pinType, schedule);
+}
+
+void GUI_PIN_SCHEDULER::set_rate(uint8_t pinType, int pos, uint32_t period_ms)
+{
+    // Verify position
+    if (!schedules.contains(pinType)) return;
+    Pin_Schedule &schedule = schedules[pinType];
+    if ((pos < 0) || (schedule.period_ms.length() <= pos)) return;
+
+    schedule.period_ms[pos] = period_ms;
+}
+
+void GUI_PIN_SCHEDULER::set_default_rate(uint8_t pinType, uint32_t period_ms)
+{
+    if (!schedules.contains(pinType)) return;
+    schedules[pinType].default_ms = period_ms;
+}
+
+void GUI_PIN_SCHEDULER::set_enabled(uint8_t pinType, bool enabled)
+{
+    if (!schedules.contains(pinType)) return;
+    schedules[pinType].enabled = enabled;
+}
+
+bool GUI_PIN_SCHEDULER::has_rates(uint8_t pinType)
+{
+    // Check if any pin has its own rate
+    if (!schedules.contains(pinType)) return false;
+    foreach (uint32_t period_ms, schedules.value(pinType).period_ms)
+    {
+        if (period_ms) return true;
+    }
+    return false;
+}
+
+void GUI_PIN_SCHEDULER::start(qint64 now_ms)
+{
+    // All pins due now
+    for (Pin_Schedule &schedule : schedules)
+    {
+        schedule.next_ms.fill(now_ms);
+    }
+}
+
+QBitArray GUI_PIN_SCHEDULER::take_due(uint8_t pinType, qint64 now_ms, const QBitArray &busy)
+{
+    // Verify schedule
+    QBitArray due;
+    if (!schedules.contains(pinType) || !schedules.value(pinType).enabled) return due;
+    Pin_Schedule &schedule = schedules[pinType];
+    int num_pins = schedule.next_ms.length();
+    due.resize(num_pins);
+
+    // Find due pins
+    uint32_t period_ms;
+    for (int pos = 0; pos < num_pins; pos++)
+    {
+        // Skip unpolled & not yet due pins
+        period_ms = get_period(schedule, pos);
+        if (!period_ms || (now_ms < schedule.next_ms.at(pos))) continue;
+
+        // Due unless previous read still outstanding
+        if ((busy.size() <= pos) || !busy.testBit(pos)) due.setBit(pos);
+
+        // Move to next period (skip missed periods instead of bursting)
+        schedule.next_ms[pos] += period_ms;
+        if (schedule.next_ms.at(pos) <= now_ms)
+        {
+            schedule.next_ms[pos] += ((now_ms - schedule.next_ms.at(pos)) / period_ms + 1) * period_ms;
+        }
+    }
+
+    return due;
+}
+
+qint64 GUI_PIN_SCHEDULER::get_next_due()
+{
+    // Find earliest polled pin
+    qint64 next_ms = -1;
+    for (const Pin_Schedule &schedule : schedules)
+    {
+        if (!schedule.enabled) continue;
+        for (int pos = 0; pos < schedule.next_ms.length(); pos++)
+        {
+            if (!get_period(schedule, pos)) continue;
+            if ((next_ms < 0) || (schedule.next_ms.at(pos) < next_ms)) next_ms = schedule.next_ms.at(pos);
+        }
+    }
+    return next_ms;
+}
+
+uint32_t GUI_PIN_SCHEDULER::get_period(const Pin_Schedule &schedule, int pos)
+{
+    // Own rate overrides default
+    uint32_t period_ms = schedule.period_ms.at(pos);
+    return period_ms ? period_ms : schedule.default_ms;
+}
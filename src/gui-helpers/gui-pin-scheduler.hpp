@@ -0,0 +1,67 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_PIN_SCHEDULER_H
+#define GUI_PIN_SCHEDULER_H
+
+#include <QMap>
+#include <QVector>
+#include <QBitArray>
+
+// Poll schedule for one pin type (indexed by store position)
+typedef struct {
+    QVector<uint32_t> period_ms;    // Own rate (0 = use default)
+    QVector<qint64> next_ms;        // Next due time
+    uint32_t default_ms;            // Rate for pins without own (0 = not polled)
+    bool enabled;                   // Pin type polled through schedule
+} Pin_Schedule;
+
+class GUI_PIN_SCHEDULER
+{
+public:
+    GUI_PIN_SCHEDULER();
+    ~GUI_PIN_SCHEDULER();
+
+    // Layout (clears own rates for the pin type)
+    void clear();
+    void set_pins(uint8_t pinType, int num_pins);
+
+    // Rates (applied on next start)
+    void set_rate(uint8_t pinType, int pos, uint32_t period_ms);
+    void set_default_rate(uint8_t pinType, uint32_t period_ms);
+    void set_enabled(uint8_t pinType, bool enabled);
+    bool has_rates(uint8_t pinType);
+
+    // Make every polled pin due at now_ms (pins with equal or
+    // multiple rates stay aligned so they share requests)
+    void start(qint64 now_ms);
+
+    // Positions due at now_ms (pins set in busy are skipped this
+    // period), moves each due pin to its next period
+    QBitArray take_due(uint8_t pinType, qint64 now_ms, const QBitArray &busy);
+
+    // Earliest due time of any enabled pin (-1 if nothing polled)
+    qint64 get_next_due();
+
+private:
+    QMap<uint8_t, Pin_Schedule> schedules;
+
+    static uint32_t get_period(const Pin_Schedule &schedule, int pos);
+};
+
+#endif // GUI_PIN_SCHEDULER_H
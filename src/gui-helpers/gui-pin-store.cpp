@@ -0,0 +1,169 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-pin-store.hpp"
+
+#include <QtGlobal>
+#include <QDateTime>
+
+GUI_PIN_STORE::GUI_PIN_STORE()
+{
+    /* DO NOTHING */
+}
+
+GUI_PIN_STORE::~GUI_PIN_STORE()
+{
+    /* DO NOTHING */
+}
+
+void GUI_PIN_STORE::clear()
+{
+    tables.clear();
+}
+
+void GUI_PIN_STORE::set_pins(uint8_t pinType, QList<uint8_t> pin_nums)
+{
+    // Keep old table to carry over existing pin state
+    Pin_Table old_table = tables.value(pinType);
+    int num_pins = pin_nums.length();
+
+    // Build new table
+    Pin_Table table;
+    table.pin_num.reserve(num_pins);
+    table.pos.fill(-1, 256);
+    table.raw.fill(0, num_pins);
+    table.value.fill(0, num_pins);
+    table.scaled.fill(0, num_pins);
+    table.mode.fill(0, num_pins);
+    table.range.fill(EMPTY_RANGE, num_pins);
+    table.input.fill(false, num_pins);
+    table.timestamp.fill(0, num_pins);
+
+    int old_pos;
+    for (int i = 0; i < num_pins; i++)
+    {
+        // Add pin
+        table.pin_num.append(pin_nums.at(i));
+        table.pos[pin_nums.at(i)] = i;
+
+        // Copy existing state
+        old_pos = old_table.pos.isEmpty() ? -1 : old_table.pos.at(pin_nums.at(i));
+        if (old_pos < 0) continue;
+        table.raw[i] = old_table.raw.at(old_pos);
+        table.value[i] = old_table.value.at(old_pos);
+        table.scaled[i] = old_table.scaled.at(old_pos);
+        table.mode[i] = old_table.mode.at(old_pos);
+        table.range[i] = old_table.range.at(old_pos);
+        table.input[i] = old_table.input.at(old_pos);
+        table.timestamp[i] = old_table.timestamp.at(old_pos);
+    }
+
+    // Replace table
+    tables.insert(pinType, table);
+}
+
+QList<uint8_t> GUI_PIN_STORE::get_pin_types()
+{
+    return tables.keys();
+}
+
+const Pin_Table *GUI_PIN_STORE::get_table(uint8_t pinType)
+{
+    // Return table (or nullptr if unknown type)
+    QMap<uint8_t, Pin_Table>::const_iterator table = tables.constFind(pinType);
+    if (table == tables.constEnd()) return nullptr;
+    return &table.value();
+}
+
+int GUI_PIN_STORE::get_num_pins(uint8_t pinType)
+{
+    const Pin_Table *table = get_table(pinType);
+    return table ? table->pin_num.length() : 0;
+}
+
+int GUI_PIN_STORE::get_pos(uint8_t pinType, uint8_t pin_num)
+{
+    const Pin_Table *table = get_table(pinType);
+    return table ? table->pos.at(pin_num) : -1;
+}
+
+void GUI_PIN_STORE::set_mode(uint8_t pinType, int pos, uint8_t mode,
+                             RangeList range, bool input)
+{
+    // Get & verify table
+    Pin_Table *table = get_pin_table(pinType, pos);
+    if (!table) return;
+
+    // Set mode info
+    table->mode[pos] = mode;
+    table->range[pos] = range;
+    table->input[pos] = input;
+}
+
+bool GUI_PIN_STORE::set_raw(uint8_t pinType, int pos, uint16_t raw, qint64 timestamp)
+{
+    // Get & verify table
+    Pin_Table *table = get_pin_table(pinType, pos);
+    if (!table) return false;
+
+    // Scale value
+    const RangeList &rList = table->range.at(pos);
+    int value = qRound((float) raw + (rList.min * rList.div));
+
+    // Set values
+    table->raw[pos] = raw;
+    table->value[pos] = value;
+    table->scaled[pos] = ((float) value) / rList.div;
+    table->timestamp[pos] = (timestamp < 0) ? QDateTime::currentMSecsSinceEpoch() : timestamp;
+    return true;
+}
+
+bool GUI_PIN_STORE::set_value(uint8_t pinType, int pos, int value, double scaled)
+{
+    // Get & verify table
+    Pin_Table *table = get_pin_table(pinType, pos);
+    if (!table) return false;
+
+    // Set values (raw is what would be sent)
+    const RangeList &rList = table->range.at(pos);
+    table->raw[pos] = (uint16_t) (qRound(value - (rList.min * rList.div)) & 0xFFFF);
+    table->value[pos] = value;
+    table->scaled[pos] = scaled;
+    table->timestamp[pos] = QDateTime::currentMSecsSinceEpoch();
+    return true;
+}
+
+int GUI_PIN_STORE::get_bounded_value(uint8_t pinType, int pos)
+{
+    // Get & verify table
+    const Pin_Table *table = get_table(pinType);
+    if (!table || (pos < 0) || (table->value.length() <= pos)) return 0;
+
+    // Bound to range (same as slider)
+    const RangeList &rList = table->range.at(pos);
+    return qBound(rList.min, table->value.at(pos), qMax(rList.min, rList.max));
+}
+
+Pin_Table *GUI_PIN_STORE::get_pin_table(uint8_t pinType, int pos)
+{
+    // Find table & verify position
+    QMap<uint8_t, Pin_Table>::iterator table = tables.find(pinType);
+    if ((table == tables.end()) || (pos < 0) || (table.value().value.length() <= pos))
+        return nullptr;
+    return &table.value();
+}
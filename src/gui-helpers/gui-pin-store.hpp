@@ -0,0 +1,80 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_PIN_STORE_H
+#define GUI_PIN_STORE_H
+
+#include <QMap>
+#include <QList>
+#include <QVector>
+
+typedef struct {
+    int min;
+    int max;
+    int step;
+    float div;
+} RangeList;
+#define EMPTY_RANGE RangeList{.min=0, .max=0, .step=0, .div=1.0}
+
+// Per pin type table, each vector is indexed by pin position
+// (positions ordered by pin number, same order as the pin widgets)
+typedef struct {
+    QVector<uint8_t> pin_num;     // Position -> pin number
+    QVector<int16_t> pos;         // Pin number -> position (-1 if unused)
+    QVector<uint16_t> raw;        // Wire value (value - min*div)
+    QVector<int> value;           // Value in slider units
+    QVector<double> scaled;       // Displayed value (value / div)
+    QVector<uint8_t> mode;        // Combo control value
+    QVector<RangeList> range;     // Range of current mode
+    QVector<bool> input;          // Mode only updated by device
+    QVector<qint64> timestamp;    // Last update (ms since epoch)
+} Pin_Table;
+
+class GUI_PIN_STORE
+{
+public:
+    GUI_PIN_STORE();
+    ~GUI_PIN_STORE();
+
+    // Table layout
+    void clear();
+    void set_pins(uint8_t pinType, QList<uint8_t> pin_nums);
+    QList<uint8_t> get_pin_types();
+    const Pin_Table *get_table(uint8_t pinType);
+    int get_num_pins(uint8_t pinType);
+    int get_pos(uint8_t pinType, uint8_t pin_num);
+
+    // Pin mode setters
+    void set_mode(uint8_t pinType, int pos, uint8_t mode,
+                  RangeList range, bool input);
+
+    // Pin value setters (return false if pos invalid)
+    // (timestamp is ms since epoch, -1 for now)
+    bool set_raw(uint8_t pinType, int pos, uint16_t raw, qint64 timestamp = -1);
+    bool set_value(uint8_t pinType, int pos, int value, double scaled);
+
+    // Value (in slider units) clamped to range
+    int get_bounded_value(uint8_t pinType, int pos);
+
+private:
+    QMap<uint8_t, Pin_Table> tables;
+
+    Pin_Table *get_pin_table(uint8_t pinType, int pos);
+};
+
+#endif // GUI_PIN_STORE_H
@@ -54,7 +54,8 @@ MainWindow::supportedProtocolsList({
                                        "COM Port",
                                        "TCP Client",
                                        "TCP Server",
-                                       "UDP Socket"
+                                       "UDP Socket",
+                                       "Link Emulator"
                                    });
 
 MainWindow::MainWindow(QWidget *parent) :
@@ -68,8 +69,16 @@ MainWindow::MainWindow(QWidget *parent) :
     prev_tab = -1;
     device = nullptr;
     configMap = nullptr;
+    clientConfigMap = nullptr;
     speed = "";
 
+    // Set reconnect parameters
+    reconnect_settings = Reconnect_Settings_DEFAULT;
+    reconnect_attempts = 0;
+    reconnect_delay_ms = 0;
+    reconnect_armed = false;
+    reconnecting = false;
+
     // Setup Welcome widget
     welcome_tab = new GUI_WELCOME(this);
     welcome_tab->set_gui_tab_name("Welcome");
@@ -107,6 +116,16 @@ MainWindow::MainWindow(QWidget *parent) :
     // Setup Comm Bridge
     comm_bridge = new GUI_COMM_BRIDGE(supportedGUIsList.length(), this);
 
+    // Setup worker pool for multi-client bridges (one thread per core)
+    comm_pool = new GUI_COMM_POOL(0, this);
+
+    // Setup reconnect timer (restarted with backoff each attempt)
+    reconnectTimer = new QTimer(this);
+    reconnectTimer->setSingleShot(true);
+    connect(reconnectTimer, SIGNAL(timeout()),
+            this, SLOT(reconnect_device()),
+            Qt::DirectConnection);
+
     // Add values to Device combo
     bool prev_block_status;
     prev_block_status = ui->Device_Combo->blockSignals(true);
@@ -120,6 +139,10 @@ MainWindow::MainWindow(QWidget *parent) :
     ui->ConnType_Combo->addItems(MainWindow::supportedProtocolsList);
     ui->ConnType_Combo->blockSignals(prev_block_status);
 
+    // Setup serial port hotplug monitor
+    // (must exist before first updateConnInfoCombo() call)
+    serial_hotplug = new SERIAL_HOTPLUG(this);
+
     // Set Initial values
     setConnected(false);
     on_Device_Combo_activated(ui->Device_Combo->currentIndex());
@@ -143,15 +166,15 @@ MainWindow::MainWindow(QWidget *parent) :
             Qt::DirectConnection);
 
     // Add update selections connections
-    connect(&updateConnInfo, SIGNAL(timeout()),
-            this, SLOT(updateConnInfoCombo()),
+    connect(serial_hotplug, SIGNAL(devicesChanged(QStringList)),
+            this, SLOT(serialDevicesChanged()),
             Qt::DirectConnection);
 }
 
 MainWindow::~MainWindow()
 {
-    // If connected, disconnect
-    if (deviceConnected())
+    // If connected (or trying to reconnect), disconnect
+    if (deviceConnected() || reconnecting)
     {
         on_DeviceDisconnect_Button_clicked();
     }
@@ -159,9 +182,6 @@ MainWindow::~MainWindow()
     // Delete config map
     if (configMap) GUI_GENERIC_HELPER::delete_configMap(&configMap);
 
-    // Stop connection timers
-    updateConnInfo.stop();
-
     // Tell bridge to exit (once locks freed)
     comm_bridge->destroy_bridge();
 
@@ -175,12 +195,11 @@ MainWindow::~MainWindow()
 
 void MainWindow::closeEvent(QCloseEvent *e)
 {
-    // If connected, disconnect
-    if (deviceConnected())
+    // If connected (or trying to reconnect), disconnect
+    if (deviceConnected() || reconnecting)
     {
         on_DeviceDisconnect_Button_clicked();
     }
-    updateConnInfo.stop();
 
     e->accept();
 }
@@ -241,6 +260,7 @@ void MainWindow::on_Speed_Combo_activated(int)
     switch (getConnType())
     {
         case CONN_TYPE_SERIAL_COM_PORT:
+        case CONN_TYPE_LINK_EMULATOR:
         {
             if (ui->Speed_Combo->currentText() == "Other")
                 GUI_GENERIC_HELPER::getUserString(&speed, "Custom Baudrate", "Baudrate");
@@ -329,6 +349,22 @@ void MainWindow::on_DeviceConnect_Button_clicked()
             device = new UDP_SOCKET(conn[0], conn[1].toInt(), conn[2].toInt(), this);
             break;
         }
+        case CONN_TYPE_LINK_EMULATOR:
+        {
+            // Create a new settings struct
+            Link_Emulator_Settings link_settings = Link_Emulator_Settings_DEFAULT;
+
+            // Call parse function
+            QMap<QString, QVariant> tmpMap;
+            options_link_emulator(&main_options_settings,
+                                  configMap->value(ui->ConnType_Combo->currentText(),
+                                                   &tmpMap),
+                                  &link_settings);
+
+            // Create new object
+            device = new LINK_EMULATOR(&link_settings, this);
+            break;
+        }
         default:
         {
             return;
@@ -339,7 +375,21 @@ void MainWindow::on_DeviceConnect_Button_clicked()
     {
         setConnected(false);
         return;
-    } else if (!device->initSuccessful())
+    }
+
+    // Set reconnect policy (on by default for links that can blip)
+    // Remote only reset if set (e.g. boards that restart on reopen),
+    // otherwise transfers resume where they stopped
+    QMap<QString, QVariant> tmpMap;
+    reconnect_settings = Reconnect_Settings_DEFAULT;
+    reconnect_settings.enabled = ((getConnType() == CONN_TYPE_SERIAL_COM_PORT)
+                                  || (getConnType() == CONN_TYPE_TCP_CLIENT));
+    options_reconnect(&main_options_settings,
+                      configMap->value(ui->ConnType_Combo->currentText(), &tmpMap),
+                      &reconnect_settings);
+    reconnect_info = connInfo;
+
+    if (!device->initSuccessful())
     {
         GUI_GENERIC_HELPER::showMessage("Error: Initilization failed!");
         on_DeviceDisconnect_Button_clicked();
@@ -355,6 +405,15 @@ void MainWindow::on_DeviceConnect_Button_clicked()
             this, SLOT(on_DeviceDisconnected()),
             Qt::QueuedConnection);
 
+    // Multi-client devices hand each client off to its own session
+    // Use queued connection for thread expansion
+    if (getConnType() == CONN_TYPE_TCP_SERVER)
+    {
+        connect(device, SIGNAL(clientConnected(COMMS_BASE*)),
+                this, SLOT(on_ClientConnected(COMMS_BASE*)),
+                Qt::QueuedConnection);
+    }
+
     // Try to connect
     device->open();
 }
@@ -376,6 +435,19 @@ void MainWindow::on_DeviceConnected() {
         // Remove all existing tabs
         ucOptionsClear();
 
+        // Multi-client devices build tabs per client (see on_ClientConnected())
+        if (getConnType() == CONN_TYPE_TCP_SERVER)
+        {
+            // Keep config for every client session
+            if (clientConfigMap) GUI_GENERIC_HELPER::delete_configMap(&clientConfigMap);
+            clientConfigMap = configMap;
+            configMap = nullptr;
+
+            // Set connected & wait for clients
+            setConnected(true);
+            return;
+        }
+
         // Try to open the bridge
         if (!comm_bridge->open_bridge())
         {
@@ -383,14 +455,8 @@ void MainWindow::on_DeviceConnected() {
             return;
         }
 
-        // Connect bridge to device connections if bridge opened
-        // Use queued connection for thread expansion
-        connect(device, SIGNAL(readyRead(QByteArray)),
-                comm_bridge, SLOT(receive(QByteArray)),
-                Qt::QueuedConnection);
-        connect(comm_bridge, SIGNAL(write_data(QByteArray)),
-                device, SLOT(write(QByteArray)),
-                Qt::QueuedConnection);
+        // Attach device queues to bridge if bridge opened
+        comm_bridge->attach_device(device);
 
         // Block signals from tab group
         bool prev_block_status = ui->ucOptions->blockSignals(true);
@@ -435,6 +501,9 @@ void MainWindow::on_DeviceConnected() {
         // Manually call reset remote (if shut off for tab switches)
         if (!main_options_settings.reset_on_tab_switch && deviceConnected())
             comm_bridge->reset_remote();
+
+        // Link up with tabs built, allow reconnects from here on
+        reconnect_armed = deviceConnected();
     } else
     {
         GUI_GENERIC_HELPER::showMessage("Error: Unable to connect to target!");
@@ -445,6 +514,12 @@ void MainWindow::on_DeviceConnected() {
 
 void MainWindow::on_DeviceDisconnected()
 {
+    // Failed reconnect attempt, next one already scheduled
+    if (reconnecting) return;
+
+    // Keep tabs & bridge state if the link can be retried
+    if (start_reconnect()) return;
+
     // Remove widgets from GUI
     on_DeviceDisconnect_Button_clicked();
 
@@ -452,10 +527,166 @@ void MainWindow::on_DeviceDisconnected()
     GUI_GENERIC_HELPER::showMessage("Error: Connection to target lost!");
 }
 
+void MainWindow::on_ClientConnected(COMMS_BASE *client)
+{
+    // Verify client & that server still running
+    if (!client) return;
+    if (!deviceConnected() || !clientConfigMap || !client->isConnected())
+    {
+        delete client;
+        return;
+    }
+
+    // Create new session (only TCP servers emit clientConnected())
+    Client_Session session;
+    session.client = client;
+    session.name = ((TCP_SERVER_CLIENT*) client)->get_client_name();
+
+    // Create session bridge (parentless so it can move to the comm pool)
+    session.bridge = new GUI_COMM_BRIDGE(supportedGUIsList.length());
+    if (!session.bridge->open_bridge())
+    {
+        delete session.bridge;
+        delete client;
+        return;
+    }
+    client_sessions.append(session);
+
+    // Attach client queues to bridge (before moving to comm pool)
+    session.bridge->attach_device(client);
+
+    // Connect client to host
+    // Use queued connection for thread expansion
+    connect(client, SIGNAL(deviceDisconnected()),
+            this, SLOT(on_ClientDisconnected()),
+            Qt::QueuedConnection);
+
+    // Block signals from tab group
+    bool prev_block_status = ui->ucOptions->blockSignals(true);
+
+    // Add dynamic addition tab group ('+' tab) on first client
+    if (ui->ucOptions->indexOf(add_new_tab) == -1)
+        ui->ucOptions->addTab(add_new_tab, add_new_tab->get_gui_tab_name());
+
+    // Setup client tab group before '+'
+    uint8_t gui_key;
+    GUI_BASE *tab_holder;
+    int tab_pos = ui->ucOptions->indexOf(add_new_tab);
+    foreach (QString childGroup, clientConfigMap->keys())
+    {
+        // Verify that its a known GUI
+        gui_key = getGUIType(childGroup.split('_').last());
+        if (gui_key == MAJOR_KEY_ERROR) continue;
+
+        // Create new tab
+        tab_holder = create_new_tab(gui_key, clientConfigMap->value(childGroup),
+                                    session.bridge);
+
+        // If tab creation failed, continue
+        if (!tab_holder) continue;
+
+        // Add new GUI to tabs
+        ui->ucOptions->insertTab(tab_pos, tab_holder, get_tab_label(tab_holder));
+        tab_pos += 1;
+    }
+
+    // Force any changes in more options
+    update_bridge_options(&main_options_settings, session.bridge);
+
+    // Enable signals for tab group
+    ui->ucOptions->blockSignals(prev_block_status);
+
+    // Move client & bridge processing into the comm pool
+    // (spreads protocol handling of all clients across worker threads)
+    comm_pool->attach({session.client, session.bridge});
+
+    // Freshen tabs for first use
+    on_ucOptions_currentChanged(ui->ucOptions->currentIndex());
+
+    // Commands generally fail the first time after new connection
+    // Manually call reset remote (if shut off for tab switches)
+    if (!main_options_settings.reset_on_tab_switch)
+        invoke_bridge(session.bridge, "reset_remote", Qt::QueuedConnection);
+}
+
+void MainWindow::on_ClientDisconnected()
+{
+    // Find & close session of disconnected client
+    COMMS_BASE *client = (COMMS_BASE*) sender();
+    for (int i = 0; i < client_sessions.length(); i++)
+    {
+        if (client_sessions.at(i).client != client) continue;
+
+        // Notify user of connection loss
+        QString name = client_sessions.at(i).name;
+        close_client_session(i, false);
+        GUI_GENERIC_HELPER::showMessage("Error: Connection to " + name + " lost!");
+        return;
+    }
+}
+
+void MainWindow::on_DeviceReconnected()
+{
+    // Remove reconnected connection (added per reconnect)
+    if (device)
+    {
+        disconnect(device, SIGNAL(deviceConnected()),
+                   this, SLOT(on_DeviceReconnected()));
+    }
+
+    // Verify still trying & link up
+    if (!reconnecting || !deviceConnected()) return;
+    stop_reconnect();
+
+    // Continue any transfers (device skips a resent packet it already ran)
+    comm_bridge->resume_bridge();
+
+    // Drop stale state if the device restarted on reopen
+    // (after resume, as writes are dropped while suspended)
+    if (reconnect_settings.reset_remote) comm_bridge->reset_remote();
+    statusBar()->showMessage("Reconnected to target", 5000);
+}
+
+void MainWindow::reconnect_device()
+{
+    // Verify still trying
+    if (!reconnecting || !device) return;
+
+    // Give up once out of attempts
+    if (reconnect_settings.max_attempts
+            && (reconnect_settings.max_attempts <= reconnect_attempts))
+    {
+        on_DeviceDisconnect_Button_clicked();
+        GUI_GENERIC_HELPER::showMessage("Error: Connection to target lost!");
+        return;
+    }
+    reconnect_attempts += 1;
+    statusBar()->showMessage("Connection to target lost, reconnecting (attempt "
+                             + QString::number(reconnect_attempts) + ")...");
+
+    // Schedule next attempt before trying (open may not report failure)
+    reconnectTimer->start(reconnect_delay_ms);
+    reconnect_delay_ms = qMin(reconnect_delay_ms * 2, reconnect_settings.max_ms);
+
+    // Try to reopen
+    device->close();
+    device->open();
+}
+
 void MainWindow::on_DeviceDisconnect_Button_clicked()
 {
-    // Reset the remote
-    if (deviceConnected()) comm_bridge->reset_remote();
+    // Stop any reconnect in progress
+    stop_reconnect();
+    reconnect_armed = false;
+
+    // Reset the remote (or each client remote)
+    if (deviceConnected() && (getConnType() != CONN_TYPE_TCP_SERVER))
+        comm_bridge->reset_remote();
+    while (!client_sessions.isEmpty())
+        close_client_session(0, deviceConnected());
+
+    // Delete client config settings
+    if (clientConfigMap) GUI_GENERIC_HELPER::delete_configMap(&clientConfigMap);
 
     // Disconnect any connected slots
     if (device)
@@ -465,12 +696,11 @@ void MainWindow::on_DeviceDisconnect_Button_clicked()
                    this, SLOT(on_DeviceConnected()));
         disconnect(device, SIGNAL(deviceDisconnected()),
                    this, SLOT(on_DeviceDisconnected()));
+        disconnect(device, SIGNAL(clientConnected(COMMS_BASE*)),
+                   this, SLOT(on_ClientConnected(COMMS_BASE*)));
 
-        // Remove device to bridge connections
-        disconnect(device, SIGNAL(readyRead(QByteArray)),
-                   comm_bridge, SLOT(receive(QByteArray)));
-        disconnect(comm_bridge, SIGNAL(write_data(QByteArray)),
-                   device, SLOT(write(QByteArray)));
+        // Detach device queues from bridge
+        comm_bridge->detach_device();
 
         // Remove device
         device->close();
@@ -544,14 +774,15 @@ void MainWindow::createNewTabs_accepted()
             gui_key = getGUIType(childGroup.split('_').last());
             if (gui_key == MAJOR_KEY_ERROR) continue;
 
-            // Create new tab
-            tab_holder = create_new_tab(gui_key, configMap->value(childGroup));
+            // Create new tab (in same group as current tab)
+            tab_holder = create_new_tab(gui_key, configMap->value(childGroup),
+                                        get_tab_bridge((GUI_BASE*) ui->ucOptions->widget(prev_tab)));
 
             // If tab creation failed, continue
             if (!tab_holder) continue;
 
             // Add new GUI to tabs
-            ui->ucOptions->insertTab(tab_pos, tab_holder, tab_holder->get_gui_tab_name());
+            ui->ucOptions->insertTab(tab_pos, tab_holder, get_tab_label(tab_holder));
             tab_pos += 1;
         }
 
@@ -584,7 +815,7 @@ void MainWindow::createNewTabs_accepted()
                     tab_holder->parseConfigMap(configMap->value(childGroup));
 
                     // Update the tab text (if reset)
-                    ui->ucOptions->setTabText(index, tab_holder->get_gui_tab_name());
+                    ui->ucOptions->setTabText(index, get_tab_label(tab_holder));
 
                     // Update close button changes (start by removing then adding if needed)
                     tab_bar->setTabButton(prev_tab, QTabBar::RightSide, nullptr);
@@ -685,7 +916,7 @@ void MainWindow::on_ucOptions_currentChanged(int index)
 
     // Reset the Remote for the new tab (if connected & enabled on tab switch)
     if (main_options_settings.reset_on_tab_switch && deviceConnected())
-        comm_bridge->reset_remote();
+        invoke_bridge(get_tab_bridge(tab_holder), "reset_remote", Qt::QueuedConnection);
 }
 
 void MainWindow::on_ucOptions_tabBarClicked(int index)
@@ -754,14 +985,15 @@ void MainWindow::on_tabCloseRequested()
     // Remove from tabs
     if (index != -1) ui->ucOptions->removeTab(index);
 
-    // Remove from comm_bridge
-    comm_bridge->remove_gui(tab_holder);
+    // Remove from tab's bridge
+    bool released = remove_tab_bridge(tab_holder);
 
     // Enable signals for tab group
     ui->ucOptions->blockSignals(prev_block_status);
 
     // Delete (will not be called on default welcome tab to blank + tab)
-    delete tab_holder;
+    // (kept if the bridge may still hold it)
+    if (released) delete tab_holder;
 
     // If closing current tab, set prev_tab to -1
     if (prev_tab == index) prev_tab = -1;
@@ -772,10 +1004,9 @@ void MainWindow::on_tabCloseRequested()
 
 void MainWindow::updateConnInfoCombo()
 {
-    // Stop timers and disable connect if device connected
+    // Disable connect if device connected
     if (deviceConnected())
     {
-        updateConnInfo.stop();
         ui->DeviceConnect_Button->setEnabled(false);
         return;
     }
@@ -785,17 +1016,15 @@ void MainWindow::updateConnInfoCombo()
     {
         case CONN_TYPE_SERIAL_COM_PORT:
         {
-            if (!updateConnInfo.isActive()) {
-                updateConnInfo.start(1000);
-                ui->ConnInfo_Combo->setEditable(false);
-            }
+            // Autofilled from hotplug cache (refreshed on port changes)
+            ui->ConnInfo_Combo->setEditable(false);
 
-            QStringList *avail = SERIAL_COM_PORT::getDevices();
-            if (!avail->isEmpty())
+            QStringList avail = serial_hotplug->getDevices();
+            if (!avail.isEmpty())
             {
                 QString curr = ui->ConnInfo_Combo->currentText();
                 ui->ConnInfo_Combo->clear();
-                ui->ConnInfo_Combo->addItems(*avail);
+                ui->ConnInfo_Combo->addItems(avail);
                 ui->ConnInfo_Combo->setCurrentText(curr);
                 ui->DeviceConnect_Button->setEnabled(true);
             } else
@@ -803,13 +1032,11 @@ void MainWindow::updateConnInfoCombo()
                 ui->ConnInfo_Combo->clear();
                 ui->DeviceConnect_Button->setEnabled(false);
             }
-            delete avail;
             break;
         }
         default:
         {
-            // Stop timer and set connect enabled
-            updateConnInfo.stop();
+            // Set connect enabled
             ui->DeviceConnect_Button->setEnabled(true);
 
             // If changing from autofill, clear and make editable
@@ -821,6 +1048,17 @@ void MainWindow::updateConnInfoCombo()
     }
 }
 
+void MainWindow::serialDevicesChanged()
+{
+    // Only refresh if showing serial ports
+    if (getConnType() != CONN_TYPE_SERIAL_COM_PORT) return;
+    updateConnInfoCombo();
+
+    // Port came back while reconnecting, try now instead of waiting
+    if (reconnecting && serial_hotplug->getDevices().contains(reconnect_info))
+        reconnect_device();
+}
+
 void MainWindow::updateSpeedCombo()
 {
     // Get speed list
@@ -885,10 +1123,12 @@ void MainWindow::ucOptionsClear()
 
         // Remove from gui & bridge
         ui->ucOptions->removeTab(i);
-        comm_bridge->remove_gui(tab_holder);
+        bool released = remove_tab_bridge(tab_holder);
 
         // If not default welcome tab to blank + tab, delete
-        if ((tab_holder != welcome_tab)
+        // (kept if the bridge may still hold it)
+        if (released
+                && (tab_holder != welcome_tab)
                 && (tab_holder != add_new_tab))
         {
             delete tab_holder;
@@ -938,22 +1178,31 @@ QStringList MainWindow::getConnSpeeds()
     switch (getConnType())
     {
         case CONN_TYPE_SERIAL_COM_PORT: return SERIAL_COM_PORT::Baudrate_Defaults;
+        case CONN_TYPE_LINK_EMULATOR: return SERIAL_COM_PORT::Baudrate_Defaults;
         default: return {};
     }
 }
 
-GUI_BASE *MainWindow::create_new_tab(uint8_t gui_key, QMap<QString, QVariant> *guiConfigMap)
+GUI_BASE *MainWindow::create_new_tab(uint8_t gui_key, QMap<QString, QVariant> *guiConfigMap,
+                                     GUI_COMM_BRIDGE *bridge)
 {
     // Verify gui config
     if (!guiConfigMap) return nullptr;
 
+    // Default to main bridge
+    if (!bridge) bridge = comm_bridge;
+
     // Instantiate and add GUI
     GUI_BASE *tab_holder = nullptr;
     switch (gui_key)
     {
         case MAJOR_KEY_GENERAL_SETTINGS:
         {
-            comm_bridge->parseGenericConfigMap(guiConfigMap);
+            if (!invoke_bridge(bridge, "parseGenericConfigMap", Qt::BlockingQueuedConnection,
+                               QGenericArgument("QMap<QString,QVariant>*", &guiConfigMap)))
+            {
+                return nullptr;
+            }
 
             // Check reset tab setting (forces true from INI)
             if (guiConfigMap->value("reset_tabs_on_switch", "false").toBool())
@@ -1013,26 +1262,32 @@ GUI_BASE *MainWindow::create_new_tab(uint8_t gui_key, QMap<QString, QVariant> *g
     tab_holder->parseConfigMap(guiConfigMap);
 
     // Add new GUI to comm bridge
-    comm_bridge->add_gui(tab_holder);
+    if (!invoke_bridge(bridge, "add_gui", Qt::BlockingQueuedConnection,
+                       Q_ARG(GUI_BASE*, tab_holder)))
+    {
+        delete tab_holder;
+        return nullptr;
+    }
+    tab_bridges.insert(tab_holder, bridge);
 
     // Connect tab signals to bridge slots
     // Use queued connection for thread expansion
     connect(tab_holder, SIGNAL(transmit_file(quint8, quint8, QString, quint8, QString)),
-            comm_bridge, SLOT(send_file(quint8, quint8, QString, quint8, QString)),
+            bridge, SLOT(send_file(quint8, quint8, QString, quint8, QString)),
             Qt::QueuedConnection);
     connect(tab_holder, SIGNAL(transmit_file_pack(quint8, quint8, QString, quint8, QString)),
-            comm_bridge, SLOT(send_file_pack(quint8, quint8, QString, quint8, QString)),
+            bridge, SLOT(send_file_pack(quint8, quint8, QString, quint8, QString)),
             Qt::QueuedConnection);
     connect(tab_holder, SIGNAL(transmit_chunk(quint8, quint8, QByteArray, quint8, QString)),
-            comm_bridge, SLOT(send_chunk(quint8, quint8, QByteArray, quint8, QString)),
+            bridge, SLOT(send_chunk(quint8, quint8, QByteArray, quint8, QString)),
             Qt::QueuedConnection);
     connect(tab_holder, SIGNAL(transmit_chunk_pack(quint8, quint8, QByteArray, quint8, QString)),
-            comm_bridge, SLOT(send_chunk_pack(quint8, quint8, QByteArray, quint8, QString)),
+            bridge, SLOT(send_chunk_pack(quint8, quint8, QByteArray, quint8, QString)),
             Qt::QueuedConnection);
 
     // Connect bridge signals to tab slots
     // Use queued connection for thread expansion
-    connect(comm_bridge, SIGNAL(reset()),
+    connect(bridge, SIGNAL(reset()),
             tab_holder, SLOT(reset_gui()),
             Qt::QueuedConnection);
 
@@ -1040,10 +1295,156 @@ GUI_BASE *MainWindow::create_new_tab(uint8_t gui_key, QMap<QString, QVariant> *g
     return tab_holder;
 }
 
+QString MainWindow::get_tab_label(GUI_BASE *tab)
+{
+    // Prefix client tab groups with their client name
+    GUI_COMM_BRIDGE *bridge = get_tab_bridge(tab);
+    foreach (Client_Session session, client_sessions)
+    {
+        if (session.bridge == bridge)
+            return session.name + ": " + tab->get_gui_tab_name();
+    }
+
+    // Return tab name
+    return tab->get_gui_tab_name();
+}
+
+GUI_COMM_BRIDGE *MainWindow::get_tab_bridge(GUI_BASE *tab)
+{
+    // Tabs not in any client group use the main bridge
+    return tab_bridges.value(tab, comm_bridge);
+}
+
+bool MainWindow::remove_tab_bridge(GUI_BASE *tab)
+{
+    // Remove from bridge (blocks until a pooled bridge releases the tab)
+    return invoke_bridge(tab_bridges.take(tab), "remove_gui", Qt::BlockingQueuedConnection,
+                         Q_ARG(GUI_BASE*, tab));
+}
+
+bool MainWindow::invoke_bridge(GUI_COMM_BRIDGE *bridge, const char *method, Qt::ConnectionType type,
+                               QGenericArgument val0, QGenericArgument val1)
+{
+    // Verify bridge
+    if (!bridge) bridge = comm_bridge;
+
+    // Call directly if bridge lives in this thread
+    // (blocking queued calls would deadlock)
+    if (bridge->thread() == QThread::currentThread()) type = Qt::DirectConnection;
+
+    // Call method in bridge thread (fails if an argument type is unregistered)
+    if (QMetaObject::invokeMethod(bridge, method, type, val0, val1)) return true;
+
+    GUI_GENERIC_HELPER::showMessage("Error: Bridge call failed: " + QString(method));
+    return false;
+}
+
+void MainWindow::close_client_session(int pos, bool reset)
+{
+    // Get session
+    if ((pos < 0) || (client_sessions.length() <= pos)) return;
+    Client_Session session = client_sessions.takeAt(pos);
+
+    // Remove host connections
+    disconnect(session.client, SIGNAL(deviceDisconnected()),
+               this, SLOT(on_ClientDisconnected()));
+
+    // Block signals from tab group
+    bool prev_block_status = ui->ucOptions->blockSignals(true);
+
+    // Remove session tab group
+    GUI_BASE *tab_holder;
+    QTabBar *tab_bar = ui->ucOptions->tabBar();
+    for (int i = (ui->ucOptions->count() - 1); 0 <= i; i--)
+    {
+        // Get tab at position & verify in session
+        tab_holder = (GUI_BASE*) ui->ucOptions->widget(i);
+        if (!tab_holder || (tab_bridges.value(tab_holder) != session.bridge)) continue;
+
+        // Disable signals to prevent sending close
+        tab_holder->blockSignals(true);
+
+        // Remove tab close button
+        tab_bar->setTabButton(i, QTabBar::RightSide, nullptr);
+
+        // Remove from gui & bridge then delete
+        // (kept if the bridge may still hold it)
+        ui->ucOptions->removeTab(i);
+        if (remove_tab_bridge(tab_holder)) delete tab_holder;
+    }
+
+    // Enable signals for tab group
+    ui->ucOptions->blockSignals(prev_block_status);
+    prev_tab = -1;
+
+    // Reset remote then destroy bridge & client in their worker
+    // Queued so calls run in order after any sends in progress
+    if (reset) invoke_bridge(session.bridge, "reset_remote", Qt::QueuedConnection);
+    invoke_bridge(session.bridge, "destroy_bridge", Qt::QueuedConnection);
+    session.client->deleteLater();
+    comm_pool->detach({session.client, session.bridge});
+}
+
+bool MainWindow::start_reconnect()
+{
+    // Verify policy allows reconnecting this link
+    if (!reconnect_armed || !reconnect_settings.enabled || !device) return false;
+
+    // Setup reconnect state
+    reconnecting = true;
+    reconnect_attempts = 0;
+    reconnect_delay_ms = reconnect_settings.initial_ms;
+
+    // Hold sends until the link is back
+    comm_bridge->suspend_bridge();
+
+    // Listen for the link coming back
+    // Use queued connection for thread expansion
+    connect(device, SIGNAL(deviceConnected()),
+            this, SLOT(on_DeviceReconnected()),
+            Qt::QueuedConnection);
+
+    // Close lost link & start backoff
+    device->close();
+    reconnectTimer->start(reconnect_delay_ms);
+    statusBar()->showMessage("Connection to target lost, reconnecting...");
+    return true;
+}
+
+void MainWindow::stop_reconnect()
+{
+    // Verify reconnecting
+    if (!reconnecting) return;
+
+    // Clear reconnect state
+    reconnectTimer->stop();
+    reconnecting = false;
+    if (device)
+    {
+        disconnect(device, SIGNAL(deviceConnected()),
+                   this, SLOT(on_DeviceReconnected()));
+    }
+    statusBar()->clearMessage();
+}
+
 void MainWindow::update_options(MoreOptions_struct *options)
+{
+    // Update main bridge & every client bridge
+    update_bridge_options(options, comm_bridge);
+    foreach (Client_Session session, client_sessions)
+    {
+        update_bridge_options(options, session.bridge);
+    }
+}
+
+void MainWindow::update_bridge_options(MoreOptions_struct *options, GUI_COMM_BRIDGE *bridge)
 {
     // Set chunk size
-    comm_bridge->set_chunk_size(options->chunk_size);
+    if (!invoke_bridge(bridge, "set_chunk_size", Qt::BlockingQueuedConnection,
+                       Q_ARG(uint32_t, options->chunk_size)))
+    {
+        return;
+    }
 
     // Set checksums
     QStringList checksum_info;
@@ -1053,7 +1454,11 @@ void MainWindow::update_options(MoreOptions_struct *options)
         checksum_info = options->checksum_map.value(gui_name);
 
         // Set the new checksum
-        comm_bridge->set_tab_checksum(getGUIType(gui_name), checksum_info);
+        if (!invoke_bridge(bridge, "set_tab_checksum", Qt::BlockingQueuedConnection,
+                           Q_ARG(uint8_t, getGUIType(gui_name)), Q_ARG(QStringList, checksum_info)))
+        {
+            return;
+        }
     }
 }
 
@@ -1105,3 +1510,73 @@ void MainWindow::options_serial_com_port(MoreOptions_struct *options,
             settings->stopBits = groupMap->value(setting).toInt();
     }
 }
+
+void MainWindow::options_link_emulator(MoreOptions_struct *options,
+                                       QMap<QString, QVariant> *groupMap,
+                                       Link_Emulator_Settings *settings)
+{
+    // Add basic info (speed in baud if set)
+    if (!speed.isEmpty()) settings->bits_per_sec = speed.toUInt();
+
+    // Parse custom list & config map
+    if (!groupMap->isEmpty() || !options->custom.isEmpty())
+    {
+        // Create holding variables
+        QString setting;
+        QStringList filteredSettings;
+        QMap<QString, QVariant> settingsMap;
+
+        // Load each setting (custom overrides config map)
+        foreach (setting, QStringList({"latency_ms", "jitter_ms", "bits_per_sec",
+                                       "corrupt_rate", "drop_rate", "duplicate_rate", "seed"}))
+        {
+            filteredSettings = options->custom.filter(setting);
+            if (!filteredSettings.isEmpty())
+                settingsMap.insert(setting, filteredSettings.at(0).split(':').at(1));
+            else if (groupMap->contains(setting))
+                settingsMap.insert(setting, groupMap->value(setting));
+        }
+
+        // Set values
+        settings->latency_ms = settingsMap.value("latency_ms", settings->latency_ms).toUInt();
+        settings->jitter_ms = settingsMap.value("jitter_ms", settings->jitter_ms).toUInt();
+        settings->bits_per_sec = settingsMap.value("bits_per_sec", settings->bits_per_sec).toUInt();
+        settings->corrupt_rate = settingsMap.value("corrupt_rate", settings->corrupt_rate).toDouble();
+        settings->drop_rate = settingsMap.value("drop_rate", settings->drop_rate).toDouble();
+        settings->duplicate_rate = settingsMap.value("duplicate_rate", settings->duplicate_rate).toDouble();
+        settings->seed = settingsMap.value("seed", settings->seed).toUInt();
+    }
+}
+
+void MainWindow::options_reconnect(MoreOptions_struct *options,
+                                   QMap<QString, QVariant> *groupMap,
+                                   Reconnect_Settings *settings)
+{
+    // Parse custom list & config map
+    if (groupMap->isEmpty() && options->custom.isEmpty()) return;
+
+    // Create holding variables
+    QString setting;
+    QStringList filteredSettings;
+    QMap<QString, QVariant> settingsMap;
+
+    // Load each setting (custom overrides config map)
+    foreach (setting, QStringList({"reconnect", "reconnect_initial_ms",
+                                   "reconnect_max_ms", "reconnect_attempts",
+                                   "reconnect_reset"}))
+    {
+        filteredSettings = options->custom.filter(QRegularExpression("^" + setting + ":"));
+        if (!filteredSettings.isEmpty())
+            settingsMap.insert(setting, filteredSettings.at(0).split(':').at(1));
+        else if (groupMap->contains(setting))
+            settingsMap.insert(setting, groupMap->value(setting));
+    }
+
+    // Set values
+    settings->enabled = settingsMap.value("reconnect", settings->enabled).toBool();
+    settings->initial_ms = settingsMap.value("reconnect_initial_ms", settings->initial_ms).toUInt();
+    settings->max_ms = qMax(settingsMap.value("reconnect_max_ms", settings->max_ms).toUInt(),
+                            settings->initial_ms);
+    settings->max_attempts = settingsMap.value("reconnect_attempts", settings->max_attempts).toUInt();
+    settings->reset_remote = settingsMap.value("reconnect_reset", settings->reset_remote).toBool();
+}
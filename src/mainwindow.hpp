@@ -29,11 +29,14 @@
 #include "gui-helpers/gui-create-new-tabs.hpp"
 #include "gui-helpers/gui-more-options.hpp"
 #include "gui-helpers/gui-comm-bridge.hpp"
+#include "gui-helpers/gui-comm-pool.hpp"
 
 #include "communication/serial-com-port.hpp"
+#include "communication/serial-hotplug.hpp"
 #include "communication/tcp-client.hpp"
 #include "communication/tcp-server.hpp"
 #include "communication/udp-socket.hpp"
+#include "communication/link-emulator.hpp"
 
 #include "user-interfaces/gui-base-major-keys.h"
 #include "user-interfaces/gui-welcome.hpp"
@@ -53,9 +56,23 @@ typedef enum {
     CONN_TYPE_SERIAL_COM_PORT,
     CONN_TYPE_TCP_CLIENT,
     CONN_TYPE_TCP_SERVER,
-    CONN_TYPE_UDP_SOCKET
+    CONN_TYPE_UDP_SOCKET,
+    CONN_TYPE_LINK_EMULATOR
 } CONN_TYPE;
 
+// Auto-reconnect policy (set per connection type)
+typedef struct {
+    bool enabled;           // Keep session & retry when the link drops
+    uint32_t initial_ms;    // Delay before first attempt
+    uint32_t max_ms;        // Backoff cap (delay doubles each attempt)
+    uint32_t max_attempts;  // Give up after this many (0 = never)
+    bool reset_remote;      // Reset remote once back (device restarted)
+} Reconnect_Settings;
+#define Reconnect_Settings_DEFAULT Reconnect_Settings{\
+    .enabled=false, .initial_ms=250,\
+    .max_ms=8000, .max_attempts=30,\
+    .reset_remote=false}
+
 namespace Ui {
 class MainWindow;
 }
@@ -87,12 +104,19 @@ private slots:
     void on_DeviceConnected();
     void on_DeviceDisconnected();
 
+    void on_ClientConnected(COMMS_BASE *client);
+    void on_ClientDisconnected();
+
+    void on_DeviceReconnected();
+    void reconnect_device();
+
     void on_ucOptions_currentChanged(int index);
     void on_ucOptions_tabBarClicked(int index);
     void on_ucOptions_tabBarDoubleClicked(int index);
     void on_tabCloseRequested();
 
     void updateConnInfoCombo();
+    void serialDevicesChanged();
 
 private:
     // Main GUI
@@ -113,6 +137,18 @@ private:
     // Comm Bridge
     GUI_COMM_BRIDGE *comm_bridge;
 
+    // Multi-client (TCP server) sessions
+    // Each client gets its own bridge & tab group run in the comm pool
+    typedef struct {
+        COMMS_BASE *client;
+        GUI_COMM_BRIDGE *bridge;
+        QString name;
+    } Client_Session;
+    QList<Client_Session> client_sessions;
+    QMap<GUI_BASE*, GUI_COMM_BRIDGE*> tab_bridges;
+    CONFIG_MAP *clientConfigMap;
+    GUI_COMM_POOL *comm_pool;
+
     // Tab holder
     int prev_tab;
     QWidget* tab_closeButton;
@@ -120,7 +156,7 @@ private:
     // Device helpers
     uint8_t deviceType;
     QString deviceINI;
-    QTimer updateConnInfo;
+    SERIAL_HOTPLUG *serial_hotplug;
 
     static QStringList supportedGUIsList;
     static QStringList supportedDevicesList;
@@ -130,6 +166,15 @@ private:
     COMMS_BASE *device;
     QString speed;
 
+    // Auto-reconnect state (tabs & bridge kept while retrying)
+    Reconnect_Settings reconnect_settings;
+    QTimer *reconnectTimer;
+    QString reconnect_info;
+    uint32_t reconnect_attempts;
+    uint32_t reconnect_delay_ms;
+    bool reconnect_armed;
+    bool reconnecting;
+
     void updateSpeedCombo();
     void setConnected(bool conn);
     void ucOptionsClear();
@@ -142,15 +187,38 @@ private:
     QStringList getConnSpeeds();
 
     // Create a new gui based on the configuration info
-    GUI_BASE *create_new_tab(uint8_t gui_key, QMap<QString, QVariant> *guiConfigMap);
+    GUI_BASE *create_new_tab(uint8_t gui_key, QMap<QString, QVariant> *guiConfigMap,
+                             GUI_COMM_BRIDGE *bridge = nullptr);
+    QString get_tab_label(GUI_BASE *tab);
+
+    // Bridge helpers (handles bridges running in the comm pool)
+    GUI_COMM_BRIDGE *get_tab_bridge(GUI_BASE *tab);
+    bool remove_tab_bridge(GUI_BASE *tab);
+    bool invoke_bridge(GUI_COMM_BRIDGE *bridge, const char *method, Qt::ConnectionType type,
+                       QGenericArgument val0 = QGenericArgument(),
+                       QGenericArgument val1 = QGenericArgument());
+
+    // Client session helpers
+    void close_client_session(int pos, bool reset);
+
+    // Auto-reconnect helpers
+    bool start_reconnect();
+    void stop_reconnect();
 
     // More options gui parser
     void update_options(MoreOptions_struct *options);
+    void update_bridge_options(MoreOptions_struct *options, GUI_COMM_BRIDGE *bridge);
 
     // Connection option parsers
     void options_serial_com_port(MoreOptions_struct *options,
                                  QMap<QString, QVariant> *groupMap,
                                  Serial_COM_Port_Settings *settings);
+    void options_link_emulator(MoreOptions_struct *options,
+                               QMap<QString, QVariant> *groupMap,
+                               Link_Emulator_Settings *settings);
+    void options_reconnect(MoreOptions_struct *options,
+                           QMap<QString, QVariant> *groupMap,
+                           Reconnect_Settings *settings);
 };
 
 #endif // MAINWINDOW_H
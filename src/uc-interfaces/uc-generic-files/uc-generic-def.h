@@ -31,4 +31,28 @@
 // Define UC_CUSTOM_CMD to enable custom CMD parsing
 #define UC_CUSTOM_CMD
 
+// Define UC_IO_TIMESTAMPS to append the device read time to io values
+// (sent with io_timestamp_flag set in the minor key)
+// #define UC_IO_TIMESTAMPS
+
+// Define UC_IO_BURST to enable aio burst capture
+// (holds UC_IO_BURST_BUFFER_LEN bytes of samples, 256 unless defined)
+// #define UC_IO_BURST
+
+// Define UC_IO_DIO_EVENTS to enable dio change events
+// (queues UC_IO_EVENT_BUFFER_LEN events, 32 unless defined)
+// #define UC_IO_DIO_EVENTS
+
+// Define UC_IO_PACKED to enable bit packed read all encodings
+// (devices without it answer packed requests as a normal read all)
+// #define UC_IO_PACKED
+
+// Define UC_IO_DELTA to enable delta read all responses
+// (keeps the last sent value of every pin, 4 bytes per pin)
+// #define UC_IO_DELTA
+
+// Define UC_IO_MAX_PINS as the most pins of either type on the board
+// to shrink io buffers (io_stream_max_pins unless defined)
+// #define UC_IO_MAX_PINS 20
+
 #endif // UC_GENERIC_DEF_H
@@ -78,12 +78,19 @@ typedef enum {
     fsm_global_exit_flag = 0x01,
     fsm_global_alloction_error_flag = 0x02
 } FSM_GLOBAL_FLAGS_ENUM;
-static uint8_t fsm_global_flags = fsm_global_alloction_error_flag;
+static volatile uint8_t fsm_global_flags = fsm_global_alloction_error_flag;
+
+// Sequence bit of last run host packet (none after setup or reset)
+// Resends of that packet are acked again without running
+static const uint8_t fsm_sequence_none = 0xFF;
+static uint8_t fsm_last_sequence = fsm_sequence_none;
 
 // Function prototypes (local access only)
 static void fsm_ack(uint8_t ack_key);
+static uint32_t fsm_build_packet(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uint32_t data_len);
 static bool fsm_read_next(uint8_t* data_array, uint32_t num_bytes, uint32_t timeout);
 static bool fsm_check_checksum(const uint8_t* data, uint32_t data_len, const uint8_t* checksum_cmp);
+static bool fsm_check_sequence();
 static const checksum_struct* fsm_get_checksum_struct(uint8_t gui_key);
 
 void fsm_setup(uint32_t buffer_len)
@@ -93,6 +100,7 @@ void fsm_setup(uint32_t buffer_len)
     major_key = MAJOR_KEY_ERROR;  // All errors are 0
     minor_key = MAJOR_KEY_ERROR;  // All errors are 0
     curr_packet_stage = 1;        // Set to stage 1
+    fsm_last_sequence = fsm_sequence_none; // Run first packet
 
     // Select largest checksum size for buffer
     uint32_t checksum_size_cmp;
@@ -137,6 +145,9 @@ void fsm_setup(uint32_t buffer_len)
 
     // Reset to start defaults
     uc_reset();
+#ifdef UC_IO
+    uc_io_stream_stop();
+#endif
 
     // Preload all info for fsm_ready_buffer
     // Will never change across execution of program
@@ -160,25 +171,55 @@ void fsm_setup(uint32_t buffer_len)
     }
 }
 
+bool fsm_check_sequence()
+{
+    // Resets always run & restart the sequence
+    if (major_key == MAJOR_KEY_RESET)
+    {
+        fsm_last_sequence = fsm_sequence_none;
+        return true;
+    }
+
+    // Host acks are not sequenced
+    if (major_key == MAJOR_KEY_ACK) return true;
+
+    // Skip resend of last run packet (its ack was lost)
+    uint8_t sequence = fsm_buffer[s1_major_key_loc] & s1_sequence_flag;
+    if (sequence == fsm_last_sequence) return false;
+    fsm_last_sequence = sequence;
+    return true;
+}
+
 void fsm_destroy()
 {
-    // Free dynamic buffer
+    // Free dynamic buffer (cleared so destroying again is safe)
     free(fsm_buffer);
+    fsm_buffer = 0;
 
     // Free static buffers
     free(fsm_ready_buffer);
     free(fsm_ack_buffer);
     free(fsm_checksum_buffer);
+    fsm_ready_buffer = 0;
+    fsm_ack_buffer = 0;
+    fsm_checksum_buffer = 0;
 
     // Set fsm_global_flags for allocation error
     // Forces another call to fsm_setup to use fsm
     fsm_global_flags |= fsm_global_alloction_error_flag;
 }
 
+void fsm_exit()
+{
+    // Set exit flag (fsm_poll() & fsm_send() return on next check)
+    fsm_global_flags |= fsm_global_exit_flag;
+}
+
 void fsm_poll()
 {
     // Setup local variables
     uint32_t min_buffer_len;
+    uint32_t read_timeout = packet_timeout;
 
     // Loop while no errors (error only set if malloc or realloc fails)
     while (!fsm_global_flags)
@@ -186,8 +227,13 @@ void fsm_poll()
         // Reset buffer pointer
         fsm_buffer_ptr = fsm_buffer;
 
+#ifdef UC_IO
+        // Send any due streams & events (only wait for packets until the next is due)
+        read_timeout = uc_io_poll();
+#endif
+
         // Read first stage or loop after timeout
-        if (!fsm_read_next(fsm_buffer_ptr, num_s1_bytes, packet_timeout)) continue;
+        if (!fsm_read_next(fsm_buffer_ptr, num_s1_bytes, read_timeout)) continue;
         fsm_buffer_ptr += num_s1_bytes;
 
         // Parse keys
@@ -292,8 +338,18 @@ void fsm_poll()
             continue;
         }
 
-        // Ignore ack and continue (should never get an ack here)
-        if (major_key == MAJOR_KEY_ACK) continue;
+        // Only batched stream acks handled here (late packet acks dropped)
+        if (major_key == MAJOR_KEY_ACK)
+        {
+#ifdef UC_IO
+            if ((minor_key == (MAJOR_KEY_IO | stream_ack_flag))
+                    && fsm_check_checksum(fsm_buffer, min_buffer_len-checksum_size, fsm_buffer_ptr))
+            {
+                uc_io_stream_ack();
+            }
+#endif
+            continue;
+        }
 
         // Check Checksum
         if (!fsm_check_checksum(fsm_buffer, min_buffer_len-checksum_size, fsm_buffer_ptr))
@@ -307,8 +363,8 @@ void fsm_poll()
         // Send Packet Ack
         fsm_ack(major_key);
 
-        // Run FSM
-        fsm_run();
+        // Run FSM (unless resend of last run packet)
+        if (fsm_check_sequence()) fsm_run();
     }
 
     // Destroy fsm if error
@@ -428,8 +484,8 @@ bool fsm_isr()
         // Return to first stage for next call
         curr_packet_stage = packet_stage_read_keys;
 
-        // Ready for fsm call
-        return true;
+        // Ready for fsm call (unless resend of last run packet)
+        return fsm_check_sequence();
     }
 
     // Handle error conditions
@@ -474,6 +530,9 @@ void fsm_run()
 #endif
         case MAJOR_KEY_RESET:
             uc_reset();
+#ifdef UC_IO
+            uc_io_stream_stop();
+#endif
             break;
         default: // Will fall through for MAJOR_KEY_ERROR
             uc_reset_buffers();
@@ -496,7 +555,7 @@ void fsm_ack(uint8_t ack_key)
     uc_send(fsm_ack_buffer, num_default_packet_bytes);
 }
 
-void fsm_send(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uint32_t data_len)
+uint32_t fsm_build_packet(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uint32_t data_len)
 {
     // Find data_len size
     if ((data_len == 0) || (data == 0)) num_s2_bits = num_s2_bits_0;
@@ -521,7 +580,7 @@ void fsm_send(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uin
         {
             // Set allocation error flag
             fsm_global_flags |= fsm_global_alloction_error_flag;
-            return;
+            return 0;
         }
     }
     fsm_buffer_ptr = fsm_buffer;
@@ -557,6 +616,17 @@ void fsm_send(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uin
     // Construct checksum for data
     check->get_checksum(fsm_buffer, min_buffer_len-checksum_size, check->checksum_start, fsm_buffer_ptr);
 
+    // Return packet length
+    return min_buffer_len;
+}
+
+void fsm_send(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uint32_t data_len)
+{
+    // Build packet in fsm_buffer
+    uint32_t min_buffer_len = fsm_build_packet(s_major_key, s_minor_key, data, data_len);
+    if (!min_buffer_len) return;
+    uint32_t checksum_size = fsm_get_checksum_struct(s_major_key)->get_checksum_size();
+
     // If sending ack, send and return (should never get something back)
     if (s_major_key == MAJOR_KEY_ACK)
     {
@@ -565,11 +635,13 @@ void fsm_send(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uin
     }
 
     // Else, send & verify data packet transmission
+    bool resend = true;
     do
     {
         // Send data followed by checksum
         // Checksum needs to be sent right after data
-        uc_send(fsm_buffer, min_buffer_len);
+        if (resend) uc_send(fsm_buffer, min_buffer_len);
+        resend = true;
 
         // Read ack (happens only if if not sending an ack)
         fsm_read_next(fsm_ack_buffer, num_s1_bytes+checksum_size, packet_timeout);
@@ -579,11 +651,23 @@ void fsm_send(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uin
             switch (fsm_ack_buffer[s1_major_key_loc] & s1_major_key_byte_mask)
             {
                 case MAJOR_KEY_ACK: // If keys match exit otherwise send again
+                    // Batched stream acks are not for this packet (keep waiting)
+                    if (fsm_ack_buffer[s1_minor_key_loc] & stream_ack_flag)
+                    {
+#ifdef UC_IO
+                        if (fsm_ack_buffer[s1_minor_key_loc] == (MAJOR_KEY_IO | stream_ack_flag))
+                            uc_io_stream_ack();
+#endif
+                        resend = false;
+                        break;
+                    }
+
                     // Ack stores the major key of the sent packet in the minor key location
                     if (fsm_ack_buffer[s1_minor_key_loc] == s_major_key)
                         return;
                     break;
                 case MAJOR_KEY_RESET: // Reset and exit if reset received
+                    fsm_last_sequence = fsm_sequence_none;
                     uc_reset();
                     return;
                 default: // Default reset buffers and send again
@@ -591,7 +675,15 @@ void fsm_send(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uin
                     break;
             }
         }
-    } while (true);
+    } while (!fsm_global_flags);
+}
+
+void fsm_send_unacked(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uint32_t data_len)
+{
+    // Build & send packet without waiting for an ack
+    // (used for streams where the host acks in batches)
+    uint32_t min_buffer_len = fsm_build_packet(s_major_key, s_minor_key, data, data_len);
+    if (min_buffer_len) uc_send(fsm_buffer, min_buffer_len);
 }
 
 void fsm_send_ready()
@@ -610,11 +702,15 @@ bool fsm_read_next(uint8_t* data_array, uint32_t num_bytes, uint32_t timeout)
     uint32_t wait_time = 0;
 
     // Wait for num_bytes to be received
+    // (never sleeps past timeout so a 0 timeout returns right away)
+    uint32_t delay;
     while (uc_bytes_available() < num_bytes)
     {
-        uc_delay_ms(check_delay);
-        wait_time += check_delay;
-        if (timeout < wait_time) return false;
+        if (timeout <= wait_time) return false;
+        delay = timeout - wait_time;
+        if (check_delay < delay) delay = check_delay;
+        uc_delay_ms(delay);
+        wait_time += delay;
     }
 
     // Read bytes into array
@@ -42,10 +42,12 @@ extern "C"
 /* FSM Public Functions */
 void fsm_setup(uint32_t buffer_len);
 void fsm_destroy();
+void fsm_exit();
 void fsm_poll();
 bool fsm_isr();
 void fsm_run();
 void fsm_send(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uint32_t data_len);
+void fsm_send_unacked(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uint32_t data_len);
 void fsm_send_ready();
 
 /*** Following extern functions must be defined on a per uC basis ***/
@@ -73,6 +75,12 @@ extern uint8_t uc_send(uint8_t* data, uint32_t data_len);
 #ifdef UC_IO
 /* Parses IO minor key and acts */
 extern void uc_io(uint8_t major_key, uint8_t minor_key, const uint8_t* buffer, uint32_t buffer_len);
+/* Sends due IO streams & events, returns ms until next is due (called by fsm_poll) */
+extern uint32_t uc_io_poll();
+/* Batched ack received for IO streams */
+extern void uc_io_stream_ack();
+/* Stops all IO streams */
+extern void uc_io_stream_stop();
 #endif
 
 #ifdef UC_DATA_TRANSMIT
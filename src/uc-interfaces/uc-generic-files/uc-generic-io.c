@@ -18,6 +18,124 @@
 
 #include "uc-generic-io.h"
 
+// Most pins per type (buffers are sized for this many, define as the
+// board's pin count to save RAM, at most io_stream_max_pins)
+#ifndef UC_IO_MAX_PINS
+#define UC_IO_MAX_PINS io_stream_max_pins
+#endif
+
+// Stream state (one per pin type)
+typedef struct {
+    uint16_t interval_ms;
+    uint32_t last_ms;
+    uint8_t mask[io_stream_max_mask_bytes];
+} uc_io_stream_struct;
+
+typedef enum {
+    uc_io_stream_aio = 0,
+    uc_io_stream_dio,
+    uc_io_stream_num
+} UC_IO_STREAM_ENUM;
+
+static uc_io_stream_struct uc_io_streams[uc_io_stream_num];
+static uint8_t uc_io_stream_unacked;
+static uint32_t uc_io_stream_last_ack;
+
+// Stream packet buffer (2 bytes per pin & device time)
+static uint8_t uc_io_stream_buffer[(UC_IO_MAX_PINS << 1) + io_timestamp_len];
+
+#ifdef UC_IO_DIO_EVENTS
+// DIO event state
+#ifndef UC_IO_EVENT_BUFFER_LEN
+#define UC_IO_EVENT_BUFFER_LEN 32
+#endif
+typedef struct {
+    uint8_t pin_num;
+    uint16_t value;
+    uint32_t time_us;
+} uc_io_event_struct;
+
+static uc_io_stream_struct uc_io_events_info;
+static uint16_t uc_io_events_last[UC_IO_MAX_PINS];
+static volatile uc_io_event_struct uc_io_events[UC_IO_EVENT_BUFFER_LEN];
+static volatile uint8_t uc_io_events_head;
+static volatile uint8_t uc_io_events_count;
+static volatile uint8_t uc_io_events_flags;
+static uint32_t uc_io_events_first_ms;
+
+// Event batch buffer (flags + all buffered events)
+static uint8_t uc_io_events_buffer[s2_io_event_start_loc + (UC_IO_EVENT_BUFFER_LEN * s2_io_event_end)];
+#endif
+
+#ifdef UC_IO_BURST
+// AIO burst state (samples stored after room for one frame header,
+// each frame header is written over already sent samples)
+#ifndef UC_IO_BURST_BUFFER_LEN
+#define UC_IO_BURST_BUFFER_LEN 256
+#endif
+#ifndef UC_IO_BURST_FRAME_LEN
+#define UC_IO_BURST_FRAME_LEN (UC_IO_MAX_PINS << 1)
+#endif
+static uint32_t uc_io_burst_period_us;
+static uint16_t uc_io_burst_samples;
+static uint8_t uc_io_burst_mask[io_stream_max_mask_bytes];
+static uint8_t uc_io_burst_pending;
+static uint8_t uc_io_burst_buffer[s2_io_burst_data_loc + UC_IO_BURST_BUFFER_LEN];
+#endif
+
+// Read response buffer (read pins echo the read mask before values & time)
+// (also holds timestamped & packed read all responses, only packed dio
+// bits can be larger with state & wide bits before every pin wide)
+#define UC_IO_MAX_MASK_BYTES ((UC_IO_MAX_PINS + 7) >> 3)
+#ifdef UC_IO_PACKED
+#define UC_IO_READ_BUFFER_LEN (s2_io_read_pins_mask_loc + (UC_IO_MAX_MASK_BYTES << 1) + (UC_IO_MAX_PINS << 1) + io_timestamp_len)
+#else
+#define UC_IO_READ_BUFFER_LEN (s2_io_read_pins_mask_loc + UC_IO_MAX_MASK_BYTES + (UC_IO_MAX_PINS << 1) + io_timestamp_len)
+#endif
+static uint8_t uc_io_read_buffer[UC_IO_READ_BUFFER_LEN];
+
+#ifdef UC_IO_DELTA
+// Delta state (last sent values, one per pin type)
+#ifndef UC_IO_DELTA_KEYFRAME_INTERVAL
+#define UC_IO_DELTA_KEYFRAME_INTERVAL 32
+#endif
+typedef enum {
+    uc_io_delta_aio = 0,
+    uc_io_delta_dio,
+    uc_io_delta_num
+} UC_IO_DELTA_ENUM;
+static uint16_t uc_io_delta_last[uc_io_delta_num][UC_IO_MAX_PINS];
+static uint8_t uc_io_delta_count[uc_io_delta_num];
+#endif
+
+// Function prototypes (local access only)
+static void uc_io_stream_set(uint8_t stream, const uint8_t* buffer, uint32_t buffer_len);
+static void uc_io_stream_send(uint8_t stream);
+#ifdef UC_IO_DIO_EVENTS
+static void uc_io_events_set(const uint8_t* buffer, uint32_t buffer_len);
+static void uc_io_events_scan();
+static void uc_io_events_send();
+static uint8_t* uc_io_write_event(uint8_t* buffer, uint8_t pin_num, uint16_t value, uint32_t time_us);
+#endif
+#ifdef UC_IO_BURST
+static void uc_io_burst_set(const uint8_t* buffer, uint32_t buffer_len);
+static void uc_io_burst_run();
+#endif
+#if defined(UC_IO_TIMESTAMPS) || defined(UC_IO_DIO_EVENTS) || defined(UC_IO_BURST)
+static void uc_io_write_u32(uint8_t* buffer, uint32_t value);
+#endif
+#if defined(UC_IO_PACKED) || defined(UC_IO_DELTA)
+static bool uc_io_send_packed(uint8_t minor_key, uint8_t encoding);
+#endif
+#ifdef UC_IO_DELTA
+static uint32_t uc_io_pack_delta(uint8_t delta, uint8_t encoding, const uint16_t* read_data, uint8_t num_pins);
+#endif
+#ifdef UC_IO_PACKED
+static uint32_t uc_io_pack_values(uint8_t encoding, const uint16_t* read_data, uint8_t num_pins);
+#endif
+static void uc_io_send_pins(uint8_t minor_key, const uint8_t* buffer);
+static void uc_io_send_all(uint8_t minor_key, const uint16_t* read_data, uint8_t num_pins);
+
 void uc_io(uint8_t major_key, uint8_t minor_key, const uint8_t* buffer, uint32_t buffer_len)
 {
     // Verify bytes for command or return
@@ -41,6 +159,29 @@ void uc_io(uint8_t major_key, uint8_t minor_key, const uint8_t* buffer, uint32_t
             if (buffer_len != s2_io_read_end) return;
             else break;
         }
+        case MINOR_KEY_IO_DIO_STREAM:
+        case MINOR_KEY_IO_AIO_STREAM:
+        case MINOR_KEY_IO_DIO_EVENTS:
+        {
+            if (buffer_len < s2_io_stream_mask_loc) return;
+            else break;
+        }
+        case MINOR_KEY_IO_AIO_BURST:
+        {
+            if (buffer_len < s2_io_burst_req_mask_loc) return;
+            else break;
+        }
+        case MINOR_KEY_IO_DIO_READ_PINS:
+        case MINOR_KEY_IO_AIO_READ_PINS:
+        {
+            if ((buffer_len < s2_io_read_pins_mask_loc)
+                    || (buffer_len != (uint32_t) (s2_io_read_pins_mask_loc + buffer[s2_io_read_pins_mask_len_loc]))
+                    || (io_read_pins_max_mask_bytes < buffer[s2_io_read_pins_mask_len_loc]))
+            {
+                return;
+            }
+            else break;
+        }
     }
 
     // Parse and act on minor key
@@ -118,22 +259,61 @@ void uc_io(uint8_t major_key, uint8_t minor_key, const uint8_t* buffer, uint32_t
         }
         case MINOR_KEY_IO_DIO_READ_ALL:
         {
-            // Read all dio pins
-            uint16_t* read_data = uc_dio_read_all();
+#if defined(UC_IO_PACKED) || defined(UC_IO_DELTA)
+            // Send packed if encoding requested & supported
+            if (buffer_len && uc_io_send_packed(minor_key, buffer[s2_io_packed_encoding_loc])) break;
+#endif
 
-            // Send back to GUI
-            fsm_send(major_key, minor_key, (const uint8_t*) read_data, (uc_dio_num_pins << 1));
+            // Read all dio pins & send back to GUI
+            uc_io_send_all(minor_key, uc_dio_read_all(), uc_dio_num_pins);
             break;
         }
         case MINOR_KEY_IO_AIO_READ_ALL:
         {
-            // Read all aio pins
-            uint16_t* read_data = uc_aio_read_all();
+#if defined(UC_IO_PACKED) || defined(UC_IO_DELTA)
+            // Send packed if encoding requested & supported
+            if (buffer_len && uc_io_send_packed(minor_key, buffer[s2_io_packed_encoding_loc])) break;
+#endif
 
-            // Send back to GUI
-            fsm_send(major_key, minor_key, (const uint8_t*) read_data, (uc_aio_num_pins << 1));
+            // Read all aio pins & send back to GUI
+            uc_io_send_all(minor_key, uc_aio_read_all(), uc_aio_num_pins);
+            break;
+        }
+        case MINOR_KEY_IO_DIO_READ_PINS:
+        case MINOR_KEY_IO_AIO_READ_PINS:
+        {
+            // Read masked pins & send back to GUI
+            uc_io_send_pins(minor_key, buffer);
             break;
         }
+        case MINOR_KEY_IO_AIO_STREAM:
+        {
+            // Subscribe (or stop) aio stream
+            uc_io_stream_set(uc_io_stream_aio, buffer, buffer_len);
+            break;
+        }
+        case MINOR_KEY_IO_DIO_STREAM:
+        {
+            // Subscribe (or stop) dio stream
+            uc_io_stream_set(uc_io_stream_dio, buffer, buffer_len);
+            break;
+        }
+#ifdef UC_IO_DIO_EVENTS
+        case MINOR_KEY_IO_DIO_EVENTS:
+        {
+            // Subscribe (or stop) dio events
+            uc_io_events_set(buffer, buffer_len);
+            break;
+        }
+#endif
+#ifdef UC_IO_BURST
+        case MINOR_KEY_IO_AIO_BURST:
+        {
+            // Arm (or abort) aio burst (captured on next poll)
+            uc_io_burst_set(buffer, buffer_len);
+            break;
+        }
+#endif
         case MINOR_KEY_IO_REMOTE_CONN:
         {
             // Setup remote conn info
@@ -149,9 +329,652 @@ void uc_io(uint8_t major_key, uint8_t minor_key, const uint8_t* buffer, uint32_t
         case MINOR_KEY_IO_AIO_READ:
         case MINOR_KEY_IO_DIO_READ_ALL:
         case MINOR_KEY_IO_AIO_READ_ALL:
+        case MINOR_KEY_IO_DIO_READ_PINS:
+        case MINOR_KEY_IO_AIO_READ_PINS:
         {
             // Send dev ready
             fsm_send_ready();
         }
     }
 }
+
+uint32_t uc_io_poll()
+{
+    // Setup variables
+    uint32_t now = uc_millis();
+    uint32_t next = packet_timeout;
+    uint32_t elapsed, wait;
+    uc_io_stream_struct *stream;
+
+#ifdef UC_IO_BURST
+    // Capture & upload armed burst (blocks until done)
+    if (uc_io_burst_pending)
+    {
+        uc_io_burst_run();
+        now = uc_millis();
+    }
+#endif
+
+    for (uint8_t i = 0; i < uc_io_stream_num; i++)
+    {
+        // Skip stopped streams
+        stream = &uc_io_streams[i];
+        if (!stream->interval_ms) continue;
+
+        // Check if due
+        elapsed = now - stream->last_ms;
+        if (elapsed < stream->interval_ms)
+        {
+            wait = stream->interval_ms - elapsed;
+            if (wait < next) next = wait;
+            continue;
+        }
+
+        // Hold while too many packets unacked
+        // (resume if acks stopped arriving, they may have been lost)
+        if (stream_ack_window <= uc_io_stream_unacked)
+        {
+            if ((now - uc_io_stream_last_ack) < packet_timeout)
+            {
+                next = 1;
+                continue;
+            }
+            uc_io_stream_unacked = 0;
+            uc_io_stream_last_ack = now;
+        }
+
+        // Move to next interval (skip missed intervals instead of bursting)
+        stream->last_ms += stream->interval_ms;
+        if (stream->interval_ms <= (now - stream->last_ms)) stream->last_ms = now;
+
+        // Send values
+        uc_io_stream_send(i);
+        if (stream->interval_ms < next) next = stream->interval_ms;
+    }
+
+#ifdef UC_IO_DIO_EVENTS
+    // Check dio events
+    if (uc_io_events_info.interval_ms)
+    {
+        // Look for changes (scan every pass)
+        uc_io_events_scan();
+        next = 1;
+
+        // Get buffer state (interrupts may be adding events)
+        uc_critical_enter();
+        uint8_t num_events = uc_io_events_count;
+        uint32_t first_ms = uc_io_events_first_ms;
+        uc_critical_exit();
+
+        // Send batch if half full or oldest held too long
+        if (num_events
+                && (((UC_IO_EVENT_BUFFER_LEN >> 1) <= num_events)
+                    || (uc_io_events_info.interval_ms <= (uc_millis() - first_ms))))
+        {
+            uc_io_events_send();
+        }
+    }
+#endif
+
+    return next;
+}
+
+void uc_io_stream_ack()
+{
+    // Host acked everything received so far
+    uc_io_stream_unacked = 0;
+    uc_io_stream_last_ack = uc_millis();
+}
+
+void uc_io_stream_stop()
+{
+    // Clear all stream info
+    memset(uc_io_streams, 0, sizeof(uc_io_streams));
+    uc_io_stream_unacked = 0;
+
+#ifdef UC_IO_DIO_EVENTS
+    // Clear all event info
+    uc_critical_enter();
+    memset(&uc_io_events_info, 0, sizeof(uc_io_events_info));
+    uc_io_events_count = 0;
+    uc_io_events_flags = 0;
+    uc_critical_exit();
+#endif
+
+#ifdef UC_IO_BURST
+    // Clear armed burst
+    uc_io_burst_pending = 0;
+#endif
+
+#ifdef UC_IO_DELTA
+    // Next deltas are keyframes
+    memset(uc_io_delta_count, 0, sizeof(uc_io_delta_count));
+#endif
+}
+
+#ifdef UC_IO_DIO_EVENTS
+void uc_io_dio_event(uint8_t pin_num, uint16_t value, uint32_t time_us)
+{
+    // Ignore if not subscribed to pin
+    if (!uc_io_events_info.interval_ms || (UC_IO_MAX_PINS <= pin_num)
+            || !(uc_io_events_info.mask[pin_num >> 3] & (1 << (pin_num & 0x07))))
+    {
+        return;
+    }
+
+    // Drop event if buffer full (host is told in next batch)
+    if (UC_IO_EVENT_BUFFER_LEN <= uc_io_events_count)
+    {
+        uc_io_events_flags |= io_event_flag_overflow;
+        return;
+    }
+
+    // Add event
+    uint8_t pos = (uc_io_events_head + uc_io_events_count) % UC_IO_EVENT_BUFFER_LEN;
+    uc_io_events[pos].pin_num = pin_num;
+    uc_io_events[pos].value = value;
+    uc_io_events[pos].time_us = time_us;
+    if (!uc_io_events_count) uc_io_events_first_ms = uc_millis();
+    uc_io_events_count += 1;
+
+    // Save last value (scan will not report it again)
+    uc_io_events_last[pin_num] = value;
+}
+#endif
+
+void uc_io_stream_set(uint8_t stream, const uint8_t* buffer, uint32_t buffer_len)
+{
+    // Get stream info
+    uc_io_stream_struct *info = &uc_io_streams[stream];
+
+    // Set interval & mask (missing mask bytes are 0)
+    info->interval_ms = ((uint16_t) buffer[s2_io_stream_interval_high_loc] << 8) | buffer[s2_io_stream_interval_low_loc];
+    memset(info->mask, 0, sizeof(info->mask));
+    uint32_t mask_len = buffer_len - s2_io_stream_mask_loc;
+    if (sizeof(info->mask) < mask_len) mask_len = sizeof(info->mask);
+    memcpy(info->mask, buffer + s2_io_stream_mask_loc, mask_len);
+
+    // Stop if no pins selected
+    uint8_t any_pins = 0;
+    for (uint8_t i = 0; i < sizeof(info->mask); i++) any_pins |= info->mask[i];
+    if (!any_pins) info->interval_ms = 0;
+
+    // Send first values on next poll
+    uint32_t now = uc_millis();
+    info->last_ms = now - info->interval_ms;
+    uc_io_stream_unacked = 0;
+    uc_io_stream_last_ack = now;
+}
+
+void uc_io_stream_send(uint8_t stream)
+{
+    // Read all pins (values already big endian)
+    uint16_t* read_data;
+    uint8_t num_pins, minor_key;
+    if (stream == uc_io_stream_dio)
+    {
+        read_data = uc_dio_read_all();
+        num_pins = uc_dio_num_pins;
+        minor_key = MINOR_KEY_IO_DIO_STREAM;
+    } else
+    {
+        read_data = uc_aio_read_all();
+        num_pins = uc_aio_num_pins;
+        minor_key = MINOR_KEY_IO_AIO_STREAM;
+    }
+    if (!read_data) return;
+    if (UC_IO_MAX_PINS < num_pins) num_pins = UC_IO_MAX_PINS;
+    uint32_t read_us = uc_micros();
+
+    // Copy values for masked pins
+    const uint8_t *mask = uc_io_streams[stream].mask;
+    uint32_t data_len = 0;
+    for (uint8_t i = 0; i < num_pins; i++)
+    {
+        if (!(mask[i >> 3] & (1 << (i & 0x07)))) continue;
+        memcpy(uc_io_stream_buffer + data_len, &read_data[i], 2);
+        data_len += 2;
+    }
+
+    // Append read time & flag it (host charts it instead of receive time)
+    if (!data_len) return;
+#ifdef UC_IO_TIMESTAMPS
+    uc_io_write_u32(uc_io_stream_buffer + data_len, read_us);
+    data_len += io_timestamp_len;
+    minor_key |= io_timestamp_flag;
+#else
+    (void) read_us;
+#endif
+
+    // Send without waiting for ack (host acks in batches)
+    fsm_send_unacked(MAJOR_KEY_IO, minor_key, uc_io_stream_buffer, data_len);
+    uc_io_stream_unacked += 1;
+}
+
+#ifdef UC_IO_DIO_EVENTS
+void uc_io_events_set(const uint8_t* buffer, uint32_t buffer_len)
+{
+    // Stop events & clear buffered events (interrupts ignore events while stopped)
+    uc_critical_enter();
+    uc_io_events_info.interval_ms = 0;
+    uc_io_events_count = 0;
+    uc_io_events_flags = 0;
+    uc_critical_exit();
+
+    // Set mask (same layout as streams)
+    uint16_t interval_ms = ((uint16_t) buffer[s2_io_stream_interval_high_loc] << 8) | buffer[s2_io_stream_interval_low_loc];
+    memset(uc_io_events_info.mask, 0, sizeof(uc_io_events_info.mask));
+    uint32_t mask_len = buffer_len - s2_io_stream_mask_loc;
+    if (sizeof(uc_io_events_info.mask) < mask_len) mask_len = sizeof(uc_io_events_info.mask);
+    memcpy(uc_io_events_info.mask, buffer + s2_io_stream_mask_loc, mask_len);
+    if (!interval_ms) return;
+
+    // Report current state of every subscribed pin in own batches
+    // (not through the event buffer, any number of pins fits)
+    uint8_t *event_ptr = uc_io_events_buffer + s2_io_event_start_loc;
+    uint8_t num_events = 0;
+    uint8_t num_pins = uc_dio_num_pins;
+    if (UC_IO_MAX_PINS < num_pins) num_pins = UC_IO_MAX_PINS;
+    uc_io_events_buffer[s2_io_event_flags_loc] = 0;
+    for (uint8_t i = 0; i < num_pins; i++)
+    {
+        if (!(uc_io_events_info.mask[i >> 3] & (1 << (i & 0x07)))) continue;
+
+        // Add pin state (scan reports changes from here)
+        uc_io_events_last[i] = uc_dio_read(i);
+        event_ptr = uc_io_write_event(event_ptr, i, uc_io_events_last[i], uc_micros());
+        num_events += 1;
+
+        // Send full batch
+        if (num_events == UC_IO_EVENT_BUFFER_LEN)
+        {
+            fsm_send(MAJOR_KEY_IO, MINOR_KEY_IO_DIO_EVENTS, uc_io_events_buffer,
+                     s2_io_event_start_loc + (num_events * s2_io_event_end));
+            event_ptr = uc_io_events_buffer + s2_io_event_start_loc;
+            num_events = 0;
+        }
+    }
+    if (num_events)
+    {
+        fsm_send(MAJOR_KEY_IO, MINOR_KEY_IO_DIO_EVENTS, uc_io_events_buffer,
+                 s2_io_event_start_loc + (num_events * s2_io_event_end));
+    }
+
+    // Start events
+    uc_critical_enter();
+    uc_io_events_info.interval_ms = interval_ms;
+    uc_critical_exit();
+}
+
+void uc_io_events_scan()
+{
+    // Compare subscribed pins against last values
+    uint16_t value;
+    uint8_t num_pins = uc_dio_num_pins;
+    if (UC_IO_MAX_PINS < num_pins) num_pins = UC_IO_MAX_PINS;
+    for (uint8_t i = 0; i < num_pins; i++)
+    {
+        if (!(uc_io_events_info.mask[i >> 3] & (1 << (i & 0x07)))) continue;
+
+        // Interrupts may also be adding events & last values
+        value = uc_dio_read(i);
+        uc_critical_enter();
+        if (value != uc_io_events_last[i]) uc_io_dio_event(i, value, uc_micros());
+        uc_critical_exit();
+    }
+}
+
+void uc_io_events_send()
+{
+    // Copy events into batch (interrupts only add past the buffered count)
+    uint8_t *event_ptr = uc_io_events_buffer + s2_io_event_start_loc;
+    uc_critical_enter();
+    uint8_t num_events = uc_io_events_count;
+    uint8_t head = uc_io_events_head;
+    uc_critical_exit();
+    volatile uc_io_event_struct *event;
+    for (uint8_t i = 0; i < num_events; i++)
+    {
+        event = &uc_io_events[(head + i) % UC_IO_EVENT_BUFFER_LEN];
+        event_ptr = uc_io_write_event(event_ptr, event->pin_num, event->value, event->time_us);
+    }
+
+    // Free copied events & take flags (new events may have been added by interrupts)
+    uc_critical_enter();
+    uc_io_events_buffer[s2_io_event_flags_loc] = uc_io_events_flags;
+    uc_io_events_head = (head + num_events) % UC_IO_EVENT_BUFFER_LEN;
+    uc_io_events_count -= num_events;
+    uc_io_events_flags = 0;
+    if (uc_io_events_count) uc_io_events_first_ms = uc_millis();
+    uc_critical_exit();
+
+    // Send batch (acked, events are not resent)
+    fsm_send(MAJOR_KEY_IO, MINOR_KEY_IO_DIO_EVENTS, uc_io_events_buffer,
+             s2_io_event_start_loc + (num_events * s2_io_event_end));
+}
+
+uint8_t* uc_io_write_event(uint8_t* buffer, uint8_t pin_num, uint16_t value, uint32_t time_us)
+{
+    // Write big endian event & return next event position
+    buffer[s2_io_event_pin_num_loc] = pin_num;
+    buffer[s2_io_event_value_high_loc] = (uint8_t) (value >> 8);
+    buffer[s2_io_event_value_low_loc] = (uint8_t) value;
+    uc_io_write_u32(buffer + s2_io_event_time_loc, time_us);
+    return buffer + s2_io_event_end;
+}
+#endif
+
+#ifdef UC_IO_BURST
+void uc_io_burst_set(const uint8_t* buffer, uint32_t buffer_len)
+{
+    // Set period & sample count
+    uc_io_burst_period_us = ((uint32_t) buffer[s2_io_burst_req_period_loc] << 24)
+            | ((uint32_t) buffer[s2_io_burst_req_period_loc+1] << 16)
+            | ((uint32_t) buffer[s2_io_burst_req_period_loc+2] << 8)
+            | buffer[s2_io_burst_req_period_loc+3];
+    uc_io_burst_samples = ((uint16_t) buffer[s2_io_burst_req_samples_high_loc] << 8) | buffer[s2_io_burst_req_samples_low_loc];
+
+    // Set mask (missing mask bytes are 0)
+    memset(uc_io_burst_mask, 0, sizeof(uc_io_burst_mask));
+    uint32_t mask_len = buffer_len - s2_io_burst_req_mask_loc;
+    if (sizeof(uc_io_burst_mask) < mask_len) mask_len = sizeof(uc_io_burst_mask);
+    memcpy(uc_io_burst_mask, buffer + s2_io_burst_req_mask_loc, mask_len);
+
+    // Count selected pins (only pins the device has)
+    uint8_t num_pins = uc_aio_num_pins;
+    uint8_t num_selected = 0;
+    if (UC_IO_MAX_PINS < num_pins) num_pins = UC_IO_MAX_PINS;
+    for (uint8_t i = 0; i < num_pins; i++)
+    {
+        if (uc_io_burst_mask[i >> 3] & (1 << (i & 0x07))) num_selected += 1;
+    }
+
+    // Limit samples to buffer (0 samples or no pins aborts)
+    uint32_t max_samples = 0;
+    if (num_selected) max_samples = UC_IO_BURST_BUFFER_LEN / ((uint32_t) num_selected << 1);
+    if (max_samples < uc_io_burst_samples) uc_io_burst_samples = (uint16_t) max_samples;
+    uc_io_burst_pending = (uc_io_burst_samples != 0);
+}
+
+void uc_io_burst_run()
+{
+    // Setup variables
+    uint8_t *sample_ptr = uc_io_burst_buffer + s2_io_burst_data_loc;
+    uint8_t num_pins = uc_aio_num_pins;
+    uint8_t flags = 0;
+    uint16_t value;
+    uint32_t now = 0;
+    if (UC_IO_MAX_PINS < num_pins) num_pins = UC_IO_MAX_PINS;
+    uc_io_burst_pending = 0;
+
+    // Sample masked pins on fixed deadlines from start
+    // (a late sample does not shift the ones after it)
+    uint32_t start_us = uc_micros();
+    uint32_t next_us = start_us;
+    for (uint16_t s = 0; s < uc_io_burst_samples; s++)
+    {
+        // Wait for sample time
+        do
+        {
+            now = uc_micros();
+        } while ((int32_t) (now - next_us) < 0);
+        if (uc_io_burst_period_us && (uc_io_burst_period_us <= (now - next_us)))
+        {
+            flags |= io_burst_flag_late;
+        }
+        next_us += uc_io_burst_period_us;
+
+        // Read each masked pin (big endian)
+        for (uint8_t i = 0; i < num_pins; i++)
+        {
+            if (!(uc_io_burst_mask[i >> 3] & (1 << (i & 0x07)))) continue;
+
+            value = uc_aio_read(i);
+            *sample_ptr++ = (uint8_t) (value >> 8);
+            *sample_ptr++ = (uint8_t) value;
+        }
+    }
+
+    // Free running captures report the average period
+    uint32_t period_us = uc_io_burst_period_us;
+    if (!period_us && (1 < uc_io_burst_samples))
+    {
+        period_us = (now - start_us) / (uc_io_burst_samples - 1);
+    }
+
+    // Get frame size (whole samples only)
+    uint32_t sample_len = (uint32_t) (sample_ptr - (uc_io_burst_buffer + s2_io_burst_data_loc)) / uc_io_burst_samples;
+    uint16_t frame_samples = UC_IO_BURST_FRAME_LEN / sample_len;
+    if (!frame_samples) frame_samples = 1;
+
+    // Upload in frames (header written over already sent samples)
+    uint8_t *frame_ptr;
+    uint16_t num_samples;
+    for (uint16_t s = 0; s < uc_io_burst_samples; s += num_samples)
+    {
+        // Get samples in frame
+        num_samples = uc_io_burst_samples - s;
+        if (frame_samples < num_samples) num_samples = frame_samples;
+        else flags |= io_burst_flag_last;
+
+        // Write header
+        frame_ptr = uc_io_burst_buffer + ((uint32_t) s * sample_len);
+        frame_ptr[s2_io_burst_flags_loc] = flags;
+        frame_ptr[s2_io_burst_index_high_loc] = (uint8_t) (s >> 8);
+        frame_ptr[s2_io_burst_index_low_loc] = (uint8_t) s;
+        uc_io_write_u32(frame_ptr + s2_io_burst_start_loc, start_us);
+        uc_io_write_u32(frame_ptr + s2_io_burst_period_loc, period_us);
+        uc_io_write_u32(frame_ptr + s2_io_burst_sent_loc, uc_micros());
+
+        // Send frame (acked, frames are not resent)
+        fsm_send(MAJOR_KEY_IO, MINOR_KEY_IO_AIO_BURST, frame_ptr,
+                 s2_io_burst_data_loc + ((uint32_t) num_samples * sample_len));
+    }
+}
+#endif
+
+#if defined(UC_IO_TIMESTAMPS) || defined(UC_IO_DIO_EVENTS) || defined(UC_IO_BURST)
+void uc_io_write_u32(uint8_t* buffer, uint32_t value)
+{
+    // Write big endian
+    buffer[0] = (uint8_t) (value >> 24);
+    buffer[1] = (uint8_t) (value >> 16);
+    buffer[2] = (uint8_t) (value >> 8);
+    buffer[3] = (uint8_t) value;
+}
+#endif
+
+#if defined(UC_IO_PACKED) || defined(UC_IO_DELTA)
+bool uc_io_send_packed(uint8_t minor_key, uint8_t encoding)
+{
+    // Check encoding matches pin type & is compiled in
+    bool is_dio = (minor_key == MINOR_KEY_IO_DIO_READ_ALL);
+#ifdef UC_IO_DELTA
+    bool is_delta = ((encoding == io_packed_delta) || (encoding == io_packed_delta_keyframe));
+#else
+    bool is_delta = false;
+#endif
+#ifdef UC_IO_PACKED
+    bool is_packed = is_dio ? (encoding == io_packed_dio_bits)
+                            : ((encoding == io_packed_aio_10) || (encoding == io_packed_aio_12));
+#else
+    bool is_packed = false;
+#endif
+    if (!(is_delta || is_packed)) return false;
+
+    // Get values
+    uint16_t* read_data = is_dio ? uc_dio_read_all() : uc_aio_read_all();
+    uint8_t num_pins = is_dio ? uc_dio_num_pins : uc_aio_num_pins;
+    if (!read_data || (UC_IO_MAX_PINS < num_pins)) return false;
+
+    // Pack values after encoding
+    uint32_t data_len = 0;
+    uc_io_read_buffer[s2_io_packed_encoding_loc] = encoding;
+#ifdef UC_IO_DELTA
+    if (is_delta) data_len = uc_io_pack_delta(is_dio ? uc_io_delta_dio : uc_io_delta_aio, encoding, read_data, num_pins);
+#endif
+#ifdef UC_IO_PACKED
+    if (is_packed) data_len = uc_io_pack_values(encoding, read_data, num_pins);
+#endif
+
+    // Send back to GUI
+    fsm_send(MAJOR_KEY_IO, is_dio ? MINOR_KEY_IO_DIO_READ_ALL_PACKED : MINOR_KEY_IO_AIO_READ_ALL_PACKED,
+             uc_io_read_buffer, data_len);
+    return true;
+}
+#endif
+
+#ifdef UC_IO_DELTA
+uint32_t uc_io_pack_delta(uint8_t delta, uint8_t encoding, const uint16_t* read_data, uint8_t num_pins)
+{
+    // Setup variables
+    uint8_t num_mask_bytes = (num_pins + 7) >> 3;
+    uint8_t *mask_ptr = uc_io_read_buffer + s2_io_delta_mask_loc;
+    uint8_t *value_ptr = mask_ptr + num_mask_bytes;
+    uint16_t value;
+
+    // Check if keyframe (periodic, after reset, or requested)
+    bool keyframe = (encoding == io_packed_delta_keyframe) || !uc_io_delta_count[delta];
+    uc_io_delta_count[delta] = (uc_io_delta_count[delta] + 1) % UC_IO_DELTA_KEYFRAME_INTERVAL;
+    if (keyframe) uc_io_delta_count[delta] = 1;
+
+    // Set header (responses always use the delta encoding)
+    uc_io_read_buffer[s2_io_packed_encoding_loc] = io_packed_delta;
+    uc_io_read_buffer[s2_io_delta_flags_loc] = keyframe ? io_delta_flag_keyframe : 0;
+    memset(mask_ptr, 0, num_mask_bytes);
+
+    for (uint8_t i = 0; i < num_pins; i++)
+    {
+        // Values are big endian in memory
+        value = ((uint16_t) ((uint8_t*) &read_data[i])[0] << 8) | ((uint8_t*) &read_data[i])[1];
+        if (!keyframe && (value == uc_io_delta_last[delta][i])) continue;
+
+        // Add changed value & save as last sent
+        mask_ptr[i >> 3] |= (1 << (i & 0x07));
+        *value_ptr++ = (uint8_t) (value >> 8);
+        *value_ptr++ = (uint8_t) value;
+        uc_io_delta_last[delta][i] = value;
+    }
+    return (uint32_t) (value_ptr - uc_io_read_buffer);
+}
+#endif
+
+#ifdef UC_IO_PACKED
+uint32_t uc_io_pack_values(uint8_t encoding, const uint16_t* read_data, uint8_t num_pins)
+{
+    // Setup variables
+    uint8_t *data_ptr = uc_io_read_buffer + s2_io_packed_data_loc;
+    uint16_t value;
+
+    if (encoding == io_packed_dio_bits)
+    {
+        // Clear state & wide bits
+        uint8_t num_mask_bytes = (num_pins + 7) >> 3;
+        uint8_t *wide_ptr = data_ptr + num_mask_bytes;
+        uint8_t *value_ptr = wide_ptr + num_mask_bytes;
+        memset(data_ptr, 0, num_mask_bytes << 1);
+
+        for (uint8_t i = 0; i < num_pins; i++)
+        {
+            // Values are big endian in memory
+            value = ((uint16_t) ((uint8_t*) &read_data[i])[0] << 8) | ((uint8_t*) &read_data[i])[1];
+            if (value) data_ptr[i >> 3] |= (1 << (i & 0x07));
+
+            // Only send full value if more than on/off
+            if (1 < value)
+            {
+                wide_ptr[i >> 3] |= (1 << (i & 0x07));
+                *value_ptr++ = (uint8_t) (value >> 8);
+                *value_ptr++ = (uint8_t) value;
+            }
+        }
+        return (uint32_t) (value_ptr - uc_io_read_buffer);
+    }
+
+    // Pack aio values MSB first
+    uint8_t value_bits = (encoding == io_packed_aio_10) ? 10 : 12;
+    uint16_t max_value = (1 << value_bits) - 1;
+    uint32_t bit_buffer = 0;
+    uint8_t num_bits = 0;
+    for (uint8_t i = 0; i < num_pins; i++)
+    {
+        // Values are big endian in memory (clamp to width)
+        value = ((uint16_t) ((uint8_t*) &read_data[i])[0] << 8) | ((uint8_t*) &read_data[i])[1];
+        if (max_value < value) value = max_value;
+
+        // Add value & flush whole bytes
+        bit_buffer = (bit_buffer << value_bits) | value;
+        num_bits += value_bits;
+        while (8 <= num_bits)
+        {
+            num_bits -= 8;
+            *data_ptr++ = (uint8_t) (bit_buffer >> num_bits);
+        }
+    }
+
+    // Flush partial byte (padded with 0s)
+    if (num_bits) *data_ptr++ = (uint8_t) (bit_buffer << (8 - num_bits));
+    return (uint32_t) (data_ptr - uc_io_read_buffer);
+}
+#endif
+
+void uc_io_send_pins(uint8_t minor_key, const uint8_t* buffer)
+{
+    // Get pins to check (only pins the device has)
+    uint16_t num_pins = (uint16_t) buffer[s2_io_read_pins_mask_len_loc] << 3;
+    uint8_t num_dev_pins = (minor_key == MINOR_KEY_IO_DIO_READ_PINS) ? uc_dio_num_pins : uc_aio_num_pins;
+    if (num_dev_pins < num_pins) num_pins = num_dev_pins;
+    if (UC_IO_MAX_PINS < num_pins) num_pins = UC_IO_MAX_PINS;
+
+    // Echo mask of checked pins (host matches values to pins with it)
+    uint8_t mask_len = (uint8_t) ((num_pins + 7) >> 3);
+    uint8_t *mask = uc_io_read_buffer + s2_io_read_pins_mask_loc;
+    uint8_t *value_ptr = mask + mask_len;
+    uc_io_read_buffer[s2_io_read_pins_mask_len_loc] = mask_len;
+    memcpy(mask, buffer + s2_io_read_pins_mask_loc, mask_len);
+    if (num_pins & 0x07) mask[mask_len - 1] &= (uint8_t) ((1 << (num_pins & 0x07)) - 1);
+
+    // Read each masked pin (big endian)
+    uint32_t read_us = uc_micros();
+    uint16_t value;
+    for (uint8_t i = 0; i < num_pins; i++)
+    {
+        if (!(mask[i >> 3] & (1 << (i & 0x07)))) continue;
+
+        if (minor_key == MINOR_KEY_IO_DIO_READ_PINS) value = uc_dio_read(i);
+        else value = uc_aio_read(i);
+        *value_ptr++ = (uint8_t) (value >> 8);
+        *value_ptr++ = (uint8_t) value;
+    }
+
+    // Append read time & flag it
+#ifdef UC_IO_TIMESTAMPS
+    uc_io_write_u32(value_ptr, read_us);
+    value_ptr += io_timestamp_len;
+    minor_key |= io_timestamp_flag;
+#else
+    (void) read_us;
+#endif
+
+    // Send back to GUI
+    fsm_send(MAJOR_KEY_IO, minor_key, uc_io_read_buffer, (uint32_t) (value_ptr - uc_io_read_buffer));
+}
+
+void uc_io_send_all(uint8_t minor_key, const uint16_t* read_data, uint8_t num_pins)
+{
+    // Values already big endian
+    uint32_t data_len = ((uint32_t) num_pins) << 1;
+#ifdef UC_IO_TIMESTAMPS
+    // Copy values & append flagged read time (sent untimed if too many pins)
+    if (read_data && (num_pins <= UC_IO_MAX_PINS))
+    {
+        memcpy(uc_io_read_buffer, read_data, data_len);
+        uc_io_write_u32(uc_io_read_buffer + data_len, uc_micros());
+        fsm_send(MAJOR_KEY_IO, minor_key | io_timestamp_flag, uc_io_read_buffer, data_len + io_timestamp_len);
+        return;
+    }
+#endif
+
+    // Send back to GUI
+    fsm_send(MAJOR_KEY_IO, minor_key, (const uint8_t*) read_data, data_len);
+}
@@ -33,16 +33,35 @@ extern "C"
 #endif
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
 
 #include "uc-generic-def.h"
+#include "../../user-interfaces/gui-base-major-keys.h"
 #include "../../user-interfaces/gui-io-control-minor-keys.h"
 
 /* IO Functions */
 /* Parses IO minor key and calls uc specific code */
 void uc_io(uint8_t major_key, uint8_t minor_key, const uint8_t* buffer, uint32_t buffer_len);
 
+/* Stream Functions (fsm_poll calls these, call from own loop if using fsm_isr) */
+/* Sends due streams & event batches, runs armed bursts, returns ms until next is due (packet_timeout if none) */
+uint32_t uc_io_poll();
+/* Batched ack received for streamed packets */
+void uc_io_stream_ack();
+/* Stops all streams & events */
+void uc_io_stream_stop();
+
+#ifdef UC_IO_DIO_EVENTS
+/* DIO Event Functions */
+/* Queue a dio change (pin change interrupts can call this to catch short pulses) */
+/* Outside interrupts only call between uc_critical_enter() & uc_critical_exit() */
+void uc_io_dio_event(uint8_t pin_num, uint16_t value, uint32_t time_us);
+#endif
+
 /*** Following externs are defined in uc-generic-fsm (or need to be defiend elsewhere if not using) ***/
 extern void fsm_send(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uint32_t data_len);
+extern void fsm_send_unacked(uint8_t s_major_key, uint8_t s_minor_key, const uint8_t* data, uint32_t data_len);
 extern void fsm_send_ready();
 
 /*** Following extern functions must be defined on a per uC basis ***/
@@ -62,6 +81,17 @@ extern uint16_t* uc_aio_read_all();
 /* Set Remote Conn info */
 extern void uc_remote_conn();
 
+/* Returns milliseconds since start (may wrap, used for stream timing) */
+extern uint32_t uc_millis();
+
+/* Returns microseconds since start (may wrap, used for event timestamps) */
+extern uint32_t uc_micros();
+
+/* Hold off & restore interrupts calling uc_io_dio_event (guards the event buffer) */
+/* (may do nothing if uc_io_dio_event is never called from interrupts) */
+extern void uc_critical_enter();
+extern void uc_critical_exit();
+
 /* Helper variables */
 extern const uint8_t uc_dio_num_pins;
 extern const uint8_t uc_aio_num_pins;
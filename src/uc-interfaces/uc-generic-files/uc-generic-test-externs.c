@@ -69,6 +69,10 @@ void uc_aio_write(uint8_t pin_num, uint16_t value) { /* Do Nothing*/ }
 uint16_t uc_aio_read(uint8_t pin_num) { return pin_num; }
 uint16_t* uc_aio_read_all() { return 0; }
 void uc_remote_conn() { /* Do Nothing*/ }
+uint32_t uc_millis() { return 0; }
+uint32_t uc_micros() { return 0; }
+void uc_critical_enter() { /* Do Nothing*/ }
+void uc_critical_exit() { /* Do Nothing*/ }
 const uint8_t uc_dio_num_pins = 0;
 const uint8_t uc_aio_num_pins = 0;
 #endif
@@ -1,2 +1,22 @@
+SOURCES += \
+    $$PWD/uc-generic-files/uc-generic-fsm.c \
+    $$PWD/uc-generic-files/uc-generic-io.c \
+    $$PWD/uc-generic-files/uc-generic-data-transmit.c \
+    $$PWD/uc-generic-files/uc-generic-programmer.c
+
+HEADERS += \
+    $$PWD/uc-generic-files/uc-generic-def.h \
+    $$PWD/uc-generic-files/uc-generic-fsm.h \
+    $$PWD/uc-generic-files/uc-generic-io.h \
+    $$PWD/uc-generic-files/uc-generic-data-transmit.h \
+    $$PWD/uc-generic-files/uc-generic-programmer.h
+
+# Emulated uC (link emulator) runs on the host, so enable optional io features
+DEFINES += \
+    UC_IO_BURST \
+    UC_IO_DIO_EVENTS \
+    UC_IO_PACKED \
+    UC_IO_DELTA
+
 RESOURCES += \
     $$PWD/uc-interfaces.qrc
@@ -70,10 +70,26 @@ typedef enum {
 // Variables
 static const uint32_t packet_timeout = 500; // ms
 static const uint8_t num_s1_bytes = s1_end_loc;
-static const uint8_t s1_major_key_byte_mask = 0x3F;
+static const uint8_t s1_major_key_byte_mask = 0x1F;
 static const uint8_t s1_num_s2_bits_byte_mask = 0x03;
 static const uint8_t s1_num_s2_bits_byte_shift = 6;
 
+// Streamed packets are acked in batches (not per packet)
+// Host acks every stream_ack_interval packets, device holds
+// the stream after stream_ack_window unacked packets
+// (and resumes if no ack within packet_timeout)
+static const uint8_t stream_ack_interval = 8;
+static const uint8_t stream_ack_window = 16;
+
+// Host packets flip this bit in the major key byte for each new packet
+// (resends keep it, so the device acks a resend of the last packet it
+// ran without running it again, e.g. after a lost ack or link drop)
+static const uint8_t s1_sequence_flag = 0x20;
+
+// Batched stream acks set this bit in the acked major key (minor key
+// location) so they are never taken as the ack of a sent packet
+static const uint8_t stream_ack_flag = 0x80;
+
 /*
  * Struct for settings the checksum functions
  * Function signatures must match the others (only name differs)
@@ -162,6 +162,11 @@ bool GUI_BASE::waitForDevice(uint8_t)
     return false;
 }
 
+bool GUI_BASE::isStreamKey(uint8_t)
+{
+    return false;
+}
+
 void GUI_BASE::receive_gui(QByteArray)
 {
     // Default do nothing
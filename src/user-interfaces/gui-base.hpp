@@ -52,6 +52,7 @@ public:
     virtual void parseConfigMap(QMap<QString, QVariant> *configMap);
 
     virtual bool waitForDevice(uint8_t minorKey);
+    virtual bool isStreamKey(uint8_t minorKey);
 
 signals:
     // Read updates
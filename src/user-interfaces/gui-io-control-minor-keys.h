@@ -48,7 +48,25 @@ typedef enum {
     MINOR_KEY_IO_REMOTE_CONN_SET,
     MINOR_KEY_IO_REMOTE_CONN_READ,
     MINOR_KEY_IO_REMOTE_CONN_SEND,
-    MINOR_KEY_IO_REMOTE_CONN_CONNECTED
+    MINOR_KEY_IO_REMOTE_CONN_CONNECTED,
+
+    // Streaming (host subscribes, device pushes read all values)
+    MINOR_KEY_IO_AIO_STREAM,
+    MINOR_KEY_IO_DIO_STREAM,
+
+    // DIO change events (device reports changed pins with timestamps)
+    MINOR_KEY_IO_DIO_EVENTS,
+
+    // AIO burst capture (device samples at a fixed rate then uploads)
+    MINOR_KEY_IO_AIO_BURST,
+
+    // Packed read all responses (sent if requested encoding supported)
+    MINOR_KEY_IO_AIO_READ_ALL_PACKED,
+    MINOR_KEY_IO_DIO_READ_ALL_PACKED,
+
+    // Multi-pin reads (only the pins in a mask)
+    MINOR_KEY_IO_AIO_READ_PINS,
+    MINOR_KEY_IO_DIO_READ_PINS
 } MINOR_KEYS_IO;
 
 /* Stage #2 (s2) io set key positions enum */
@@ -62,6 +80,150 @@ typedef enum {
     s2_io_write_end = s2_io_combo_loc
 } S2_IO_Settings;
 
+/* Stage #2 (s2) io stream subscribe key positions enum
+ * Subscribe: [interval_high, interval_low, pin mask (LSB of first byte = pin 0)...]
+ * An interval of 0 or an empty mask stops the stream.
+ * Stream data: [value_high, value_low] for each masked pin in pin order.
+ * Stream data, read all & read pins responses may end with the device
+ * time the values were read [time_us (4 bytes, big endian)], sent with
+ * io_timestamp_flag set in the minor key (packed responses never carry it).
+*/
+typedef enum {
+    s2_io_stream_interval_high_loc = 0,
+    s2_io_stream_interval_low_loc,
+    s2_io_stream_mask_loc
+} S2_IO_Stream_Settings;
+
+// Streaming limits (enum so usable as array sizes)
+typedef enum {
+    io_stream_max_pins = 64,
+    io_stream_max_mask_bytes = 8
+} IO_Stream_Limits;
+
+// Optional device time appended to values (flag set in minor key)
+typedef enum {
+    io_timestamp_len = 4,
+    io_timestamp_flag = 0x80
+} IO_Timestamp_Settings;
+
+/* Stage #2 (s2) io dio event positions enum
+ * Subscribe: same as stream subscribe, interval is the longest time
+ * (ms) an event is held before its batch is sent.
+ * Event batch: [flags, events...] where each event is
+ * [pin_num, value_high, value_low, time_us (4 bytes, big endian)].
+ * Device time wraps every 2^32 us.
+*/
+typedef enum {
+    s2_io_event_flags_loc = 0,
+    s2_io_event_start_loc
+} S2_IO_Event_Settings;
+
+typedef enum {
+    s2_io_event_pin_num_loc = 0,
+    s2_io_event_value_high_loc,
+    s2_io_event_value_low_loc,
+    s2_io_event_time_loc,
+    s2_io_event_end = s2_io_event_time_loc + 4
+} S2_IO_Event_Positions;
+
+// Event flags (first byte of batch)
+typedef enum {
+    io_event_flag_overflow = 0x01   // Events were dropped before this batch
+} IO_Event_Flags;
+
+/* Stage #2 (s2) io aio burst request positions enum
+ * Request: [period_us (4 bytes), num_samples (2 bytes), pin mask...]
+ * (all big endian, mask same as stream subscribe).
+ * A period of 0 samples as fast as possible, 0 samples aborts.
+*/
+typedef enum {
+    s2_io_burst_req_period_loc = 0,
+    s2_io_burst_req_samples_high_loc = s2_io_burst_req_period_loc + 4,
+    s2_io_burst_req_samples_low_loc,
+    s2_io_burst_req_mask_loc
+} S2_IO_Burst_Settings;
+
+/* Stage #2 (s2) io aio burst frame positions enum
+ * Frame: [flags, first sample index (2 bytes), start_us (4 bytes),
+ *         period_us (4 bytes), sent_us (4 bytes), samples...]
+ * Each sample is [value_high, value_low] for each masked pin in pin order.
+ * Sample i was read at start_us + (i * period_us) device time.
+*/
+typedef enum {
+    s2_io_burst_flags_loc = 0,
+    s2_io_burst_index_high_loc,
+    s2_io_burst_index_low_loc,
+    s2_io_burst_start_loc,
+    s2_io_burst_period_loc = s2_io_burst_start_loc + 4,
+    s2_io_burst_sent_loc = s2_io_burst_period_loc + 4,
+    s2_io_burst_data_loc = s2_io_burst_sent_loc + 4
+} S2_IO_Burst_Positions;
+
+// Burst flags (first byte of frame)
+typedef enum {
+    io_burst_flag_last = 0x01,  // Last frame of capture
+    io_burst_flag_late = 0x02   // At least one sample missed its time
+} IO_Burst_Flags;
+
+/* Stage #2 (s2) io packed read all positions enum
+ * Request: read all with one byte [encoding]. Devices that support the
+ * encoding respond on the packed key, others respond as a normal read all.
+ * Response: [encoding, packed values...]
+ *  - dio_bits: [state bits, wide bits, wide values...] where bit i
+ *    (LSB of first byte = pin 0) of state is set if value != 0 and of wide
+ *    is set if value > 1. Each wide pin then sends its value (big endian).
+ *    Both bit arrays are (num_pins+7)/8 bytes.
+ *  - aio_10/aio_12: each value as 10 or 12 bits MSB first (clamped), last
+ *    byte padded with 0s.
+ *  - delta (either pin type): [flags, changed bits, changed values...]
+ *    where only pins changed since the last delta response are sent
+ *    (big endian). Keyframes send every pin and are sent periodically,
+ *    after a reset, or when requested with delta_keyframe. Responses
+ *    always use the delta encoding.
+*/
+typedef enum {
+    s2_io_packed_encoding_loc = 0,
+    s2_io_packed_data_loc
+} S2_IO_Packed_Settings;
+
+// Packed read all encodings
+typedef enum {
+    io_packed_raw = 0,
+    io_packed_dio_bits,
+    io_packed_aio_10,
+    io_packed_aio_12,
+    io_packed_delta,
+    io_packed_delta_keyframe
+} IO_Packed_Encodings;
+
+/* Stage #2 (s2) io delta positions enum (after packed encoding) */
+typedef enum {
+    s2_io_delta_flags_loc = s2_io_packed_data_loc,
+    s2_io_delta_mask_loc
+} S2_IO_Delta_Settings;
+
+// Delta flags
+typedef enum {
+    io_delta_flag_keyframe = 0x01   // All pins sent (host resyncs)
+} IO_Delta_Flags;
+
+/* Stage #2 (s2) io read pins positions enum
+ * Request: [mask_len, pin mask...] (mask same as stream subscribe, but
+ * may cover every pin number)
+ * Response: [mask_len, pin mask..., values...] where values are
+ * [value_high, value_low] for each masked pin in pin order. The mask
+ * only covers pins the device has (may be shorter than requested).
+*/
+typedef enum {
+    s2_io_read_pins_mask_len_loc = 0,
+    s2_io_read_pins_mask_loc
+} S2_IO_Read_Pins_Settings;
+
+// Read pins limits (mask covers every pin number)
+typedef enum {
+    io_read_pins_max_mask_bytes = 32
+} IO_Read_Pins_Limits;
+
 #ifdef __cplusplus
 }
 #endif
@@ -19,11 +19,14 @@
 #include "gui-io-control.hpp"
 #include "ui_gui-io-control.h"
 
+#include <QtEndian>
 #include <QDateTime>
+#include <QHeaderView>
 
 GUI_IO_CONTROL::GUI_IO_CONTROL(QWidget *parent) :
     GUI_BASE(parent),
-    ui(new Ui::GUI_IO_CONTROL)
+    ui(new Ui::GUI_IO_CONTROL),
+    chart_feed(&pin_store, &pin_history)
 {
     // Setup ui
     ui->setupUi(this);
@@ -35,9 +38,30 @@ GUI_IO_CONTROL::GUI_IO_CONTROL(QWidget *parent) :
     // Set buttons
     ui->StartUpdater_Button->setText("Start");
     ui->StartLog_Button->setText("Start Log");
+    ui->StartReplay_Button->setText("Replay");
 
     // Set class pin variables
     bytesPerPin = 2;
+    virtual_pin_threshold = 64;
+
+    // Set per pin schedule (single shot, set to next due pin)
+    PIN_SCHEDULE.setSingleShot(true);
+    PIN_SCHEDULE.setTimerType(Qt::PreciseTimer);
+
+    // Set packed read variables (unpacked by default)
+    packed_reads = false;
+    aio_packed_encoding = io_packed_aio_10;
+    delta_reads = false;
+
+    // Set stream & event variables (polling by default)
+    stream_updates = false;
+    streaming = false;
+    dio_events = false;
+    dio_events_active = false;
+    dio_events_interval = 0;
+    aio_burst_active = false;
+    aio_burst_late = false;
+    device_clock.reset();
 
     // Setup AIO info
     AIO_Grid = new QGridLayout();
@@ -50,9 +74,8 @@ GUI_IO_CONTROL::GUI_IO_CONTROL(QWidget *parent) :
     num_DIOcols = 2;
 
     // Set log file parameters
-    logFile = NULL;
-    logStream = NULL;
     logIsRecording = false;
+    binary_log = false;
 
     // Connect updaters
     // All internal object connections so direct is okay
@@ -62,17 +85,37 @@ GUI_IO_CONTROL::GUI_IO_CONTROL(QWidget *parent) :
     connect(&DIO_READ, SIGNAL(timeout()),
             this, SLOT(updateValues()),
             Qt::DirectConnection);
+    connect(&PIN_SCHEDULE, SIGNAL(timeout()),
+            this, SLOT(updateScheduledValues()),
+            Qt::DirectConnection);
     connect(&logTimer, SIGNAL(timeout()),
             this, SLOT(recordLogData()),
             Qt::DirectConnection);
 
+    // Connect log writer errors (queued from writer thread)
+    connect(&logWriter, SIGNAL(write_error(QString)),
+            this, SLOT(logWriteError(QString)),
+            Qt::QueuedConnection);
+
+    // Connect replay (internal object so direct is okay)
+    connect(&logReplay, SIGNAL(replay_values(uint8_t, QList<uint8_t>, QVector<float>, qint64)),
+            this, SLOT(replayValues(uint8_t, QList<uint8_t>, QVector<float>, qint64)),
+            Qt::DirectConnection);
+    connect(&logReplay, SIGNAL(replay_tick(qint64)),
+            this, SLOT(replayTick(qint64)),
+            Qt::DirectConnection);
+    connect(&logReplay, SIGNAL(replay_done()),
+            this, SLOT(replayDone()),
+            Qt::DirectConnection);
+
     // Reset GUI
     reset_gui();
 }
 
 GUI_IO_CONTROL::~GUI_IO_CONTROL()
 {
-    // Stop loggers & updaters
+    // Stop loggers, replays & updaters
+    on_StopReplay_Button_clicked();
     on_StopLog_Button_clicked();
     on_StopUpdater_Button_clicked();
 
@@ -90,6 +133,45 @@ void GUI_IO_CONTROL::parseConfigMap(QMap<QString, QVariant> *configMap)
     // Pass to parent for parsing
     GUI_BASE::parseConfigMap(configMap);
 
+    // Set history sizes (must be before pins are added)
+    Pin_History_Settings history_settings = Pin_History_Settings_DEFAULT;
+    history_settings.samples = configMap->value("history_samples", history_settings.samples).toUInt();
+    history_settings.factor = configMap->value("history_factor", history_settings.factor).toUInt();
+    history_settings.tiers = configMap->value("history_tiers", history_settings.tiers).toUInt();
+    history_settings.buckets = configMap->value("history_buckets", history_settings.buckets).toUInt();
+    pin_history.set_settings(history_settings);
+
+    // Check if charts should use pin update times (device time if sent)
+    chart_feed.set_sample_time(configMap->value("chart_sample_time", false).toBool());
+
+    // Check if read all responses should be packed
+    packed_reads = configMap->value("packed_reads", false).toBool();
+    if (configMap->value("aio_packed_bits", 10).toUInt() == 12) aio_packed_encoding = io_packed_aio_12;
+    else aio_packed_encoding = io_packed_aio_10;
+    delta_reads = configMap->value("delta_reads", false).toBool();
+
+    // Check if updates should be streamed by the device
+    stream_updates = configMap->value("stream_updates", false).toBool();
+    dio_events = configMap->value("dio_events", false).toBool();
+
+    // Check if logs should be binary (and exported to CSV on stop)
+    binary_log = (configMap->value("log_format", "csv").toString().toLower() == "binary");
+
+    // Set log writer (threaded writes, rotation & compression)
+    Log_Writer_Settings log_settings = Log_Writer_Settings_DEFAULT;
+    log_settings.threaded = configMap->value("log_async", log_settings.threaded).toBool();
+    log_settings.queue_rows = configMap->value("log_queue_rows", log_settings.queue_rows).toUInt();
+    log_settings.buffer_bytes = 1024 * configMap->value("log_buffer_kb", log_settings.buffer_bytes / 1024).toUInt();
+    log_settings.flush_ms = configMap->value("log_flush_ms", log_settings.flush_ms).toUInt();
+    log_settings.rotate_bytes = 1048576 * configMap->value("log_rotate_mb", (uint) (log_settings.rotate_bytes / 1048576)).toULongLong();
+    log_settings.rotate_secs = configMap->value("log_rotate_secs", log_settings.rotate_secs).toUInt();
+    log_settings.compress = configMap->value("log_compress", log_settings.compress).toBool();
+    log_settings.export_csv = configMap->value("log_export_csv", log_settings.export_csv).toBool();
+    logWriter.set_settings(log_settings);
+
+    // Pin count above which a pin type uses the table view
+    virtual_pin_threshold = configMap->value("virtual_pin_threshold", virtual_pin_threshold).toInt();
+
     // Setup pintypes variable
     PinTypeInfo pInfo;
     pinList.clear();
@@ -98,16 +180,26 @@ void GUI_IO_CONTROL::parseConfigMap(QMap<QString, QVariant> *configMap)
     if (!getPinTypeInfo(MINOR_KEY_IO_DIO, &pInfo)) return;
     addPinType(pInfo.pinType);
     addComboSettings(&pInfo, configMap->value("dio_combo_settings").toStringList());
-    setPinCombos(&pInfo, configMap->value("dio_pin_settings").toStringList());
-    destroy_unused_pins(&pInfo);
+    if (!setVirtualPins(&pInfo, configMap->value("dio_pin_settings").toStringList()))
+    {
+        setPinCombos(&pInfo, configMap->value("dio_pin_settings").toStringList());
+        destroy_unused_pins(&pInfo);
+        update_pin_store(&pInfo);
+    }
+    setPinRates(&pInfo, configMap->value("dio_pin_rates").toStringList());
     update_pin_grid(&pInfo);
 
     // Add AIO controls
     if (!getPinTypeInfo(MINOR_KEY_IO_AIO, &pInfo)) return;
     addPinType(pInfo.pinType);
     addComboSettings(&pInfo, configMap->value("aio_combo_settings").toStringList());
-    setPinCombos(&pInfo, configMap->value("aio_pin_settings").toStringList());
-    destroy_unused_pins(&pInfo);
+    if (!setVirtualPins(&pInfo, configMap->value("aio_pin_settings").toStringList()))
+    {
+        setPinCombos(&pInfo, configMap->value("aio_pin_settings").toStringList());
+        destroy_unused_pins(&pInfo);
+        update_pin_store(&pInfo);
+    }
+    setPinRates(&pInfo, configMap->value("aio_pin_rates").toStringList());
     update_pin_grid(&pInfo);
 
     // Add Remote controls
@@ -145,11 +237,28 @@ bool GUI_IO_CONTROL::waitForDevice(uint8_t minorKey)
             // Check if read pin
         case MINOR_KEY_IO_DIO_READ_ALL:
             return dio_read_requested;
+        case MINOR_KEY_IO_AIO_READ_PINS:
+            return (0 < aio_read_pins.count(true));
+        case MINOR_KEY_IO_DIO_READ_PINS:
+            return (0 < dio_read_pins.count(true));
         default:
             return GUI_BASE::waitForDevice(minorKey);
     }
 }
 
+bool GUI_IO_CONTROL::isStreamKey(uint8_t minorKey)
+{
+    // Stream data may carry device time flag
+    switch (minorKey & ~io_timestamp_flag)
+    {
+        case MINOR_KEY_IO_AIO_STREAM:
+        case MINOR_KEY_IO_DIO_STREAM:
+            return true;
+        default:
+            return GUI_BASE::isStreamKey(minorKey);
+    }
+}
+
 void GUI_IO_CONTROL::reset_gui()
 {
     // Reset base first
@@ -160,12 +269,21 @@ void GUI_IO_CONTROL::reset_gui()
     aio_read_requested = false;
     dio_read_requested_double = false;
     aio_read_requested_double = false;
-    dio_read_pins.clear();
-    aio_read_pins.clear();
-    dio_read_pins_double.clear();
-    aio_read_pins_double.clear();
+    dio_read_pins.fill(false, io_max_pins);
+    aio_read_pins.fill(false, io_max_pins);
+    dio_read_pins_double.fill(false, io_max_pins);
+    aio_read_pins_double.fill(false, io_max_pins);
+    aio_burst_active = false;
+
+    // Drop pending widget refreshes (pins reset below)
+    dirty_pins.clear();
 
-    // Stop logging and updating if running
+    // Resync deltas (device also keyframes after a reset)
+    delta_snapshots.clear();
+    delta_keyframe_needed = {MINOR_KEY_IO_AIO, MINOR_KEY_IO_DIO};
+
+    // Stop logging, replaying and updating if running
+    on_StopReplay_Button_clicked();
     on_StopLog_Button_clicked();
     on_StopUpdater_Button_clicked();
 
@@ -201,6 +319,18 @@ void GUI_IO_CONTROL::reset_gui()
             comboBox->blockSignals(prev_block_status);
         }
     }
+
+    // Reset virtual pin settings
+    foreach (uint8_t pinType, pin_models.keys())
+    {
+        // Set mode to first combo
+        GUI_PIN_MODEL *model = pin_models.value(pinType);
+        int num_pins = pin_store.get_num_pins(pinType);
+        for (int pos = 0; pos < num_pins; pos++)
+        {
+            set_virtual_pin(pinType, pos, pin_model_mode_col, model->get_combo(pos, 0));
+        }
+    }
 }
 
 void GUI_IO_CONTROL::chart_update_request(QList<QString> data_points, GUI_CHART_ELEMENT *target_element)
@@ -209,40 +339,19 @@ void GUI_IO_CONTROL::chart_update_request(QList<QString> data_points, GUI_CHART_
     QList<QVariant> data;
 
     // Setup variables
-    uint8_t pinType = 0, pinNum = 0;
-    QStringList pinNum_split;
-    QHBoxLayout *item;
-    bool pin_error;
+    Chart_Series_Handle handle;
+    const Pin_Table *table = nullptr;
     QVariant val;
 
     // Get each element
     foreach (QString pin, data_points)
     {
-        // Set to no pin error
-        pin_error = false;
-
-        // Get pin str
-        pinNum_split = pin.split('_');
-        if (pinNum_split.length() != 2) pin_error = true;
-
-        // If no error, get pin info
-        if (!pin_error)
-        {
-            // Get pin type
-            if (pinNum_split.at(0) == "AIO") pinType = MINOR_KEY_IO_AIO;
-            else if (pinNum_split.at(0) == "DIO") pinType = MINOR_KEY_IO_DIO;
-            else pin_error = true;
-
-            // Get pin number
-            bool ok = false;
-            pinNum = pinNum_split.at(1).toInt(&ok);
-            if (!ok) pin_error = true;
-        }
-
-        // Get pin value
-        if (!pin_error && get_pin_layout(pinType, pinNum, &item))
+        // Get pin value from store
+        table = nullptr;
+        if (getChartHandle(pin, &handle)) table = pin_store.get_table(handle.pinType);
+        if (table && (0 <= handle.pos))
         {
-            val = QVariant(((QLineEdit*) item->itemAt(io_line_edit_pos)->widget())->text().toDouble());
+            val = QVariant(table->scaled.at(handle.pos));
         } else
         {
             val = QVariant(-1.0);
@@ -256,32 +365,66 @@ void GUI_IO_CONTROL::chart_update_request(QList<QString> data_points, GUI_CHART_
     emit target_element->update_receive(data);
 }
 
-void GUI_IO_CONTROL::recordPinValues(PinTypeInfo *pInfo)
+void GUI_IO_CONTROL::chart_subscribe_request(QList<QString> series_uids, int interval_ms,
+                                             GUI_CHART_ELEMENT *target_element)
 {
-    if (logStream == nullptr) return;
+    // Resolve each series once (unknown pins push -1)
+    QVector<Chart_Series_Handle> handles;
+    Chart_Series_Handle handle;
+    foreach (QString series_uid, series_uids)
+    {
+        if (!getChartHandle(series_uid, &handle))
+        {
+            handle = Chart_Series_Handle{.pinType=0, .pin_num=0, .pos=-1, .seen=0};
+        }
+        handles.append(handle);
+    }
+
+    // Set chart subscription
+    chart_feed.subscribe(target_element, series_uids, handles, interval_ms);
+}
 
-    *logStream << pInfo->pinType;
+void GUI_IO_CONTROL::recordBinaryValues()
+{
+    // Gather values in column order (AIO then DIO)
+    QVector<float> values;
+    const Pin_Table *table;
+    foreach (uint8_t pinType, QList<uint8_t>({MINOR_KEY_IO_AIO, MINOR_KEY_IO_DIO}))
+    {
+        table = pin_store.get_table(pinType);
+        if (!table) continue;
+        foreach (double scaled, table->scaled) values.append((float) scaled);
+    }
 
-    QLineEdit *lineEditValue;
-    foreach (QHBoxLayout* pin, *pinMap.value(pInfo->pinType))
+    // Queue record (writer stops log if pins changed since log start)
+    if (!logWriter.write_record(QDateTime::currentMSecsSinceEpoch(), values))
     {
-        // Make sure pin valid
-        if (!pin) continue;
+        if (!logWriter.is_open()) on_StopLog_Button_clicked();
+        return;
+    }
+
+    // Emit updated
+    emit log_updated();
+}
 
-        // Add comma
-        *logStream << ",";
+void GUI_IO_CONTROL::recordPinValues(PinTypeInfo *pInfo)
+{
+    if (!logWriter.is_open()) return;
 
-        // Get lineEdit value
-        lineEditValue = (QLineEdit*) pin->itemAt(io_line_edit_pos)->widget();
+    QString line = QString::number(pInfo->pinType);
 
-        // Append pin value
-        *logStream << lineEditValue->text();
+    // Append each pin value (in pin order)
+    const Pin_Table *table = pin_store.get_table(pInfo->pinType);
+    int num_pins = table ? table->scaled.length() : 0;
+    for (int i = 0; i < num_pins; i++)
+    {
+        line += "," + QString::number(table->scaled.at(i));
     }
     // Add new line
-    *logStream << "\n";
+    line += "\n";
 
-    // Flush data to file
-    logStream->flush();
+    // Queue line (written & flushed by log writer)
+    if (!logWriter.write_text(line)) return;
 
     // Emit updated
     emit log_updated();
@@ -299,7 +442,16 @@ void GUI_IO_CONTROL::receive_gui(QByteArray recvData)
         return;
     }
 
+    // Take device time from end of values if flagged
     uint8_t minor_key = recvData.at(s1_minor_key_loc);
+    qint64 time_ms = -1;
+    if (minor_key & io_timestamp_flag)
+    {
+        minor_key &= ~io_timestamp_flag;
+        time_ms = take_device_time_ms(&recvData);
+        if (time_ms < 0) return;
+    }
+
     switch (minor_key)
     {
         case MINOR_KEY_IO_AIO_READ:
@@ -314,15 +466,14 @@ void GUI_IO_CONTROL::receive_gui(QByteArray recvData)
                 // Packet is a request so get pin values
                 uint32_t pinValue;
                 QByteArray pinValues;
-                QSlider *sliderValue;
 
                 // Get pin info
                 PinTypeInfo pInfo;
                 getPinTypeInfo(minor_key, &pInfo);
 
                 // Make sure pin valid
-                QHBoxLayout *pin;
-                if (!get_pin_layout(pInfo.pinType, pinNum, &pin))
+                int pos = pin_store.get_pos(pInfo.pinType, pinNum);
+                if (pos < 0)
                 {
                     // Exit out of parse
                     break;
@@ -331,11 +482,8 @@ void GUI_IO_CONTROL::receive_gui(QByteArray recvData)
                 // Append pin num to return array
                 pinValues.append(pinNum);
 
-                // Get slider value
-                sliderValue = (QSlider*) pin->itemAt(io_slider_pos)->widget();
-
                 // Get value
-                pinValue = sliderValue->value();
+                pinValue = pin_store.get_bounded_value(pInfo.pinType, pos);
 
                 // Parse value to uint16_t and append to pin values
                 pinValues.append(GUI_GENERIC_HELPER::uint32_to_byteArray(pinValue).right(2));
@@ -356,13 +504,13 @@ void GUI_IO_CONTROL::receive_gui(QByteArray recvData)
             if (minor_key == MINOR_KEY_IO_AIO_READ)
             {
                 // Verify GUI requested
-                if (!aio_read_pins.contains(pinNum)) break;
+                if (!aio_read_pins.testBit(pinNum)) break;
 
                 // Check if double request
-                if (aio_read_pins_double.contains(pinNum))
+                if (aio_read_pins_double.testBit(pinNum))
                 {
                     // Clear double
-                    aio_read_pins_double.removeAll(pinNum);
+                    aio_read_pins_double.clearBit(pinNum);
 
                     // Emit another request for data
                     emit transmit_chunk(local_gui_key, minor_key,
@@ -370,18 +518,18 @@ void GUI_IO_CONTROL::receive_gui(QByteArray recvData)
                 } else
                 {
                     // Clear single request
-                    aio_read_pins.removeAll(pinNum);
+                    aio_read_pins.clearBit(pinNum);
                 }
             } else if (minor_key == MINOR_KEY_IO_DIO_READ)
             {
                 // Verify GUI requested
-                if (!dio_read_pins.contains(pinNum)) break;
+                if (!dio_read_pins.testBit(pinNum)) break;
 
                 // Check if double request
-                if (dio_read_pins_double.contains(pinNum))
+                if (dio_read_pins_double.testBit(pinNum))
                 {
                     // Clear double
-                    dio_read_pins_double.removeAll(pinNum);
+                    dio_read_pins_double.clearBit(pinNum);
 
                     // Emit another request for data
                     emit transmit_chunk(local_gui_key, minor_key,
@@ -389,7 +537,7 @@ void GUI_IO_CONTROL::receive_gui(QByteArray recvData)
                 } else
                 {
                     // Clear single request
-                    dio_read_pins.removeAll(pinNum);
+                    dio_read_pins.clearBit(pinNum);
                 }
             }
 
@@ -402,30 +550,40 @@ void GUI_IO_CONTROL::receive_gui(QByteArray recvData)
         }
         case MINOR_KEY_IO_AIO_READ_ALL:
         case MINOR_KEY_IO_DIO_READ_ALL:
+        case MINOR_KEY_IO_AIO_READ_ALL_PACKED:
+        case MINOR_KEY_IO_DIO_READ_ALL_PACKED:
         {
+            // Unpack packed responses into read all format
+            QByteArray values = recvData.mid(s1_end_loc);
+            if (minor_key == MINOR_KEY_IO_AIO_READ_ALL_PACKED)
+            {
+                minor_key = MINOR_KEY_IO_AIO_READ_ALL;
+                values = unpack_read_all(MINOR_KEY_IO_AIO_READ_ALL_PACKED, values);
+            } else if (minor_key == MINOR_KEY_IO_DIO_READ_ALL_PACKED)
+            {
+                minor_key = MINOR_KEY_IO_DIO_READ_ALL;
+                values = unpack_read_all(MINOR_KEY_IO_DIO_READ_ALL_PACKED, values);
+            }
+
             // Check if request or respone
-            if (recvData.length() == num_s1_bytes)
+            // (requests may ask for a packed encoding, always answered unpacked)
+            if ((recvData.at(s1_minor_key_loc) == (char) minor_key)
+                    && (recvData.length() <= (num_s1_bytes+1)))
             {
                 // Packet is a request so get pin values
                 uint32_t pinValue;
                 QByteArray pinValues;
-                QSlider *sliderValue;
 
                 // Get pin info
                 PinTypeInfo pInfo;
                 getPinTypeInfo(minor_key, &pInfo);
 
                 // Parse all pin values
-                foreach (QHBoxLayout* pin, *pinMap.value(pInfo.pinType))
+                int num_pins = pin_store.get_num_pins(pInfo.pinType);
+                for (int pos = 0; pos < num_pins; pos++)
                 {
-                    // Make sure pin valid
-                    if (!pin) continue;
-
-                    // Get slider value
-                    sliderValue = (QSlider*) pin->itemAt(io_slider_pos)->widget();
-
                     // Get value
-                    pinValue = sliderValue->value();
+                    pinValue = pin_store.get_bounded_value(pInfo.pinType, pos);
 
                     // Parse value to uint16_t and append to pin values
                     pinValues.append(GUI_GENERIC_HELPER::uint32_to_byteArray(pinValue).right(2));
@@ -456,7 +614,7 @@ void GUI_IO_CONTROL::receive_gui(QByteArray recvData)
                     aio_read_requested_double = false;
 
                     // Emit another request for data
-                    emit transmit_chunk(local_gui_key, minor_key);
+                    emit transmit_chunk(local_gui_key, minor_key, get_read_all_request(minor_key));
                 } else
                 {
                     // Clear single request
@@ -474,7 +632,7 @@ void GUI_IO_CONTROL::receive_gui(QByteArray recvData)
                     dio_read_requested_double = false;
 
                     // Emit another request for data
-                    emit transmit_chunk(local_gui_key, minor_key);
+                    emit transmit_chunk(local_gui_key, minor_key, get_read_all_request(minor_key));
                 } else
                 {
                     // Clear single request
@@ -483,16 +641,46 @@ void GUI_IO_CONTROL::receive_gui(QByteArray recvData)
             }
 
             // Set values with minor key
-            setValues(minor_key, recvData.mid(s1_end_loc));
+            setValues(minor_key, values, time_ms);
             break;
         }
         case MINOR_KEY_IO_AIO_SET:
         case MINOR_KEY_IO_DIO_SET:
         case MINOR_KEY_IO_AIO_WRITE:
         case MINOR_KEY_IO_DIO_WRITE:
+        case MINOR_KEY_IO_AIO_READ_PINS:
+        case MINOR_KEY_IO_DIO_READ_PINS:
         {
             // Set values with minor key
-            setValues(minor_key, recvData.mid(s1_end_loc));
+            setValues(minor_key, recvData.mid(s1_end_loc), time_ms);
+            break;
+        }
+        case MINOR_KEY_IO_AIO_STREAM:
+        case MINOR_KEY_IO_DIO_STREAM:
+        {
+            // Ignore packets still in flight after a stop
+            if (!streaming) break;
+
+            // Set values with minor key
+            setValues(minor_key, recvData.mid(s1_end_loc), time_ms);
+            break;
+        }
+        case MINOR_KEY_IO_DIO_EVENTS:
+        {
+            // Ignore packets still in flight after a stop
+            if (!dio_events_active) break;
+
+            // Parse & set changed pins
+            parse_dio_events(recvData.mid(s1_end_loc));
+            break;
+        }
+        case MINOR_KEY_IO_AIO_BURST:
+        {
+            // Ignore frames not requested
+            if (!aio_burst_active) break;
+
+            // Parse & set sampled pins
+            parse_aio_burst(recvData.mid(s1_end_loc));
             break;
         }
         case MINOR_KEY_IO_REMOTE_CONN_CONNECTED:
@@ -571,6 +759,9 @@ void GUI_IO_CONTROL::receive_gui(QByteArray recvData)
             break;
         }
     }
+
+    // Refresh widgets of pins changed by this packet
+    flush_pin_widgets();
 }
 
 void GUI_IO_CONTROL::request_read_all(uint8_t pinType)
@@ -622,7 +813,135 @@ void GUI_IO_CONTROL::request_read_all(uint8_t pinType)
     }
 
     // Emit request for data
-    emit transmit_chunk(get_gui_key(), requestType);
+    emit transmit_chunk(get_gui_key(), requestType, get_read_all_request(pInfo.pinType));
+}
+
+void GUI_IO_CONTROL::request_read_pins(uint8_t pinType, QList<uint8_t> pin_nums)
+{
+    // Get pin info
+    PinTypeInfo pInfo;
+    if (!getPinTypeInfo(pinType, &pInfo)) return;
+    QBitArray *pending;
+    uint8_t requestType;
+    if (pInfo.pinType == MINOR_KEY_IO_AIO)
+    {
+        pending = &aio_read_pins;
+        requestType = MINOR_KEY_IO_AIO_READ_PINS;
+    } else if (pInfo.pinType == MINOR_KEY_IO_DIO)
+    {
+        pending = &dio_read_pins;
+        requestType = MINOR_KEY_IO_DIO_READ_PINS;
+    } else
+    {
+        return;
+    }
+
+    // Build mask of pins not already waiting for a response
+    // (covers every pin number, unlike stream masks)
+    QByteArray mask;
+    mask.fill(0, io_read_pins_max_mask_bytes);
+    foreach (uint8_t pin_num, pin_nums)
+    {
+        if (pending->testBit(pin_num)) continue;
+
+        mask[pin_num >> 3] = mask.at(pin_num >> 3) | (1 << (pin_num & 0x07));
+        pending->setBit(pin_num);
+    }
+
+    // Remove unused mask bytes
+    while (!mask.isEmpty() && !mask.at(mask.length()-1)) mask.chop(1);
+    if (mask.isEmpty()) return;
+
+    // Emit request for data [mask_len, mask...]
+    QByteArray data;
+    data.append((char) mask.length());
+    data.append(mask);
+    emit transmit_chunk(get_gui_key(), requestType, data);
+}
+
+void GUI_IO_CONTROL::request_stream(uint8_t pinType, uint32_t interval_ms)
+{
+    // Get pin info & table
+    PinTypeInfo pInfo;
+    if (!getPinTypeInfo(pinType, &pInfo)) return;
+    const Pin_Table *table = pin_store.get_table(pInfo.pinType);
+    if (!table) return;
+
+    // Build mask of input pins (empty if stopping)
+    QList<uint8_t> pins;
+    QByteArray mask;
+    interval_ms = qMin<uint32_t>(interval_ms, 0xFFFF);
+    if (interval_ms) mask = get_input_mask(pInfo.pinType, &pins);
+
+    // Save subscription (stream values arrive in pin order)
+    stream_pins.insert(pInfo.pinType, pins);
+    stream_intervals.insert(pInfo.pinType, interval_ms);
+
+    // Build subscribe [interval_high, interval_low, mask...]
+    QByteArray data;
+    data.append((char) ((interval_ms >> 8) & 0xFF));
+    data.append((char) (interval_ms & 0xFF));
+    data.append(mask);
+
+    // Send subscribe (stops stream if no pins)
+    if (pInfo.pinType == MINOR_KEY_IO_AIO)
+        emit transmit_chunk(get_gui_key(), MINOR_KEY_IO_AIO_STREAM, data);
+    else
+        emit transmit_chunk(get_gui_key(), MINOR_KEY_IO_DIO_STREAM, data);
+
+    // Keep polling pins past the stream mask
+    poll_unstreamed_pins(pInfo.pinType, interval_ms);
+}
+
+void GUI_IO_CONTROL::request_dio_events(uint32_t interval_ms)
+{
+    // Build mask of input pins (empty if stopping)
+    QByteArray mask;
+    interval_ms = qMin<uint32_t>(interval_ms, 0xFFFF);
+    if (interval_ms) mask = get_input_mask(MINOR_KEY_IO_DIO, nullptr);
+    dio_events_interval = interval_ms;
+
+    // Restart device clock tracking (unless burst or stream using it)
+    if (!(aio_burst_active || streaming)) device_clock.reset();
+
+    // Build subscribe [interval_high, interval_low, mask...]
+    QByteArray data;
+    data.append((char) ((interval_ms >> 8) & 0xFF));
+    data.append((char) (interval_ms & 0xFF));
+    data.append(mask);
+
+    // Send subscribe (device reports current values first)
+    emit transmit_chunk(get_gui_key(), MINOR_KEY_IO_DIO_EVENTS, data);
+
+    // Keep polling pins past the event mask
+    poll_unstreamed_pins(MINOR_KEY_IO_DIO, interval_ms);
+}
+
+void GUI_IO_CONTROL::request_aio_burst(uint32_t period_us, uint16_t num_samples)
+{
+    // Build mask of input pins (empty if aborting)
+    aio_burst_pins.clear();
+    QByteArray mask;
+    if (num_samples) mask = get_input_mask(MINOR_KEY_IO_AIO, &aio_burst_pins);
+    if (mask.isEmpty()) num_samples = 0;
+
+    // Restart device clock tracking (unless events or stream using it)
+    if (!(dio_events_active || streaming)) device_clock.reset();
+    aio_burst_active = (num_samples != 0);
+    aio_burst_late = false;
+
+    // Build request [period_us (4), num_samples (2), mask...]
+    QByteArray data;
+    data.append((char) ((period_us >> 24) & 0xFF));
+    data.append((char) ((period_us >> 16) & 0xFF));
+    data.append((char) ((period_us >> 8) & 0xFF));
+    data.append((char) (period_us & 0xFF));
+    data.append((char) ((num_samples >> 8) & 0xFF));
+    data.append((char) (num_samples & 0xFF));
+    data.append(mask);
+
+    // Send request (device may capture fewer samples than requested)
+    emit transmit_chunk(get_gui_key(), MINOR_KEY_IO_AIO_BURST, data);
 }
 
 void GUI_IO_CONTROL::request_read_pin(uint8_t pinType, uint8_t pinNum)
@@ -638,17 +957,14 @@ void GUI_IO_CONTROL::request_read_pin(uint8_t pinType, uint8_t pinNum)
         case MINOR_KEY_IO_AIO:
         {
             // Check if already waiting for a response
-            if (aio_read_pins.contains(pinNum))
+            if (aio_read_pins.testBit(pinNum))
             {
-                if (!aio_read_pins_double.contains(pinNum))
-                {
-                    aio_read_pins_double.append(pinNum);
-                }
+                aio_read_pins_double.setBit(pinNum);
                 return;
             }
 
             // Set requested and key
-            aio_read_pins.append(pinNum);
+            aio_read_pins.setBit(pinNum);
             requestType = MINOR_KEY_IO_AIO_READ;
 
             // Break out of selection
@@ -657,17 +973,14 @@ void GUI_IO_CONTROL::request_read_pin(uint8_t pinType, uint8_t pinNum)
         case MINOR_KEY_IO_DIO:
         {
             // Check if already waiting for a response
-            if (dio_read_pins.contains(pinNum))
+            if (dio_read_pins.testBit(pinNum))
             {
-                if (!dio_read_pins_double.contains(pinNum))
-                {
-                    dio_read_pins_double.append(pinNum);
-                }
+                dio_read_pins_double.setBit(pinNum);
                 return;
             }
 
             // Set requested and key
-            dio_read_pins.append(pinNum);
+            dio_read_pins.setBit(pinNum);
             requestType = MINOR_KEY_IO_DIO_READ;
 
             // Break out of selection
@@ -842,20 +1155,159 @@ void GUI_IO_CONTROL::AIO_LineEditValueChanged()
     emit transmit_chunk(get_gui_key(), MINOR_KEY_IO_AIO_WRITE, data);
 }
 
+void GUI_IO_CONTROL::virtualPinEdited(uint8_t pinType, int pos, int column, QVariant value)
+{
+    // Store edit (returns false if invalid)
+    if (!set_virtual_pin(pinType, pos, column, value)) return;
+    const Pin_Table *table = pin_store.get_table(pinType);
+
+    // Build pin data array (raw is the wire value)
+    QByteArray data;
+    uint16_t v = table->raw.at(pos);
+    data.append((char) table->pin_num.at(pos));     // Pin Num
+    data.append((char) ((v >> 8) & 0xFF));          // Value High
+    data.append((char) (v & 0xFF));                 // Value Low
+
+    // Send update (mode changes also send combo setting)
+    if (column == pin_model_mode_col)
+    {
+        // Update stream & event masks (only input pins are sent)
+        if (streaming) request_stream(pinType, stream_intervals.value(pinType));
+        if (dio_events_active && (pinType == MINOR_KEY_IO_DIO))
+            request_dio_events(dio_events_interval);
+
+        data.append((char) table->mode.at(pos));    // Combo setting
+        emit transmit_chunk(get_gui_key(),
+                            (pinType == MINOR_KEY_IO_AIO) ? MINOR_KEY_IO_AIO_SET : MINOR_KEY_IO_DIO_SET,
+                            data);
+    } else
+    {
+        emit transmit_chunk(get_gui_key(),
+                            (pinType == MINOR_KEY_IO_AIO) ? MINOR_KEY_IO_AIO_WRITE : MINOR_KEY_IO_DIO_WRITE,
+                            data);
+    }
+}
+
+void GUI_IO_CONTROL::logWriteError(QString msg)
+{
+    GUI_GENERIC_HELPER::showMessage(msg);
+}
+
+void GUI_IO_CONTROL::replayValues(uint8_t pinType, QList<uint8_t> pin_nums,
+                                  QVector<float> values, qint64 time_ms)
+{
+    // Get & verify table
+    const Pin_Table *table = pin_store.get_table(pinType);
+    if (!table) return;
+
+    // Set each value as if read from device (text logs are in pin order)
+    int pos, raw;
+    int num_vals = values.length();
+    for (int i = 0; i < num_vals; i++)
+    {
+        pos = pin_nums.isEmpty() ? i : pin_store.get_pos(pinType, pin_nums.at(i));
+        if ((pos < 0) || (table->raw.length() <= pos)) continue;
+
+        // Invert scaling of current mode
+        const RangeList &rList = table->range.at(pos);
+        raw = qRound((values.at(i) - rList.min) * rList.div);
+        set_pin_value(pinType, pos, (uint16_t) qBound(0, raw, 0xFFFF), time_ms);
+    }
+}
+
+void GUI_IO_CONTROL::replayTick(qint64)
+{
+    // Refresh changed pins once per replay batch
+    flush_pin_widgets();
+}
+
+void GUI_IO_CONTROL::replayDone()
+{
+    // Close log (pins keep last replayed values)
+    logReplay.close();
+    ui->StartReplay_Button->setText("Replay");
+    ui->REPLAY_Speed_LineEdit->setEnabled(true);
+}
+
 void GUI_IO_CONTROL::updateValues()
 {
     // Get caller to find request type
     QTimer *caller = (QTimer*) sender();
 
-    // Call request_read_all with correct pin type
-    if (caller == &AIO_READ) request_read_all(MINOR_KEY_IO_AIO);
-    else if (caller == &DIO_READ) request_read_all(MINOR_KEY_IO_DIO);
+    // Get pin type from caller
+    uint8_t pinType;
+    if (caller == &AIO_READ) pinType = MINOR_KEY_IO_AIO;
+    else if (caller == &DIO_READ) pinType = MINOR_KEY_IO_DIO;
+    else return;
+
+    // Only read pins streams & events can't cover while they run
+    if (streaming || (dio_events_active && (pinType == MINOR_KEY_IO_DIO)))
+        request_read_pins(pinType, get_unstreamed_pins(pinType));
+    else
+        request_read_all(pinType);
+}
+
+void GUI_IO_CONTROL::updateScheduledValues()
+{
+    // Setup variables
+    qint64 now_ms = QDateTime::currentMSecsSinceEpoch();
+    const Pin_Table *table;
+    QBitArray *pending;
+    QBitArray busy, due;
+    QList<uint8_t> pin_nums;
+    int num_inputs;
+
+    // Request due pins of each type
+    foreach (uint8_t pinType, QList<uint8_t>({MINOR_KEY_IO_DIO, MINOR_KEY_IO_AIO}))
+    {
+        // Get table & outstanding reads
+        table = pin_store.get_table(pinType);
+        if (!table) continue;
+        pending = (pinType == MINOR_KEY_IO_AIO) ? &aio_read_pins : &dio_read_pins;
+
+        // Get due pins (skipping pins still waiting for a response)
+        busy.fill(false, table->pin_num.length());
+        for (int pos = 0; pos < table->pin_num.length(); pos++)
+        {
+            if (pending->testBit(table->pin_num.at(pos))) busy.setBit(pos);
+        }
+        due = pin_scheduler.take_due(pinType, now_ms, busy);
+
+        // Only read input pins
+        pin_nums.clear();
+        num_inputs = 0;
+        for (int pos = 0; pos < due.size(); pos++)
+        {
+            if (!table->input.at(pos)) continue;
+            num_inputs += 1;
+            if (due.testBit(pos)) pin_nums.append(table->pin_num.at(pos));
+        }
+        if (pin_nums.isEmpty()) continue;
+
+        // Read all if every input due (can be packed), else only due pins
+        if (pin_nums.length() == num_inputs) request_read_all(pinType);
+        else request_read_pins(pinType, pin_nums);
+    }
+
+    // Wait for next due pin
+    qint64 next_ms = pin_scheduler.get_next_due();
+    if (0 <= next_ms)
+    {
+        PIN_SCHEDULE.start((int) qMax<qint64>(0, next_ms - QDateTime::currentMSecsSinceEpoch()));
+    }
 }
 
 void GUI_IO_CONTROL::recordLogData()
 {
     if (!logIsRecording) return;
 
+    // Binary logs write every pin as one record
+    if (binary_log)
+    {
+        recordBinaryValues();
+        return;
+    }
+
     PinTypeInfo pInfo;
     if (getPinTypeInfo(MINOR_KEY_IO_AIO_READ_ALL, &pInfo)) recordPinValues(&pInfo);
     if (getPinTypeInfo(MINOR_KEY_IO_DIO_READ_ALL, &pInfo)) recordPinValues(&pInfo);
@@ -866,8 +1318,43 @@ void GUI_IO_CONTROL::on_StartUpdater_Button_clicked()
 {
     ui->StartUpdater_Button->setText("Reset");
 
-    DIO_READ.start((int) (GUI_GENERIC_HELPER::S2MS * ui->DIO_UR_LineEdit->text().toFloat()));
-    AIO_READ.start((int) (GUI_GENERIC_HELPER::S2MS * ui->AIO_UR_LineEdit->text().toFloat()));
+    // Get update rates
+    int dio_ms = (int) (GUI_GENERIC_HELPER::S2MS * ui->DIO_UR_LineEdit->text().toFloat());
+    int aio_ms = (int) (GUI_GENERIC_HELPER::S2MS * ui->AIO_UR_LineEdit->text().toFloat());
+
+    // Subscribe to dio change events (replaces dio updates)
+    // DIO rate sets how long the device may hold events
+    if (dio_events)
+    {
+        dio_events_active = true;
+        request_dio_events(qMax(1, dio_ms));
+    }
+
+    // Subscribe to device streams instead of polling
+    if (stream_updates)
+    {
+        streaming = true;
+        if (!dio_events) request_stream(MINOR_KEY_IO_DIO, qMax(1, dio_ms));
+        request_stream(MINOR_KEY_IO_AIO, qMax(1, aio_ms));
+        return;
+    }
+
+    // Poll types with per pin rates through the schedule
+    // (pins without own rate use the type rate)
+    bool dio_scheduled = !dio_events && pin_scheduler.has_rates(MINOR_KEY_IO_DIO);
+    bool aio_scheduled = pin_scheduler.has_rates(MINOR_KEY_IO_AIO);
+    pin_scheduler.set_default_rate(MINOR_KEY_IO_DIO, qMax(0, dio_ms));
+    pin_scheduler.set_default_rate(MINOR_KEY_IO_AIO, qMax(0, aio_ms));
+    pin_scheduler.set_enabled(MINOR_KEY_IO_DIO, dio_scheduled);
+    pin_scheduler.set_enabled(MINOR_KEY_IO_AIO, aio_scheduled);
+    if (dio_scheduled || aio_scheduled)
+    {
+        pin_scheduler.start(QDateTime::currentMSecsSinceEpoch());
+        updateScheduledValues();
+    }
+
+    if (!dio_events && !dio_scheduled) DIO_READ.start(dio_ms);
+    if (!aio_scheduled) AIO_READ.start(aio_ms);
 }
 
 void GUI_IO_CONTROL::on_StopUpdater_Button_clicked()
@@ -875,6 +1362,22 @@ void GUI_IO_CONTROL::on_StopUpdater_Button_clicked()
     // Stop timers
     DIO_READ.stop();
     AIO_READ.stop();
+    PIN_SCHEDULE.stop();
+
+    // Stop device streams
+    if (streaming)
+    {
+        streaming = false;
+        request_stream(MINOR_KEY_IO_DIO, 0);
+        request_stream(MINOR_KEY_IO_AIO, 0);
+    }
+
+    // Stop dio events
+    if (dio_events_active)
+    {
+        dio_events_active = false;
+        request_dio_events(0);
+    }
 
     // Set button text
     ui->StartUpdater_Button->setText("Start");
@@ -882,8 +1385,8 @@ void GUI_IO_CONTROL::on_StopUpdater_Button_clicked()
     // Clear double requests
     dio_read_requested_double = false;
     aio_read_requested_double = false;
-    dio_read_pins_double.clear();
-    aio_read_pins_double.clear();
+    dio_read_pins_double.fill(false, io_max_pins);
+    aio_read_pins_double.fill(false, io_max_pins);
 }
 
 void GUI_IO_CONTROL::on_LogSaveLocSelect_Button_clicked()
@@ -903,21 +1406,39 @@ void GUI_IO_CONTROL::on_StartLog_Button_clicked()
         error = GUI_GENERIC_HELPER::showMessage("Error: Must provide log file!");
     if (error) return;
 
-    uint32_t enumFlags = QIODevice::WriteOnly;
-    if (ui->AppendLog_CheckBox->isChecked()) enumFlags |= QIODevice::Append;
-    else enumFlags |= QIODevice::Truncate;
-
-    if (logFile) delete logFile;
-    logFile = new QFile(ui->LogSaveLoc_LineEdit->text());
-    if (!logFile->open((QIODevice::OpenModeFlag) enumFlags))
-        error = GUI_GENERIC_HELPER::showMessage("Error: Couldn't open log file!");
-    if (error) return;
+    if (binary_log)
+    {
+        // Binary log columns (AIO then DIO, header keeps each pin's range)
+        QList<Pin_Log_Column> columns;
+        const Pin_Table *table;
+        foreach (uint8_t pinType, QList<uint8_t>({MINOR_KEY_IO_AIO, MINOR_KEY_IO_DIO}))
+        {
+            table = pin_store.get_table(pinType);
+            if (!table) continue;
+            for (int pos = 0; pos < table->pin_num.length(); pos++)
+            {
+                columns.append(Pin_Log_Column{.pinType=pinType, .pin_num=table->pin_num.at(pos),
+                                              .mode=table->mode.at(pos), .range=table->range.at(pos)});
+            }
+        }
 
-    if (logStream) delete logStream;
-    logStream = new QTextStream(logFile);
-    *logStream << "Started: " << QDateTime::currentDateTimeUtc().toString() << " ";
-    *logStream << "with update rate " << ui->LOG_UR_LineEdit->text() << " seconds\n";
-    logStream->flush();
+        // Create log (binary logs are never appended to)
+        if (!logWriter.open_binary(ui->LogSaveLoc_LineEdit->text(), columns))
+        {
+            GUI_GENERIC_HELPER::showMessage("Error: Couldn't open log file!");
+            return;
+        }
+    } else
+    {
+        // Start line is repeated at the top of each segment
+        QString header = "Started: " + QDateTime::currentDateTimeUtc().toString() + " ";
+        header += "with update rate " + ui->LOG_UR_LineEdit->text() + " seconds\n";
+
+        if (!logWriter.open_text(ui->LogSaveLoc_LineEdit->text(),
+                                 ui->AppendLog_CheckBox->isChecked(), header))
+            error = GUI_GENERIC_HELPER::showMessage("Error: Couldn't open log file!");
+        if (error) return;
+    }
 
     logTimer.start((int) (GUI_GENERIC_HELPER::S2MS * ui->LOG_UR_LineEdit->text().toFloat()));
     ui->StartLog_Button->setText("Running");
@@ -932,12 +1453,9 @@ void GUI_IO_CONTROL::on_StopLog_Button_clicked()
     if (!logIsRecording) return;
     logTimer.stop();
 
-    logStream->flush();
-    logFile->close();
-    delete logStream;
-    delete logFile;
-    logStream = NULL;
-    logFile = NULL;
+    // Write queued rows & close (writer compresses & exports CSV copies
+    // in its own thread, errors reported through write_error)
+    logWriter.stop();
 
     ui->StartLog_Button->setText("Start Log");
     ui->StartLog_Button->setEnabled(true);
@@ -946,6 +1464,56 @@ void GUI_IO_CONTROL::on_StopLog_Button_clicked()
     logIsRecording = false;
 }
 
+void GUI_IO_CONTROL::on_StartReplay_Button_clicked()
+{
+    // Pause running replay (speed can change before resuming)
+    if (logReplay.is_running())
+    {
+        logReplay.pause();
+        ui->StartReplay_Button->setText("Resume");
+        ui->REPLAY_Speed_LineEdit->setEnabled(true);
+        return;
+    }
+
+    // Get speed (0 replays as fast as possible)
+    bool ok = false;
+    double speed = ui->REPLAY_Speed_LineEdit->text().toDouble(&ok);
+
+    bool error = false;
+    if (!ok || (speed < 0))
+        error = GUI_GENERIC_HELPER::showMessage("Error: Invalid replay speed!");
+    else if (!logReplay.is_open() && ui->LogSaveLoc_LineEdit->text().isEmpty())
+        error = GUI_GENERIC_HELPER::showMessage("Error: Must provide log file!");
+    else if (!logReplay.is_open() && logIsRecording)
+        error = GUI_GENERIC_HELPER::showMessage("Error: Stop log before replaying!");
+    if (error) return;
+
+    // Open log on first start (after writer finishes last segment)
+    if (!logReplay.is_open())
+    {
+        logWriter.close();
+        if (!logReplay.open(ui->LogSaveLoc_LineEdit->text(), {MINOR_KEY_IO_AIO, MINOR_KEY_IO_DIO}))
+        {
+            GUI_GENERIC_HELPER::showMessage("Error: Couldn't open log file!");
+            return;
+        }
+
+        // Replayed values replace device reads
+        on_StopUpdater_Button_clicked();
+    }
+
+    // Run clock
+    ui->StartReplay_Button->setText("Pause");
+    ui->REPLAY_Speed_LineEdit->setEnabled(false);
+    logReplay.start(speed);
+}
+
+void GUI_IO_CONTROL::on_StopReplay_Button_clicked()
+{
+    if (!logReplay.is_open()) return;
+    replayDone();
+}
+
 void GUI_IO_CONTROL::on_ConnConnect_Button_clicked()
 {
     // Holder for connection info (if connecting)
@@ -1027,10 +1595,11 @@ void GUI_IO_CONTROL::on_CreatePlots_Button_clicked()
             chart_view, SLOT(close()),
             Qt::QueuedConnection);
 
-    // Connect chart view update request
-    connect(chart_view, SIGNAL(update_request(QList<QString>,GUI_CHART_ELEMENT*)),
-            this, SLOT(chart_update_request(QList<QString>,GUI_CHART_ELEMENT*)),
-            Qt::QueuedConnection);
+    // Connect chart view subscriptions
+    // (direct so chart is still valid when subscribed)
+    connect(chart_view, SIGNAL(subscribe_request(QList<QString>,int,GUI_CHART_ELEMENT*)),
+            this, SLOT(chart_subscribe_request(QList<QString>,int,GUI_CHART_ELEMENT*)),
+            Qt::DirectConnection);
 
     // Connect pin update signals to plot update
     connect(this, SIGNAL(pin_update(QStringList)),
@@ -1056,6 +1625,7 @@ void GUI_IO_CONTROL::inputsChanged(uint8_t pinType, QObject *caller, uint8_t io_
     // Get pin info of button clicked
     QHBoxLayout *pin;
     if (!get_widget_layout(pInfo.pinType, (QWidget*) caller, &pin)) return;
+    int pos = get_pin_pos(pInfo.pinType, pin);
 
     // Get widgets
     QLabel *label = (QLabel*) pin->itemAt(io_label_pos)->widget();
@@ -1075,7 +1645,6 @@ void GUI_IO_CONTROL::inputsChanged(uint8_t pinType, QObject *caller, uint8_t io_
 
     // Set IO if combo changed
     float newVAL;
-    bool prev_block_status;
     switch (io_pos)
     {
         case io_combo_pos:
@@ -1088,6 +1657,14 @@ void GUI_IO_CONTROL::inputsChanged(uint8_t pinType, QObject *caller, uint8_t io_
             // Update slider range (will reset slider value)
             updateSliderRange(sliderValue, rList);
 
+            // Store new mode
+            pin_store.set_mode(pInfo.pinType, pos, io_combo, *rList, disableClicks);
+
+            // Update stream & event masks (only input pins are sent)
+            if (streaming) request_stream(pInfo.pinType, stream_intervals.value(pInfo.pinType));
+            if (dio_events_active && (pInfo.pinType == MINOR_KEY_IO_DIO))
+                request_dio_events(dio_events_interval);
+
             // Fall through to next case to update info
         }
         case io_slider_pos:
@@ -1096,10 +1673,9 @@ void GUI_IO_CONTROL::inputsChanged(uint8_t pinType, QObject *caller, uint8_t io_
             newVAL = ((float) sliderValue->value()) / rList->div;
             if (pInfo.pinType == MINOR_KEY_IO_DIO) newVAL = qRound(newVAL);
 
-            // Update lineEdit value
-            prev_block_status = lineEditValue->blockSignals(true);
-            lineEditValue->setText(QString::number(newVAL));
-            lineEditValue->blockSignals(prev_block_status);
+            // Store value & update widgets from store
+            pin_store.set_value(pInfo.pinType, pos, sliderValue->value(), newVAL);
+            update_pin_widgets(pInfo.pinType, pos);
             break;
         }
         case io_line_edit_pos:
@@ -1108,10 +1684,13 @@ void GUI_IO_CONTROL::inputsChanged(uint8_t pinType, QObject *caller, uint8_t io_
             newVAL = rList->div * lineEditValue->text().toFloat();
             if (pInfo.pinType == MINOR_KEY_IO_DIO) newVAL = qRound(newVAL);
 
-            // Update slider value
-            prev_block_status = sliderValue->blockSignals(true);
-            sliderValue->setValue(newVAL);
-            sliderValue->blockSignals(prev_block_status);
+            // Store value & update widgets from store
+            // (DIO shows the rounded value, AIO what was entered)
+            pin_store.set_value(pInfo.pinType, pos, (int) newVAL,
+                                (pInfo.pinType == MINOR_KEY_IO_DIO) ?
+                                    (double) (((float) ((int) newVAL)) / rList->div)
+                                  : lineEditValue->text().toDouble());
+            update_pin_widgets(pInfo.pinType, pos);
             break;
         }
         default:
@@ -1220,34 +1799,7 @@ void GUI_IO_CONTROL::setPinCombos(PinTypeInfo *pInfo, QList<QString> combos)
         if (comboStr_split.length() != 2) continue;
 
         // Generate pin list to apply values to
-        foreach (QString pinNum, comboStr_split.at(0).split(','))
-        {
-            // See if defines a range
-            if (pinNum.contains(':'))
-            {
-                // Split range list
-                QStringList numStr_split = pinNum.split(':');
-                if (numStr_split.length() != 2) continue;
-
-                // Get start and end of range
-                uint8_t start_pin = numStr_split.at(0).toInt();
-                uint8_t end_pin = numStr_split.at(1).toInt();
-
-                // Add each element to the list
-                for (uint8_t curr_pin = start_pin; curr_pin <= end_pin; curr_pin++)
-                {
-                    pinNums.append(curr_pin);
-                }
-            } else
-            {
-                // Convert value to int an verify
-                uint8_t p = pinNum.toInt();
-                if ((p == 0) && (pinNum.at(0) != '0')) continue;
-
-                // Add the pin to the list
-                pinNums.append(p);
-            }
-        }
+        pinNums = parsePinNums(comboStr_split.at(0));
 
         // Get combo values
         listValues = comboStr_split.at(1).split(',');
@@ -1310,26 +1862,172 @@ void GUI_IO_CONTROL::setPinCombos(PinTypeInfo *pInfo, QList<QString> combos)
     }
 }
 
-void GUI_IO_CONTROL::addPinType(uint8_t pinType)
+void GUI_IO_CONTROL::setPinRates(PinTypeInfo *pInfo, QList<QString> rates)
 {
-    // Add new pinType to each map
-    if (!pinMap.contains(pinType)) pinMap.insert(pinType, new QList<QHBoxLayout*>());
-    if (!controlMap.contains(pinType)) controlMap.insert(pinType, new QMap<QString, uint8_t>());
-    if (!disabledValueSet.contains(pinType)) disabledValueSet.insert(pinType, new QList<uint8_t>());
-    if (!rangeMap.contains(pinType)) rangeMap.insert(pinType, new QMap<uint8_t, RangeList*>());
+    // Each entry is "pins=seconds" (pins as in pin settings)
+    QStringList rateStr_split;
+    uint32_t period_ms;
+    foreach (QString rateStr, rates)
+    {
+        // Parse & verify rate
+        rateStr_split = rateStr.split('=');
+        if (rateStr_split.length() != 2) continue;
+        period_ms = (uint32_t) (GUI_GENERIC_HELPER::S2MS * rateStr_split.at(1).toFloat());
+        if (!period_ms) continue;
+
+        // Set rate for each existing pin
+        foreach (uint8_t pin_num, parsePinNums(rateStr_split.at(0)))
+        {
+            pin_scheduler.set_rate(pInfo->pinType, pin_store.get_pos(pInfo->pinType, pin_num), period_ms);
+        }
+    }
 }
 
-void GUI_IO_CONTROL::addPinLayout(QHBoxLayout *pin, QList<QHBoxLayout *> *pins)
+QList<uint8_t> GUI_IO_CONTROL::parsePinNums(QString pinNumsStr)
 {
-    // Get insert pin number
-    int insert_pin_num = ((QLabel*) pin->itemAt(io_label_pos)->widget())->text().toInt();
-
-    // Find insertion position (assume pins inserted in order until now)
-    int curr_pin_num;
-    for (int i = (pins->length()-1); 0 <= i; i--)
+    // Parse comma separated pins & ranges (e.g. "0,2:5")
+    QList<uint8_t> pinNums;
+    foreach (QString pinNum, pinNumsStr.split(','))
     {
-        // Get current pin number
-        curr_pin_num = ((QLabel*) pins->at(i)->itemAt(io_label_pos)->widget())->text().toInt();
+        // See if defines a range
+        if (pinNum.contains(':'))
+        {
+            // Split range list
+            QStringList numStr_split = pinNum.split(':');
+            if (numStr_split.length() != 2) continue;
+
+            // Get start and end of range
+            uint8_t start_pin = numStr_split.at(0).toInt();
+            uint8_t end_pin = numStr_split.at(1).toInt();
+
+            // Add each element to the list
+            // (int counter so a range ending at 255 terminates)
+            for (int curr_pin = start_pin; curr_pin <= end_pin; curr_pin++)
+            {
+                pinNums.append((uint8_t) curr_pin);
+            }
+        } else
+        {
+            // Convert value to int an verify
+            uint8_t p = pinNum.toInt();
+            if (pinNum.isEmpty() || ((p == 0) && (pinNum.at(0) != '0'))) continue;
+
+            // Add the pin to the list
+            pinNums.append(p);
+        }
+    }
+
+    return pinNums;
+}
+
+bool GUI_IO_CONTROL::setVirtualPins(PinTypeInfo *pInfo, QList<QString> combos)
+{
+    // Retrieve & verify pin type maps
+    QList<QHBoxLayout*> *pins = pinMap.value(pInfo->pinType);
+    QMap<QString, uint8_t> *pinControlMap = controlMap.value(pInfo->pinType);
+    if (!(pins && pinControlMap)) return false;
+
+    // Collect combos for each pin (ordered by pin number)
+    QMap<uint8_t, QStringList> pin_combos;
+    QStringList comboStr_split;
+    foreach (QString comboStr, combos)
+    {
+        comboStr_split = comboStr.split('=');
+        if (comboStr_split.length() != 2) continue;
+        foreach (uint8_t pin, parsePinNums(comboStr_split.at(0)))
+        {
+            pin_combos.insert(pin, comboStr_split.at(1).split(','));
+        }
+    }
+
+    // Keep pin widgets if at or below threshold
+    if (pin_combos.size() <= virtual_pin_threshold)
+    {
+        destroy_virtual_pins(pInfo->pinType);
+        return false;
+    }
+
+    // Remove any pin widgets
+    foreach (QHBoxLayout *pin, *pins)
+    {
+        destroy_pin(pin);
+    }
+    pins->clear();
+
+    // Set store layout
+    QList<uint8_t> pin_nums = pin_combos.keys();
+    pin_store.set_pins(pInfo->pinType, pin_nums);
+    pin_history.set_pins(pInfo->pinType, pin_nums.length());
+    pin_scheduler.set_pins(pInfo->pinType, pin_nums.length());
+
+    // Create model & view on first use
+    GUI_PIN_MODEL *model = pin_models.value(pInfo->pinType);
+    if (!model)
+    {
+        model = new GUI_PIN_MODEL(pInfo->pinType, &pin_store, this);
+        QTableView *view = new QTableView(this);
+        view->setModel(model);
+        view->setItemDelegate(new GUI_PIN_DELEGATE(view));
+        view->setEditTriggers(QAbstractItemView::DoubleClicked
+                              | QAbstractItemView::SelectedClicked
+                              | QAbstractItemView::EditKeyPressed);
+
+        // Fixed row height (view never measures rows it is not showing)
+        view->verticalHeader()->hide();
+        view->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+        view->verticalHeader()->setDefaultSectionSize(20);
+        view->horizontalHeader()->setStretchLastSection(true);
+
+        // Add view across the grid
+        pInfo->grid->addWidget(view, 0, 0, 1, pInfo->cols);
+
+        // Connect edits (internal object so direct is okay)
+        connect(model, SIGNAL(pin_edited(uint8_t,int,int,QVariant)),
+                this, SLOT(virtualPinEdited(uint8_t,int,int,QVariant)),
+                Qt::DirectConnection);
+
+        pin_models.insert(pInfo->pinType, model);
+        pin_views.insert(pInfo->pinType, view);
+    }
+    model->set_pins(pin_combos.values(), *pinControlMap);
+
+    // Set pinType_str prepend
+    QString pinType_str;
+    if (pInfo->pinType == MINOR_KEY_IO_AIO) pinType_str = "AIO_";
+    else if (pInfo->pinType == MINOR_KEY_IO_DIO) pinType_str = "DIO_";
+    else pinType_str = "_";
+
+    // Set each pin to its first combo & add to pinList
+    int num_pins = pin_nums.length();
+    for (int pos = 0; pos < num_pins; pos++)
+    {
+        set_virtual_pin(pInfo->pinType, pos, pin_model_mode_col, model->get_combo(pos, 0));
+        pinList.append(pinType_str + QString("%1").arg(pin_nums.at(pos), 2, 10, QChar('0')));
+    }
+
+    return true;
+}
+
+void GUI_IO_CONTROL::addPinType(uint8_t pinType)
+{
+    // Add new pinType to each map
+    if (!pinMap.contains(pinType)) pinMap.insert(pinType, new QList<QHBoxLayout*>());
+    if (!controlMap.contains(pinType)) controlMap.insert(pinType, new QMap<QString, uint8_t>());
+    if (!disabledValueSet.contains(pinType)) disabledValueSet.insert(pinType, new QList<uint8_t>());
+    if (!rangeMap.contains(pinType)) rangeMap.insert(pinType, new QMap<uint8_t, RangeList*>());
+}
+
+void GUI_IO_CONTROL::addPinLayout(QHBoxLayout *pin, QList<QHBoxLayout *> *pins)
+{
+    // Get insert pin number
+    int insert_pin_num = ((QLabel*) pin->itemAt(io_label_pos)->widget())->text().toInt();
+
+    // Find insertion position (assume pins inserted in order until now)
+    int curr_pin_num;
+    for (int i = (pins->length()-1); 0 <= i; i--)
+    {
+        // Get current pin number
+        curr_pin_num = ((QLabel*) pins->at(i)->itemAt(io_label_pos)->widget())->text().toInt();
 
         // Check if less than inserted pin
         if (curr_pin_num < insert_pin_num)
@@ -1433,25 +2131,20 @@ void GUI_IO_CONTROL::addPinRangeMap(uint8_t pinType, QList<QString> keys, QList<
     }
 }
 
-void GUI_IO_CONTROL::setValues(uint8_t minorKey, QByteArray values)
+void GUI_IO_CONTROL::setValues(uint8_t minorKey, QByteArray values, qint64 time_ms)
 {
     // Get pin information
     PinTypeInfo pInfo;
     if (!getPinTypeInfo(minorKey, &pInfo)) return;
 
-    // Get & verify maps
-    QMap<QString, uint8_t> *pinControlMap = controlMap.value(pInfo.pinType);
-    QMap<uint8_t, RangeList*> *pinRangeMap = rangeMap.value(pInfo.pinType);
-    QList<uint8_t> *pinDisabledSet = disabledValueSet.value(pInfo.pinType);
-    if (!(pinControlMap && pinRangeMap && pinDisabledSet)) return;
+    // Get & verify pin table & layouts
+    const Pin_Table *table = pin_store.get_table(pInfo.pinType);
+    QList<QHBoxLayout*> *pins = pinMap.value(pInfo.pinType);
+    if (!(table && pins)) return;
 
     // Allocate loop variables
-    QHBoxLayout *pin = nullptr;
-    QComboBox *comboBox = nullptr;
-    RangeList *rList = nullptr;
-    uint8_t combo_value;
+    int pos = -1;
     uint16_t value;
-    int newVAL;
 
     // Set loop values
     uint8_t pin_num = 0;
@@ -1465,20 +2158,16 @@ void GUI_IO_CONTROL::setValues(uint8_t minorKey, QByteArray values)
         {
             // Setup variables
             uint8_t i = 0, j = 0;
-            QList<QHBoxLayout*> *pins = pinMap.value(pInfo.pinType);
+            int num_pins = table->pin_num.length();
 
             // Verify values
-            if (!pins || ((2*pins->length()) != val_len)) break;
+            if ((2*num_pins) != values.length()) break;
 
             // Loop over all pins and set their value
-            foreach (pin, *pins)
+            for (pos = 0; pos < num_pins; pos++)
             {
-                // Get combo
-                comboBox = (QComboBox*) pin->itemAt(io_combo_pos)->widget();
-                combo_value = pinControlMap->value(comboBox->currentText());
-
                 // Only update value if not controllable
-                if (pinDisabledSet->contains(combo_value))
+                if (table->input.at(pos))
                 {
                     // Get value from list (value is big endian)
                     value = 0;
@@ -1487,15 +2176,8 @@ void GUI_IO_CONTROL::setValues(uint8_t minorKey, QByteArray values)
                         value = (value << 8) | ((uchar) values.at(i+j));
                     }
 
-                    // Scale value
-                    rList = pinRangeMap->value(combo_value);
-                    newVAL = qRound((float) value + (rList->min * rList->div));
-
-                    // Set slider
-                    set_pin_io(pin, io_slider_pos, newVAL);
-
-                    // Set lineEdit
-                    set_pin_io(pin, io_line_edit_pos, QString::number(((float) newVAL) / rList->div));
+                    // Store value & update widgets
+                    set_pin_value(pInfo.pinType, pos, value, time_ms);
                 }
 
                 // Move to next pin
@@ -1505,6 +2187,77 @@ void GUI_IO_CONTROL::setValues(uint8_t minorKey, QByteArray values)
             // Leave parse loop
             break;
         }
+        // If stream data
+        case MINOR_KEY_IO_AIO_STREAM:
+        case MINOR_KEY_IO_DIO_STREAM:
+        {
+            // Values are for the subscribed pins (in pin order)
+            QList<uint8_t> pin_nums = stream_pins.value(pInfo.pinType);
+            int num_pins = pin_nums.length();
+
+            // Verify values (mask may have changed while in flight)
+            if ((bytesPerPin*num_pins) != values.length()) break;
+
+            // Loop over streamed pins and set their value
+            for (int i = 0; i < num_pins; i++)
+            {
+                // Only update value if not controllable
+                pos = pin_store.get_pos(pInfo.pinType, pin_nums.at(i));
+                if ((pos < 0) || !table->input.at(pos)) continue;
+
+                // Get value from list (value is big endian)
+                value = ((uint16_t) ((uchar) values.at(bytesPerPin*i)) << 8) | ((uchar) values.at(bytesPerPin*i + 1));
+
+                // Store value & update widgets
+                set_pin_value(pInfo.pinType, pos, value, time_ms);
+            }
+
+            // Leave parse loop
+            break;
+        }
+        // If read pins data
+        case MINOR_KEY_IO_AIO_READ_PINS:
+        case MINOR_KEY_IO_DIO_READ_PINS:
+        {
+            // Formatted as [mask_len, mask..., values...]
+            if (values.length() < s2_io_read_pins_mask_loc) break;
+            int mask_len = (uchar) values.at(s2_io_read_pins_mask_len_loc);
+            if ((io_read_pins_max_mask_bytes < mask_len)
+                    || (values.length() < (s2_io_read_pins_mask_loc + mask_len)))
+            {
+                break;
+            }
+            const uchar *mask = (const uchar*) values.constData() + s2_io_read_pins_mask_loc;
+
+            // Get masked pins & verify values
+            QList<uint8_t> pin_nums;
+            for (int i = 0; i < (mask_len << 3); i++)
+            {
+                if (mask[i >> 3] & (1 << (i & 0x07))) pin_nums.append(i);
+            }
+            int read_len = s2_io_read_pins_mask_loc + mask_len + (bytesPerPin * pin_nums.length());
+            if (values.length() != read_len) break;
+
+            // Clear outstanding reads
+            QBitArray *pending = (pInfo.pinType == MINOR_KEY_IO_AIO) ? &aio_read_pins : &dio_read_pins;
+            foreach (uint8_t read_pin, pin_nums) pending->clearBit(read_pin);
+
+            // Set each read pin
+            const uchar *read_value = mask + mask_len;
+            foreach (uint8_t read_pin, pin_nums)
+            {
+                // Only update value if not controllable
+                pos = pin_store.get_pos(pInfo.pinType, read_pin);
+                if ((0 <= pos) && table->input.at(pos))
+                {
+                    set_pin_value(pInfo.pinType, pos, qFromBigEndian<quint16>(read_value), time_ms);
+                }
+                read_value += bytesPerPin;
+            }
+
+            // Leave parse loop
+            break;
+        }
         // If set pin data
         case MINOR_KEY_IO_AIO_SET:
         case MINOR_KEY_IO_DIO_SET:
@@ -1514,15 +2267,32 @@ void GUI_IO_CONTROL::setValues(uint8_t minorKey, QByteArray values)
             if (val_len != 4) break;
             pin_num = values.at(s2_io_pin_num_loc);
 
-            // Find pin layout on GUI
-            if (!get_pin_layout(pInfo.pinType, pin_num, &pin)) break;
+            // Find pin position
+            pos = pin_store.get_pos(pInfo.pinType, pin_num);
+            if (pos < 0) break;
 
-            // Set new combo
-            set_pin_io(pin, io_combo_pos, values.at(s2_io_combo_loc));
+            if (pin_models.contains(pInfo.pinType))
+            {
+                // Set new mode from the row combos (updates stored mode)
+                if (!set_virtual_pin(pInfo.pinType, pos, pin_model_mode_col,
+                                     pin_models.value(pInfo.pinType)->get_combo(pos, values.at(s2_io_combo_loc))))
+                {
+                    break;
+                }
 
-            // Propogate combo value update
-            comboBox = (QComboBox*) pin->itemAt(io_combo_pos)->widget();
-            inputsChanged(pInfo.pinType, comboBox, io_combo_pos);
+                // Update stream & event masks (only input pins are sent)
+                if (streaming) request_stream(pInfo.pinType, stream_intervals.value(pInfo.pinType));
+                if (dio_events_active && (pInfo.pinType == MINOR_KEY_IO_DIO))
+                    request_dio_events(dio_events_interval);
+            } else
+            {
+                // Set new combo
+                QHBoxLayout *pin = pins->at(pos);
+                set_pin_io(pin, io_combo_pos, values.at(s2_io_combo_loc));
+
+                // Propogate combo value update (updates stored mode)
+                inputsChanged(pInfo.pinType, pin->itemAt(io_combo_pos)->widget(), io_combo_pos);
+            }
 
             // Subtract one from val_len (combo pos)
             // and fall through to set value
@@ -1540,13 +2310,9 @@ void GUI_IO_CONTROL::setValues(uint8_t minorKey, QByteArray values)
             pin_num = values.at(s2_io_pin_num_loc);
             value = ((uint16_t) values.at(s2_io_value_high_loc) << 8) | ((uchar) values.at(s2_io_value_low_loc));
 
-            // Find pin layout on GUI (if not already found)
+            // Find pin position (if not already found)
             // Break out of parse if not found
-            if (!pin && !get_pin_layout(pInfo.pinType, pin_num, &pin)) break;
-
-            // Get combo
-            comboBox = (QComboBox*) pin->itemAt(io_combo_pos)->widget();
-            combo_value = pinControlMap->value(comboBox->currentText());
+            if ((pos < 0) && ((pos = pin_store.get_pos(pInfo.pinType, pin_num)) < 0)) break;
 
             // Check if was a read (need to check pin disabled if so)
             bool exitWrite = false;
@@ -1555,7 +2321,7 @@ void GUI_IO_CONTROL::setValues(uint8_t minorKey, QByteArray values)
                 case MINOR_KEY_IO_AIO_READ:
                 case MINOR_KEY_IO_DIO_READ:
                 {
-                    exitWrite = !pinDisabledSet->contains(combo_value);
+                    exitWrite = !table->input.at(pos);
                     break;
                 }
             }
@@ -1563,15 +2329,8 @@ void GUI_IO_CONTROL::setValues(uint8_t minorKey, QByteArray values)
             // If exitWrite set, break out of parse
             if (exitWrite) break;
 
-            // Scale value
-            rList = pinRangeMap->value(combo_value);
-            newVAL = qRound((float) value + (rList->min * rList->div));
-
-            // Set slider
-            set_pin_io(pin, io_slider_pos, newVAL);
-
-            // Set lineEdit
-            set_pin_io(pin, io_line_edit_pos, QString::number(((float) newVAL) / rList->div));
+            // Store value & update widgets
+            set_pin_value(pInfo.pinType, pos, value);
 
             // Break out after writing new value
             break;
@@ -1632,6 +2391,527 @@ bool GUI_IO_CONTROL::set_pin_io(QHBoxLayout *pin, uint8_t io_pos, QVariant value
     return set_success;
 }
 
+void GUI_IO_CONTROL::update_pin_store(PinTypeInfo *pInfo)
+{
+    // Verify valid input
+    if (!pInfo) return;
+
+    // Get & verify maps
+    QList<QHBoxLayout*> *pins = pinMap.value(pInfo->pinType);
+    QMap<QString, uint8_t> *pinControlMap = controlMap.value(pInfo->pinType);
+    QMap<uint8_t, RangeList*> *pinRangeMap = rangeMap.value(pInfo->pinType);
+    QList<uint8_t> *pinDisabledSet = disabledValueSet.value(pInfo->pinType);
+    if (!(pins && pinControlMap && pinRangeMap && pinDisabledSet)) return;
+
+    // Set store layout (same order as pin layouts)
+    QList<uint8_t> pin_nums;
+    foreach (QHBoxLayout *pin, *pins)
+    {
+        pin_nums.append(((QLabel*) pin->itemAt(io_label_pos)->widget())->text().toInt());
+    }
+    pin_store.set_pins(pInfo->pinType, pin_nums);
+    pin_history.set_pins(pInfo->pinType, pin_nums.length());
+    pin_scheduler.set_pins(pInfo->pinType, pin_nums.length());
+
+    // Load current modes & values (widgets only hold settings at this point)
+    uint8_t io_combo;
+    RangeList *rList;
+    QSlider *sliderValue;
+    int num_pins = pins->length();
+    for (int pos = 0; pos < num_pins; pos++)
+    {
+        // Set mode
+        io_combo = pinControlMap->value(((QComboBox*) pins->at(pos)->itemAt(io_combo_pos)->widget())->currentText());
+        rList = pinRangeMap->value(io_combo);
+        if (!rList) continue;
+        pin_store.set_mode(pInfo->pinType, pos, io_combo, *rList,
+                           pinDisabledSet->contains(io_combo));
+
+        // Set value
+        sliderValue = (QSlider*) pins->at(pos)->itemAt(io_slider_pos)->widget();
+        pin_store.set_value(pInfo->pinType, pos, sliderValue->value(),
+                            ((float) sliderValue->value()) / rList->div);
+    }
+}
+
+void GUI_IO_CONTROL::update_pin_widgets(uint8_t pinType, int pos)
+{
+    // Virtual pins only mark the row (view repaints visible rows)
+    GUI_PIN_MODEL *model = pin_models.value(pinType);
+    if (model)
+    {
+        model->mark_changed(pos);
+        return;
+    }
+
+    // Get & verify table & layouts
+    const Pin_Table *table = pin_store.get_table(pinType);
+    QList<QHBoxLayout*> *pins = pinMap.value(pinType);
+    if (!(table && pins) || (pos < 0) || (pins->length() <= pos)) return;
+
+    // Set widgets from stored values
+    QHBoxLayout *pin = pins->at(pos);
+    set_pin_io(pin, io_slider_pos, table->value.at(pos));
+    set_pin_io(pin, io_line_edit_pos, QString::number(table->scaled.at(pos)));
+}
+
+void GUI_IO_CONTROL::set_pin_value(uint8_t pinType, int pos, uint16_t raw, qint64 timestamp)
+{
+    // Get & verify table
+    const Pin_Table *table = pin_store.get_table(pinType);
+    if (!table || (pos < 0) || (table->raw.length() <= pos)) return;
+
+    // Keep cached state to find changes
+    uint16_t prev_raw = table->raw.at(pos);
+    double prev_scaled = table->scaled.at(pos);
+
+    // Store new value
+    if (!pin_store.set_raw(pinType, pos, raw, timestamp)) return;
+
+    // Record sample in history (every sample, changed or not)
+    pin_history.append(pinType, pos, table->timestamp.at(pos), table->scaled.at(pos));
+
+    // Only refresh widgets if shown value changed
+    if ((prev_raw != raw) || (prev_scaled != table->scaled.at(pos)))
+    {
+        mark_pin_dirty(pinType, pos);
+    }
+}
+
+void GUI_IO_CONTROL::mark_pin_dirty(uint8_t pinType, int pos)
+{
+    // Verify position
+    int num_pins = pin_store.get_num_pins(pinType);
+    if ((pos < 0) || (num_pins <= pos)) return;
+
+    // Set dirty bit (sized to current layout)
+    QBitArray &dirty = dirty_pins[pinType];
+    if (dirty.size() != num_pins) dirty.resize(num_pins);
+    dirty.setBit(pos);
+}
+
+void GUI_IO_CONTROL::flush_pin_widgets()
+{
+    // Update widgets of each dirty pin once
+    // (repaints are queued so all changes draw together)
+    int num_pins;
+    foreach (uint8_t pinType, dirty_pins.keys())
+    {
+        const QBitArray &dirty = dirty_pins[pinType];
+        num_pins = qMin(dirty.size(), pin_store.get_num_pins(pinType));
+        for (int pos = 0; pos < num_pins; pos++)
+        {
+            if (dirty.testBit(pos)) update_pin_widgets(pinType, pos);
+        }
+    }
+
+    // Clear dirty pins
+    dirty_pins.clear();
+}
+
+QByteArray GUI_IO_CONTROL::get_read_all_request(uint8_t pinType)
+{
+    // Empty request for unpacked values
+    QByteArray request;
+    PinTypeInfo pInfo;
+    if (!(packed_reads || delta_reads) || !getPinTypeInfo(pinType, &pInfo)) return request;
+
+    // Request deltas (keyframe if not synced)
+    if (delta_reads)
+    {
+        if (delta_keyframe_needed.contains(pInfo.pinType)) request.append((char) io_packed_delta_keyframe);
+        else request.append((char) io_packed_delta);
+        return request;
+    }
+
+    // Request encoding for pin type
+    if (pInfo.pinType == MINOR_KEY_IO_AIO) request.append((char) aio_packed_encoding);
+    else if (pInfo.pinType == MINOR_KEY_IO_DIO) request.append((char) io_packed_dio_bits);
+    return request;
+}
+
+QByteArray GUI_IO_CONTROL::unpack_read_all(uint8_t minorKey, QByteArray values)
+{
+    // Unpacked values are [value_high, value_low] per pin
+    // (empty if packed values do not match pin count)
+    QByteArray unpacked;
+    PinTypeInfo pInfo;
+    if (values.isEmpty() || !getPinTypeInfo(minorKey, &pInfo)) return unpacked;
+    int num_pins = pin_store.get_num_pins(pInfo.pinType);
+
+    // Setup variables
+    const uchar *data = (const uchar*) values.constData() + s2_io_packed_data_loc;
+    int data_len = values.length() - s2_io_packed_data_loc;
+    uint8_t encoding = values.at(s2_io_packed_encoding_loc);
+    uint16_t value;
+
+    if (encoding == io_packed_delta)
+    {
+        // Verify header & count changed pins
+        int num_mask_bytes = (num_pins + 7) >> 3;
+        if (values.length() < (s2_io_delta_mask_loc + num_mask_bytes)) return unpacked;
+        const uchar *mask = (const uchar*) values.constData() + s2_io_delta_mask_loc;
+        const uchar *changed_value = mask + num_mask_bytes;
+        int num_changed = 0;
+        for (int i = 0; i < num_pins; i++)
+        {
+            if (mask[i >> 3] & (1 << (i & 0x07))) num_changed += 1;
+        }
+        if (values.length() != (s2_io_delta_mask_loc + num_mask_bytes + (num_changed * bytesPerPin)))
+        {
+            if (!delta_keyframe_needed.contains(pInfo.pinType)) delta_keyframe_needed.append(pInfo.pinType);
+            return unpacked;
+        }
+
+        // Keyframes replace snapshot, deltas need a synced snapshot
+        QByteArray snapshot = delta_snapshots.value(pInfo.pinType);
+        if (values.at(s2_io_delta_flags_loc) & io_delta_flag_keyframe)
+        {
+            snapshot.fill(0, num_pins * bytesPerPin);
+            delta_keyframe_needed.removeAll(pInfo.pinType);
+        } else if (delta_keyframe_needed.contains(pInfo.pinType)
+                   || (snapshot.length() != (num_pins * bytesPerPin)))
+        {
+            if (!delta_keyframe_needed.contains(pInfo.pinType)) delta_keyframe_needed.append(pInfo.pinType);
+            return unpacked;
+        }
+
+        // Apply changed values
+        for (int i = 0; i < num_pins; i++)
+        {
+            if (!(mask[i >> 3] & (1 << (i & 0x07)))) continue;
+            snapshot[bytesPerPin*i] = (char) changed_value[0];
+            snapshot[bytesPerPin*i + 1] = (char) changed_value[1];
+            changed_value += bytesPerPin;
+        }
+
+        // Save & return full values
+        delta_snapshots.insert(pInfo.pinType, snapshot);
+        return snapshot;
+    } else if ((pInfo.pinType == MINOR_KEY_IO_DIO) && (encoding == io_packed_dio_bits))
+    {
+        // Verify bit arrays & count wide pins
+        int num_mask_bytes = (num_pins + 7) >> 3;
+        if (data_len < (num_mask_bytes << 1)) return unpacked;
+        const uchar *wide = data + num_mask_bytes;
+        const uchar *wide_value = wide + num_mask_bytes;
+        int num_wide = 0;
+        for (int i = 0; i < num_pins; i++)
+        {
+            if (wide[i >> 3] & (1 << (i & 0x07))) num_wide += 1;
+        }
+        if (data_len != ((num_mask_bytes << 1) + (num_wide * bytesPerPin))) return unpacked;
+
+        // Expand each pin (wide pins use sent value)
+        for (int i = 0; i < num_pins; i++)
+        {
+            if (wide[i >> 3] & (1 << (i & 0x07)))
+            {
+                value = qFromBigEndian<quint16>(wide_value);
+                wide_value += bytesPerPin;
+            } else
+            {
+                value = (data[i >> 3] >> (i & 0x07)) & 0x01;
+            }
+            unpacked.append((char) (value >> 8));
+            unpacked.append((char) value);
+        }
+    } else if ((pInfo.pinType == MINOR_KEY_IO_AIO)
+               && ((encoding == io_packed_aio_10) || (encoding == io_packed_aio_12)))
+    {
+        // Verify length
+        int value_bits = (encoding == io_packed_aio_10) ? 10 : 12;
+        if (data_len != (((num_pins * value_bits) + 7) >> 3)) return unpacked;
+
+        // Read values MSB first
+        uint32_t bit_buffer = 0;
+        int num_bits = 0;
+        for (int i = 0; i < num_pins; i++)
+        {
+            while (num_bits < value_bits)
+            {
+                bit_buffer = (bit_buffer << 8) | *data++;
+                num_bits += 8;
+            }
+            num_bits -= value_bits;
+            value = (bit_buffer >> num_bits) & ((1 << value_bits) - 1);
+            unpacked.append((char) (value >> 8));
+            unpacked.append((char) value);
+        }
+    }
+
+    return unpacked;
+}
+
+QByteArray GUI_IO_CONTROL::get_input_mask(uint8_t pinType, QList<uint8_t> *pins)
+{
+    // Verify table
+    QByteArray mask;
+    const Pin_Table *table = pin_store.get_table(pinType);
+    if (!table) return mask;
+
+    // Set bit for each input pin (only pins the device updates)
+    uint8_t pin_num;
+    mask.fill(0, io_stream_max_mask_bytes);
+    for (int pos = 0; pos < table->pin_num.length(); pos++)
+    {
+        pin_num = table->pin_num.at(pos);
+        if (!table->input.at(pos) || (io_stream_max_pins <= pin_num)) continue;
+
+        mask[pin_num >> 3] = mask.at(pin_num >> 3) | (1 << (pin_num & 0x07));
+        if (pins) pins->append(pin_num);
+    }
+
+    // Remove unused mask bytes
+    while (!mask.isEmpty() && !mask.at(mask.length()-1)) mask.chop(1);
+    return mask;
+}
+
+QList<uint8_t> GUI_IO_CONTROL::get_unstreamed_pins(uint8_t pinType)
+{
+    // Verify table
+    QList<uint8_t> pins;
+    const Pin_Table *table = pin_store.get_table(pinType);
+    if (!table) return pins;
+
+    // Get input pins past the stream mask (read pins covers them)
+    for (int pos = 0; pos < table->pin_num.length(); pos++)
+    {
+        if (table->input.at(pos) && (io_stream_max_pins <= table->pin_num.at(pos)))
+            pins.append(table->pin_num.at(pos));
+    }
+    return pins;
+}
+
+void GUI_IO_CONTROL::poll_unstreamed_pins(uint8_t pinType, uint32_t interval_ms)
+{
+    // Poll at the subscribed rate (stop if unsubscribed or none left)
+    QTimer *timer = (pinType == MINOR_KEY_IO_AIO) ? &AIO_READ : &DIO_READ;
+    if (interval_ms && !get_unstreamed_pins(pinType).isEmpty()) timer->start(interval_ms);
+    else timer->stop();
+}
+
+void GUI_IO_CONTROL::parse_dio_events(QByteArray events)
+{
+    // Verify length
+    int events_len = events.length() - s2_io_event_start_loc;
+    if ((events_len < 0) || (events_len % s2_io_event_end)) return;
+
+    // Get table
+    const Pin_Table *table = pin_store.get_table(MINOR_KEY_IO_DIO);
+    if (!table) return;
+
+    // Decode device times (unwrapping 32 bit us counter)
+    const uchar *event = (const uchar*) events.constData() + s2_io_event_start_loc;
+    int num_events = events_len / s2_io_event_end;
+    QVector<qint64> device_us(num_events);
+    for (int i = 0; i < num_events; i++)
+    {
+        device_us[i] = device_clock.unwrap(qFromBigEndian<quint32>(event + (i*s2_io_event_end) + s2_io_event_time_loc));
+    }
+
+    // Update clock offset from newest event
+    if (num_events) device_clock.update(device_us.last());
+
+    // Mark dropped events in log
+    if (logIsRecording && (events.at(s2_io_event_flags_loc) & io_event_flag_overflow))
+    {
+        logWriter.write_text(QString::number(MINOR_KEY_IO_DIO_EVENTS) + ",overflow\n");
+    }
+
+    // Set each changed pin (using device time)
+    int pos;
+    uint8_t pin_num;
+    for (int i = 0; i < num_events; i++, event += s2_io_event_end)
+    {
+        // Only update value if not controllable
+        pin_num = event[s2_io_event_pin_num_loc];
+        pos = pin_store.get_pos(MINOR_KEY_IO_DIO, pin_num);
+        if ((pos < 0) || !table->input.at(pos)) continue;
+
+        // Store value & update widgets
+        set_pin_value(MINOR_KEY_IO_DIO, pos,
+                      (event[s2_io_event_value_high_loc] << 8) | event[s2_io_event_value_low_loc],
+                      device_clock.to_host_ms(device_us.at(i)));
+
+        // Log event with device time
+        if (logIsRecording)
+        {
+            logWriter.write_text(QString::number(MINOR_KEY_IO_DIO_EVENTS) + "," + QString::number(pin_num) + ","
+                                 + QString::number(table->scaled.at(pos)) + ","
+                                 + QString::number(device_us.at(i)) + "\n");
+        }
+    }
+}
+
+void GUI_IO_CONTROL::parse_aio_burst(QByteArray frame)
+{
+    // Verify header & whole samples
+    int sample_len = aio_burst_pins.length() * bytesPerPin;
+    int data_len = frame.length() - s2_io_burst_data_loc;
+    if (!sample_len || (data_len < 0) || (data_len % sample_len)) return;
+
+    // Get table & pin positions (pins in mask order)
+    const Pin_Table *table = pin_store.get_table(MINOR_KEY_IO_AIO);
+    if (!table) return;
+    QList<int> positions;
+    foreach (uint8_t pin_num, aio_burst_pins)
+    {
+        positions.append(pin_store.get_pos(MINOR_KEY_IO_AIO, pin_num));
+    }
+
+    // Parse header (start time found back from sent time)
+    const uchar *header = (const uchar*) frame.constData();
+    uint8_t flags = header[s2_io_burst_flags_loc];
+    uint16_t index = qFromBigEndian<quint16>(header + s2_io_burst_index_high_loc);
+    uint32_t period_us = qFromBigEndian<quint32>(header + s2_io_burst_period_loc);
+    uint32_t sent_raw_us = qFromBigEndian<quint32>(header + s2_io_burst_sent_loc);
+    qint64 sent_us = device_clock.unwrap(sent_raw_us);
+    qint64 start_us = sent_us - (uint32_t) (sent_raw_us - qFromBigEndian<quint32>(header + s2_io_burst_start_loc));
+    device_clock.update(sent_us);
+    aio_burst_late |= (bool) (flags & io_burst_flag_late);
+
+    // Expand each sample (exact device time)
+    const uchar *sample = header + s2_io_burst_data_loc;
+    int num_samples = data_len / sample_len;
+    int num_pins = positions.length();
+    qint64 sample_us;
+    QString line;
+    int pos;
+    for (int s = 0; s < num_samples; s++)
+    {
+        // Get sample time
+        sample_us = start_us + ((qint64) (index + s) * period_us);
+
+        // Log sample with device time
+        line = QString::number(MINOR_KEY_IO_AIO_BURST) + "," + QString::number(sample_us);
+
+        // Store each value & record history (widgets updated once per frame)
+        for (int i = 0; i < num_pins; i++, sample += bytesPerPin)
+        {
+            pos = positions.at(i);
+            if (!pin_store.set_raw(MINOR_KEY_IO_AIO, pos, qFromBigEndian<quint16>(sample),
+                                   device_clock.to_host_ms(sample_us)))
+            {
+                line += ",-1";
+                continue;
+            }
+            pin_history.append(MINOR_KEY_IO_AIO, pos, table->timestamp.at(pos), table->scaled.at(pos));
+            line += "," + QString::number(table->scaled.at(pos));
+        }
+        if (logIsRecording) logWriter.write_text(line + "\n");
+    }
+
+    // Show newest values (refreshed after the frame is parsed)
+    foreach (pos, positions) mark_pin_dirty(MINOR_KEY_IO_AIO, pos);
+
+    // Finish capture on last frame
+    if (flags & io_burst_flag_last)
+    {
+        aio_burst_active = false;
+        emit aio_burst_done(aio_burst_late);
+    }
+}
+
+qint64 GUI_IO_CONTROL::take_device_time_ms(QByteArray *recvData)
+{
+    // Device time follows values (-1 if too short)
+    int values_len = recvData->length() - io_timestamp_len;
+    if (values_len < s1_end_loc) return -1;
+
+    // Track device clock & map read time to host time
+    qint64 device_us = device_clock.unwrap(qFromBigEndian<quint32>((const uchar*) recvData->constData() + values_len));
+    recvData->chop(io_timestamp_len);
+    device_clock.update(device_us);
+    return device_clock.to_host_ms(device_us);
+}
+
+int GUI_IO_CONTROL::get_pin_pos(uint8_t pinType, QHBoxLayout *pin)
+{
+    // Position in layout list matches store position
+    QList<QHBoxLayout*> *pins = pinMap.value(pinType);
+    return pins ? pins->indexOf(pin) : -1;
+}
+
+bool GUI_IO_CONTROL::set_virtual_pin(uint8_t pinType, int pos, int column, QVariant value)
+{
+    // Get & verify maps & table
+    QMap<QString, uint8_t> *pinControlMap = controlMap.value(pinType);
+    QMap<uint8_t, RangeList*> *pinRangeMap = rangeMap.value(pinType);
+    QList<uint8_t> *pinDisabledSet = disabledValueSet.value(pinType);
+    const Pin_Table *table = pin_store.get_table(pinType);
+    GUI_PIN_MODEL *model = pin_models.value(pinType);
+    if (!(pinControlMap && pinRangeMap && pinDisabledSet && table && model)
+            || (pos < 0) || (table->pin_num.length() <= pos))
+    {
+        return false;
+    }
+
+    float newVAL;
+    switch (column)
+    {
+        case pin_model_mode_col:
+        {
+            // Verify mode
+            QString combo = value.toString();
+            if (!pinControlMap->contains(combo)) return false;
+            uint8_t io_combo = pinControlMap->value(combo);
+            RangeList *rList = pinRangeMap->value(io_combo);
+            if (!rList) return false;
+
+            // Store new mode
+            pin_store.set_mode(pinType, pos, io_combo, *rList, pinDisabledSet->contains(io_combo));
+
+            // Reset value to 0, or min/max if 0 out of range (same as slider)
+            int newValue = 0;
+            if (0 < rList->min) newValue = rList->min;
+            else if (rList->max < 0) newValue = rList->max;
+            newVAL = ((float) newValue) / rList->div;
+            if (pinType == MINOR_KEY_IO_DIO) newVAL = qRound(newVAL);
+            pin_store.set_value(pinType, pos, newValue, newVAL);
+            break;
+        }
+        case pin_model_value_col:
+        {
+            // Scale & verify value (same as line edit)
+            RangeList rList = table->range.at(pos);
+            newVAL = rList.div * value.toString().toFloat();
+            if (pinType == MINOR_KEY_IO_DIO) newVAL = qRound(newVAL);
+            if ((newVAL - ((float) rList.min * rList.div)) < 0)
+            {
+                GUI_GENERIC_HELPER::showMessage("Error: Invalid Pin Value:  " \
+                                                + QString::number(newVAL - ((float) rList.min * rList.div)));
+                return false;
+            }
+
+            // Store value (DIO shows the rounded value, AIO what was entered)
+            pin_store.set_value(pinType, pos, (int) newVAL,
+                                (pinType == MINOR_KEY_IO_DIO) ?
+                                    (double) (((float) ((int) newVAL)) / rList.div)
+                                  : value.toString().toDouble());
+            break;
+        }
+        default:
+        {
+            // Pin column not editable
+            return false;
+        }
+    }
+
+    // Mark row for view update
+    model->mark_changed(pos);
+    return true;
+}
+
+void GUI_IO_CONTROL::destroy_virtual_pins(uint8_t pinType)
+{
+    // Delete view before its model (removes it from the grid)
+    QTableView *view = pin_views.take(pinType);
+    if (view) delete view;
+    GUI_PIN_MODEL *model = pin_models.take(pinType);
+    if (model) delete model;
+}
+
 bool GUI_IO_CONTROL::getPinTypeInfo(uint8_t pinType, PinTypeInfo *infoPtr)
 {
     infoPtr->minorKey = pinType;
@@ -1644,6 +2924,9 @@ bool GUI_IO_CONTROL::getPinTypeInfo(uint8_t pinType, PinTypeInfo *infoPtr)
         case MINOR_KEY_IO_AIO_WRITE:
         case MINOR_KEY_IO_AIO_READ:
         case MINOR_KEY_IO_AIO_READ_ALL:
+        case MINOR_KEY_IO_AIO_STREAM:
+        case MINOR_KEY_IO_AIO_READ_ALL_PACKED:
+        case MINOR_KEY_IO_AIO_READ_PINS:
             infoPtr->cols = num_AIOcols;
             infoPtr->grid = AIO_Grid;
             infoPtr->pinType = MINOR_KEY_IO_AIO;
@@ -1653,6 +2936,9 @@ bool GUI_IO_CONTROL::getPinTypeInfo(uint8_t pinType, PinTypeInfo *infoPtr)
         case MINOR_KEY_IO_DIO_WRITE:
         case MINOR_KEY_IO_DIO_READ:
         case MINOR_KEY_IO_DIO_READ_ALL:
+        case MINOR_KEY_IO_DIO_STREAM:
+        case MINOR_KEY_IO_DIO_READ_ALL_PACKED:
+        case MINOR_KEY_IO_DIO_READ_PINS:
             infoPtr->cols = num_DIOcols;
             infoPtr->grid = DIO_Grid;
             infoPtr->pinType = MINOR_KEY_IO_DIO;
@@ -1669,6 +2955,28 @@ bool GUI_IO_CONTROL::getPinTypeInfo(uint8_t pinType, PinTypeInfo *infoPtr)
     }
 }
 
+bool GUI_IO_CONTROL::getChartHandle(QString series_uid, Chart_Series_Handle *handle)
+{
+    // Split series id ("AIO_3")
+    QStringList pinNum_split = series_uid.split('_');
+    if (pinNum_split.length() != 2) return false;
+
+    // Get pin type
+    if (pinNum_split.at(0) == "AIO") handle->pinType = MINOR_KEY_IO_AIO;
+    else if (pinNum_split.at(0) == "DIO") handle->pinType = MINOR_KEY_IO_DIO;
+    else return false;
+
+    // Get pin number
+    bool ok = false;
+    handle->pin_num = pinNum_split.at(1).toInt(&ok);
+    if (!ok) return false;
+
+    // Get store position (-1 if pin not in layout)
+    handle->pos = pin_store.get_pos(handle->pinType, handle->pin_num);
+    handle->seen = 0;
+    return true;
+}
+
 RangeList *GUI_IO_CONTROL::makeRangeList(QString rangeInfo)
 {
     // Split range info string into values
@@ -1872,8 +3180,10 @@ void GUI_IO_CONTROL::update_pin_grid(PinTypeInfo *pInfo)
 
 void GUI_IO_CONTROL::clear_all_maps()
 {
-    // Clear pin list
+    // Clear pin list & store
     pinList.clear();
+    pin_store.clear();
+    pin_history.clear();
 
     // Clear pin map
     foreach (uint8_t pinType, pinMap.keys())
@@ -1886,6 +3196,12 @@ void GUI_IO_CONTROL::clear_all_maps()
     }
     pinMap.clear();
 
+    // Clear virtual pins
+    foreach (uint8_t pinType, pin_models.keys())
+    {
+        destroy_virtual_pins(pinType);
+    }
+
     // Clear control map
     foreach (uint8_t pinType, controlMap.keys())
     {
@@ -26,6 +26,7 @@
 // Mapping
 #include <QMap>
 #include <QList>
+#include <QBitArray>
 
 // UI Elements
 #include <QGridLayout>
@@ -35,6 +36,7 @@
 #include <QComboBox>
 #include <QSlider>
 #include <QLineEdit>
+#include <QTableView>
 
 // File & saving
 #include <QFile>
@@ -43,19 +45,22 @@
 
 // Graphs
 #include "../gui-helpers/gui-chart-view.hpp"
+#include "../gui-helpers/gui-chart-feed.hpp"
+
+// Pin state & history
+#include "../gui-helpers/gui-pin-store.hpp"
+#include "../gui-helpers/gui-pin-history.hpp"
+#include "../gui-helpers/gui-pin-scheduler.hpp"
+#include "../gui-helpers/gui-pin-model.hpp"
+#include "../gui-helpers/gui-pin-log.hpp"
+#include "../gui-helpers/gui-log-writer.hpp"
+#include "../gui-helpers/gui-log-replay.hpp"
+#include "../gui-helpers/gui-device-clock.hpp"
 
 namespace Ui {
 class GUI_IO_CONTROL;
 }
 
-typedef struct {
-    int min;
-    int max;
-    int step;
-    float div;
-} RangeList;
-#define EMPTY_RANGE RangeList{.min=0, .max=0, .step=0, .div=1.0}
-
 typedef struct {
     QGridLayout *grid;
     uint8_t pinType;
@@ -83,21 +88,30 @@ public:
 
     virtual void parseConfigMap(QMap<QString, QVariant> *configMap);
     virtual bool waitForDevice(uint8_t minorKey);
+    virtual bool isStreamKey(uint8_t minorKey);
 
 signals:
     void pin_update(QStringList pin_list);
     void log_updated();
+    void aio_burst_done(bool late);
 
 public slots:
     virtual void reset_gui();
     void chart_update_request(QList<QString> data_points, GUI_CHART_ELEMENT *target_element);
+    void chart_subscribe_request(QList<QString> series_uids, int interval_ms,
+                                 GUI_CHART_ELEMENT *target_element);
 
 protected slots:
     void recordPinValues(PinTypeInfo *pInfo);
+    void recordBinaryValues();
     virtual void receive_gui(QByteArray recvData);
 
     void request_read_all(uint8_t pinType);
     void request_read_pin(uint8_t pinType, uint8_t pinNum);
+    void request_read_pins(uint8_t pinType, QList<uint8_t> pin_nums);
+    void request_stream(uint8_t pinType, uint32_t interval_ms);
+    void request_dio_events(uint32_t interval_ms);
+    void request_aio_burst(uint32_t period_us, uint16_t num_samples);
 
 protected:
     // Get pin list
@@ -110,6 +124,10 @@ protected:
     /** Declare ui accessor for testing **/
     Ui::GUI_IO_CONTROL *get_ui();
 
+    // Packed read all helpers
+    QByteArray get_read_all_request(uint8_t pinType);
+    QByteArray unpack_read_all(uint8_t minorKey, QByteArray values);
+
 private slots:
     // DIO slots
     void DIO_ComboValueChanged();
@@ -121,9 +139,20 @@ private slots:
     void AIO_SliderValueChanged();
     void AIO_LineEditValueChanged();
 
+    // Virtual pin slots
+    void virtualPinEdited(uint8_t pinType, int pos, int column, QVariant value);
+
     // Recording handlers
     void updateValues();
+    void updateScheduledValues();
     void recordLogData();
+    void logWriteError(QString msg);
+
+    // Replay handlers
+    void replayValues(uint8_t pinType, QList<uint8_t> pin_nums,
+                      QVector<float> values, qint64 time_ms);
+    void replayTick(qint64 time_ms);
+    void replayDone();
 
     // Update handlers
     void on_StartUpdater_Button_clicked();
@@ -134,6 +163,10 @@ private slots:
     void on_StartLog_Button_clicked();
     void on_StopLog_Button_clicked();
 
+    // Replay button handlers
+    void on_StartReplay_Button_clicked();
+    void on_StopReplay_Button_clicked();
+
     // Connection button handlers
     void on_ConnConnect_Button_clicked();
     void on_ConnSend_Button_clicked();
@@ -157,23 +190,80 @@ private:
     QMap<uint8_t, QList<uint8_t>*> disabledValueSet;
     QMap<uint8_t, QMap<uint8_t, RangeList*>*> rangeMap;
 
-    // Read variables
+    // Pin state (widgets, logging & charts read from here)
+    GUI_PIN_STORE pin_store;
+
+    // Pin sample history (fed by device reads)
+    GUI_PIN_HISTORY pin_history;
+
+    // Chart samples (pushed from pin store to subscribed charts)
+    GUI_CHART_FEED chart_feed;
+
+    // Pins changed by device values since last widget refresh
+    // (bits indexed by store position)
+    QMap<uint8_t, QBitArray> dirty_pins;
+
+    // Virtual pins (pin types with more pins than the threshold are
+    // shown in a table view instead of per pin widgets)
+    int virtual_pin_threshold;
+    QMap<uint8_t, GUI_PIN_MODEL*> pin_models;
+    QMap<uint8_t, QTableView*> pin_views;
+
+    // Read variables (pin bitsets indexed by pin num)
+    static const int io_max_pins = 256;
     QTimer DIO_READ;
     bool dio_read_requested;
     bool dio_read_requested_double;
-    QList<uint8_t> dio_read_pins;
-    QList<uint8_t> dio_read_pins_double;
+    QBitArray dio_read_pins;
+    QBitArray dio_read_pins_double;
     QTimer AIO_READ;
     bool aio_read_requested;
     bool aio_read_requested_double;
-    QList<uint8_t> aio_read_pins;
-    QList<uint8_t> aio_read_pins_double;
-
-    // Log variables
-    QFile *logFile;
-    QTextStream *logStream;
+    QBitArray aio_read_pins;
+    QBitArray aio_read_pins_double;
+
+    // Per pin poll schedule (pins due together share a request)
+    GUI_PIN_SCHEDULER pin_scheduler;
+    QTimer PIN_SCHEDULE;
+
+    // Packed read all variables (device falls back to unpacked)
+    bool packed_reads;
+    uint8_t aio_packed_encoding;
+
+    // Delta read all variables (last device values per pin type)
+    bool delta_reads;
+    QMap<uint8_t, QByteArray> delta_snapshots;
+    QList<uint8_t> delta_keyframe_needed;
+
+    // Stream variables (device pushes read all values)
+    bool stream_updates;
+    bool streaming;
+    QMap<uint8_t, QList<uint8_t>> stream_pins;
+    QMap<uint8_t, uint32_t> stream_intervals;
+
+    // DIO event variables (device reports changed pins)
+    bool dio_events;
+    bool dio_events_active;
+    uint32_t dio_events_interval;
+
+    // AIO burst variables (device samples then uploads frames)
+    bool aio_burst_active;
+    bool aio_burst_late;
+    QList<uint8_t> aio_burst_pins;
+
+    // Device clock (maps device timestamps to host time)
+    GUI_DEVICE_CLOCK device_clock;
+
+    // Log variables (rows written by log writer)
     QTimer logTimer;
     bool logIsRecording;
+    GUI_LOG_WRITER logWriter;
+
+    // Binary log variables (columnar records with time index)
+    bool binary_log;
+
+    // Replay variables (recorded logs fed through pin store)
+    GUI_LOG_REPLAY logReplay;
 
     // Used for parsing read data
     uint8_t bytesPerPin;
@@ -198,6 +288,9 @@ private:
     // Set pin settings
     void setPinCombos(PinTypeInfo *pInfo, QList<QString> combos);
     void setConTypes(QStringList connTypes, QList<char> mapValues);
+    void setPinRates(PinTypeInfo *pInfo, QList<QString> rates);
+    QList<uint8_t> parsePinNums(QString pinNumsStr);
+    bool setVirtualPins(PinTypeInfo *pInfo, QList<QString> combos);
 
     // Add info to maps and settings
     void addPinType(uint8_t pinType);
@@ -207,11 +300,35 @@ private:
     void addPinRangeMap(uint8_t pinType, QList<QString> keys, QList<RangeList*> values);
 
     // Set GUI values
-    void setValues(uint8_t minorKey, QByteArray values);
+    void setValues(uint8_t minorKey, QByteArray values, qint64 time_ms = -1);
     bool set_pin_io(QHBoxLayout *pin, uint8_t io_pos, QVariant value);
 
+    // Pin store helpers
+    void update_pin_store(PinTypeInfo *pInfo);
+    void update_pin_widgets(uint8_t pinType, int pos);
+    void set_pin_value(uint8_t pinType, int pos, uint16_t raw, qint64 timestamp = -1);
+    void mark_pin_dirty(uint8_t pinType, int pos);
+    void flush_pin_widgets();
+    int get_pin_pos(uint8_t pinType, QHBoxLayout *pin);
+
+    // Virtual pin helpers
+    bool set_virtual_pin(uint8_t pinType, int pos, int column, QVariant value);
+    void destroy_virtual_pins(uint8_t pinType);
+
+    // Stream & event helpers
+    QByteArray get_input_mask(uint8_t pinType, QList<uint8_t> *pins);
+    QList<uint8_t> get_unstreamed_pins(uint8_t pinType);
+    void poll_unstreamed_pins(uint8_t pinType, uint32_t interval_ms);
+    void parse_dio_events(QByteArray events);
+    void parse_aio_burst(QByteArray frame);
+
+    // Device clock helpers
+    // (removes flagged device time from end of packet)
+    qint64 take_device_time_ms(QByteArray *recvData);
+
     // Get information
     bool getPinTypeInfo(uint8_t pinType, PinTypeInfo *infoPtr);
+    bool getChartHandle(QString series_uid, Chart_Series_Handle *handle);
 
     // Range list creation
     RangeList *makeRangeList(QString rangeInfo);
@@ -0,0 +1,40 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "comms-base-test-class.hpp"
+
+COMMS_BASE_TEST_CLASS::COMMS_BASE_TEST_CLASS(QObject *parent) :
+    COMMS_BASE(parent)
+{
+    /* DO NOTHING */
+}
+
+void COMMS_BASE_TEST_CLASS::rx_data(QByteArray data)
+{
+    queue_read(data);
+}
+
+QList<QByteArray> COMMS_BASE_TEST_CLASS::get_written()
+{
+    return written;
+}
+
+void COMMS_BASE_TEST_CLASS::write(QByteArray writeData)
+{
+    written.append(writeData);
+}
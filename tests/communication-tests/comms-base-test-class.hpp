@@ -0,0 +1,44 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef COMMS_BASE_TEST_CLASS_H
+#define COMMS_BASE_TEST_CLASS_H
+
+#include "../../src/communication/comms-base.hpp"
+
+class COMMS_BASE_TEST_CLASS : public COMMS_BASE
+{
+    Q_OBJECT
+
+public:
+    COMMS_BASE_TEST_CLASS(QObject *parent = NULL);
+
+    // Act as transport receiving data
+    void rx_data(QByteArray data);
+
+    // Data handed to transport write()
+    QList<QByteArray> get_written();
+
+public slots:
+    void write(QByteArray writeData);
+
+private:
+    QList<QByteArray> written;
+};
+
+#endif // COMMS_BASE_TEST_CLASS_H
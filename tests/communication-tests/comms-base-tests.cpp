@@ -0,0 +1,258 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "comms-base-tests.hpp"
+
+// Testing infrastructure includes
+#include <QtTest>
+#include <QSignalSpy>
+#include <QThread>
+#include <QMutex>
+#include <QElapsedTimer>
+
+#include <functional>
+
+#include "../../src/communication/spsc-byte-queue.hpp"
+
+// Runs a function in its own thread (benchmark sides)
+class COMMS_BASE_BENCH_THREAD : public QThread
+{
+public:
+    COMMS_BASE_BENCH_THREAD(std::function<void()> func) : func(func) {}
+
+protected:
+    void run() { func(); }
+
+private:
+    std::function<void()> func;
+};
+
+COMMS_BASE_TESTS::COMMS_BASE_TESTS()
+{
+    comms_tester = nullptr;
+}
+
+COMMS_BASE_TESTS::~COMMS_BASE_TESTS()
+{
+    // Delete tester if allocated
+    if (comms_tester) delete comms_tester;
+}
+
+void COMMS_BASE_TESTS::init()
+{
+    // Create object for testing (new one each test resets wakeups)
+    comms_tester = new COMMS_BASE_TEST_CLASS();
+    QVERIFY(comms_tester);
+}
+
+void COMMS_BASE_TESTS::cleanup()
+{
+    // Delete test class
+    if (comms_tester)
+    {
+        delete comms_tester;
+        comms_tester = nullptr;
+    }
+}
+
+void COMMS_BASE_TESTS::test_spsc_queue()
+{
+    // Fetch data
+    QFETCH(quint32, capacity);
+    QFETCH(QList<QByteArray>, pushes);
+    QFETCH(quint32, expected_capacity);
+
+    // Setup queue
+    SPSC_BYTE_QUEUE queue(capacity);
+    QCOMPARE(queue.capacity(), expected_capacity);
+    QCOMPARE(queue.available(), (quint32) 0);
+
+    // Push & pop everything (overflow moves in on empty pushes)
+    QByteArray expected, actual;
+    foreach (QByteArray push, pushes)
+    {
+        expected.append(push);
+        bool fit = queue.push(push);
+        QCOMPARE(fit, !queue.hasPending());
+        QVERIFY(queue.available() <= queue.capacity());
+        actual.append(queue.pop_all());
+    }
+    while (queue.hasPending())
+    {
+        queue.push(QByteArray());
+        actual.append(queue.pop_all());
+    }
+    actual.append(queue.pop_all());
+
+    // Verify order & nothing left
+    QCOMPARE(actual, expected);
+    QCOMPARE(queue.available(), (quint32) 0);
+}
+
+void COMMS_BASE_TESTS::test_spsc_queue_data()
+{
+    // Input data columns
+    QTest::addColumn<quint32>("capacity");
+    QTest::addColumn<QList<QByteArray>>("pushes");
+
+    // Expected output columns
+    QTest::addColumn<quint32>("expected_capacity");
+
+    // Load in data
+    QTest::newRow("Empty") << (quint32) 16
+                           << QList<QByteArray>({QByteArray()})
+                           << (quint32) 16;
+    QTest::newRow("Rounded") << (quint32) 10
+                             << QList<QByteArray>({"abc", "defgh"})
+                             << (quint32) 16;
+    QTest::newRow("Wrapping") << (quint32) 8
+                              << QList<QByteArray>({"abcde", "fghij", "klmno"})
+                              << (quint32) 8;
+    QTest::newRow("Overflow") << (quint32) 4
+                              << QList<QByteArray>({"abcdefghij", "kl", "mnopqrstu"})
+                              << (quint32) 4;
+}
+
+void COMMS_BASE_TESTS::test_read_queue_wakeup()
+{
+    // Setup spy
+    QSignalSpy data_spy(comms_tester, &COMMS_BASE::dataAvailable);
+    QVERIFY(data_spy.isValid());
+
+    // Multiple receives before drain only wake once
+    comms_tester->rx_data("abc");
+    comms_tester->rx_data("def");
+    comms_tester->rx_data(QByteArray());
+    QCOMPARE(data_spy.count(), 1);
+
+    // Drain returns everything in order
+    QCOMPARE(comms_tester->readQueued(), QByteArray("abcdef"));
+    QCOMPARE(comms_tester->readQueued(), QByteArray());
+
+    // Next receive wakes again
+    comms_tester->rx_data("ghi");
+    QCOMPARE(data_spy.count(), 2);
+    QCOMPARE(comms_tester->readQueued(), QByteArray("ghi"));
+
+    // Empty receive does not wake
+    comms_tester->rx_data(QByteArray());
+    QCOMPARE(data_spy.count(), 2);
+}
+
+void COMMS_BASE_TESTS::test_write_queue_wakeup()
+{
+    // Queue writes then let event loop flush
+    comms_tester->writeQueued("abc");
+    comms_tester->writeQueued("def");
+    QVERIFY(comms_tester->get_written().isEmpty());
+    qApp->processEvents();
+
+    // Coalesced into a single transport write
+    QCOMPARE(comms_tester->get_written(), QList<QByteArray>({"abcdef"}));
+
+    // Next write flushes again
+    comms_tester->writeQueued("ghi");
+    qApp->processEvents();
+    QCOMPARE(comms_tester->get_written(), QList<QByteArray>({"abcdef", "ghi"}));
+}
+
+void COMMS_BASE_TESTS::test_frame_rate()
+{
+    // Benchmark setup (32 byte frames, same size as default chunk)
+    const int num_frames = 200000;
+    const int frame_len = 32;
+    QByteArray frame(frame_len, 0);
+    for (int i = 0; i < frame_len; i++) frame[i] = (char) i;
+
+    // Old design: recursive mutex guarding a shared buffer
+    QMutex lock(QMutex::Recursive);
+    QByteArray shared;
+    qint64 mutex_rcvd = 0;
+    QByteArray mutex_last;
+    COMMS_BASE_BENCH_THREAD mutex_producer([&]() {
+        for (int i = 0; i < num_frames; i++)
+        {
+            lock.lock();
+            shared.append(frame);
+            lock.unlock();
+        }
+    });
+    COMMS_BASE_BENCH_THREAD mutex_consumer([&]() {
+        QByteArray data;
+        while (mutex_rcvd < ((qint64) num_frames * frame_len))
+        {
+            lock.lock();
+            data = shared;
+            shared.clear();
+            lock.unlock();
+            mutex_rcvd += data.length();
+            if (!data.isEmpty()) mutex_last = data.right(frame_len);
+        }
+    });
+
+    QElapsedTimer timer;
+    timer.start();
+    mutex_consumer.start();
+    mutex_producer.start();
+    QVERIFY(mutex_producer.wait(60000));
+    QVERIFY(mutex_consumer.wait(60000));
+    qint64 mutex_ns = qMax(timer.nsecsElapsed(), (qint64) 1);
+
+    // New design: lock-free SPSC ring
+    SPSC_BYTE_QUEUE queue;
+    qint64 queue_rcvd = 0;
+    bool queue_in_order = true;
+    COMMS_BASE_BENCH_THREAD queue_producer([&]() {
+        for (int i = 0; i < num_frames; i++)
+        {
+            // Wait for space rather than growing overflow
+            if (!queue.push(frame))
+                while (!queue.push(QByteArray())) { /* SPIN */ }
+        }
+    });
+    COMMS_BASE_BENCH_THREAD queue_consumer([&]() {
+        QByteArray data;
+        while (queue_rcvd < ((qint64) num_frames * frame_len))
+        {
+            data = queue.pop_all();
+            if (data.isEmpty()) continue;
+
+            // Frames are only split across pops, so check offsets
+            for (int i = 0; queue_in_order && (i < data.length()); i++)
+                queue_in_order = (data.at(i) == (char) ((queue_rcvd + i) % frame_len));
+            queue_rcvd += data.length();
+        }
+    });
+
+    timer.restart();
+    queue_consumer.start();
+    queue_producer.start();
+    QVERIFY(queue_producer.wait(60000));
+    QVERIFY(queue_consumer.wait(60000));
+    qint64 queue_ns = qMax(timer.nsecsElapsed(), (qint64) 1);
+
+    // Verify all data made it across
+    QCOMPARE(mutex_rcvd, (qint64) num_frames * frame_len);
+    QCOMPARE(mutex_last, frame);
+    QCOMPARE(queue_rcvd, (qint64) num_frames * frame_len);
+    QVERIFY(queue_in_order);
+
+    // Report rates (not compared, machine dependent)
+    qInfo() << "Mutex frames/sec:" << ((double) num_frames * 1e9 / mutex_ns);
+    qInfo() << "SPSC queue frames/sec:" << ((double) num_frames * 1e9 / queue_ns);
+}
@@ -0,0 +1,54 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef COMMS_BASE_TESTS_H
+#define COMMS_BASE_TESTS_H
+
+#include <QObject>
+
+// Testing class
+#include "comms-base-test-class.hpp"
+
+class COMMS_BASE_TESTS : public QObject
+{
+    Q_OBJECT
+
+public:
+    COMMS_BASE_TESTS();
+    ~COMMS_BASE_TESTS();
+
+private slots:
+    // Setup and cleanup functions
+    void init();
+    void cleanup();
+
+    // Member tests
+    void test_spsc_queue();
+    void test_spsc_queue_data();
+
+    void test_read_queue_wakeup();
+    void test_write_queue_wakeup();
+
+    // Mutex vs. queue throughput
+    void test_frame_rate();
+
+private:
+    COMMS_BASE_TEST_CLASS *comms_tester;
+};
+
+#endif // COMMS_BASE_TESTS_H
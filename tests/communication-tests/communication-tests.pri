@@ -0,0 +1,9 @@
+SOURCES += \
+    $$PWD/comms-base-tests.cpp \
+    $$PWD/comms-base-test-class.cpp \
+    $$PWD/link-emulator-tests.cpp
+
+HEADERS += \
+    $$PWD/comms-base-tests.hpp \
+    $$PWD/comms-base-test-class.hpp \
+    $$PWD/link-emulator-tests.hpp
@@ -0,0 +1,270 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "link-emulator-tests.hpp"
+
+// Testing infrastructure includes
+#include <QtTest>
+#include <QTimer>
+
+#include <random>
+
+#include "../../src/user-interfaces/gui-io-control-minor-keys.h"
+
+// Longest a transfer may take before the bridge is closed (fails test)
+static const int transfer_timeout_ms = 60000;
+
+// Replays the emulator drop draws for a drop only link (one draw per write).
+// DIO writes are acked without a response, so host packet and device ack
+// alternate and every lost write costs exactly one resend.
+static quint64 expected_drop_retries(quint32 seed, double drop_rate, int num_packets)
+{
+    // No draws are made for a zero rate
+    if (drop_rate <= 0.0) return 0;
+
+    std::mt19937 replay_rand(seed);
+    quint64 retries = 0;
+    for (int i = 0; i < num_packets; i++)
+    {
+        // Resend until packet and ack both make it (no ack draw if packet lost)
+        while ((std::uniform_real_distribution<double>(0.0, 1.0)(replay_rand) < drop_rate)
+               || (std::uniform_real_distribution<double>(0.0, 1.0)(replay_rand) < drop_rate))
+        {
+            retries += 1;
+        }
+    }
+    return retries;
+}
+
+LINK_EMULATOR_TESTS::LINK_EMULATOR_TESTS()
+{
+    emulator = nullptr;
+    bridge = nullptr;
+}
+
+LINK_EMULATOR_TESTS::~LINK_EMULATOR_TESTS()
+{
+    // Delete objects if allocated
+    if (bridge) delete bridge;
+    if (emulator) delete emulator;
+}
+
+void LINK_EMULATOR_TESTS::init()
+{
+    // Create link (only one emulated uC can run at a time)
+    Link_Emulator_Settings link_settings = Link_Emulator_Settings_DEFAULT;
+    emulator = new LINK_EMULATOR(&link_settings);
+    QVERIFY(emulator);
+
+    // Create bridge on top of link
+    bridge = new GUI_COMM_BRIDGE(MAJOR_KEY_DEV_READY);
+    QVERIFY(bridge);
+    bridge->attach_device(emulator);
+    QVERIFY(bridge->open_bridge());
+}
+
+void LINK_EMULATOR_TESTS::cleanup()
+{
+    // Delete bridge before link it is attached to
+    if (bridge)
+    {
+        delete bridge;
+        bridge = nullptr;
+    }
+
+    // Delete link (stops emulated uC)
+    if (emulator)
+    {
+        delete emulator;
+        emulator = nullptr;
+    }
+}
+
+void LINK_EMULATOR_TESTS::test_drop_retries()
+{
+    // Fetch data
+    QFETCH(quint32, seed);
+    QFETCH(double, drop_rate);
+    QFETCH(quint16, pin_offset);
+
+    // Setup link (drops only so draws follow packet order)
+    Link_Emulator_Settings link_settings = Link_Emulator_Settings_DEFAULT;
+    link_settings.latency_ms = 1;
+    link_settings.drop_rate = drop_rate;
+    link_settings.seed = seed;
+    QVERIFY(start_link(link_settings));
+
+    // Send one packet per pin
+    QList<uint16_t> values = test_pin_values(pin_offset);
+    QVERIFY(send_pin_writes(values));
+
+    // Verify every write landed
+    for (int i = 0; i < values.length(); i++)
+        QTRY_COMPARE(emulator->pin_read(true, i), values.at(i));
+
+    // Verify resends match replayed drops
+    quint64 num_packets = values.length();
+    Bridge_Stats tx = bridge->get_tx_stats(MAJOR_KEY_IO, MINOR_KEY_IO_DIO_WRITE);
+    QCOMPARE(tx.packets - num_packets,
+             expected_drop_retries(seed, drop_rate, values.length()));
+}
+
+void LINK_EMULATOR_TESTS::test_drop_retries_data()
+{
+    // Input data columns
+    QTest::addColumn<quint32>("seed");
+    QTest::addColumn<double>("drop_rate");
+    QTest::addColumn<quint16>("pin_offset");
+
+    // Load in data
+    QTest::newRow("Clean") << (quint32) 1 << 0.0 << (quint16) 10;
+    QTest::newRow("Drop 10% (seed 7)") << (quint32) 7 << 0.10 << (quint16) 0x0A0A;
+    QTest::newRow("Drop 10% (seed 42)") << (quint32) 42 << 0.10 << (quint16) 300;
+    QTest::newRow("Drop 25% (seed 1234)") << (quint32) 1234 << 0.25 << (quint16) 0xFF00;
+}
+
+void LINK_EMULATOR_TESTS::test_corrupt_latency()
+{
+    // Fetch data
+    QFETCH(quint32, seed);
+    QFETCH(double, corrupt_rate);
+    QFETCH(quint32, latency_ms);
+    QFETCH(quint32, jitter_ms);
+
+    // Setup link
+    Link_Emulator_Settings link_settings = Link_Emulator_Settings_DEFAULT;
+    link_settings.latency_ms = latency_ms;
+    link_settings.jitter_ms = jitter_ms;
+    link_settings.corrupt_rate = corrupt_rate;
+    link_settings.seed = seed;
+    QVERIFY(start_link(link_settings));
+
+    // Send one packet per pin
+    QList<uint16_t> values = test_pin_values((uint16_t) seed);
+    QVERIFY(send_pin_writes(values));
+
+    // Verify every write landed (checksums reject corrupted packets)
+    for (int i = 0; i < values.length(); i++)
+        QTRY_COMPARE(emulator->pin_read(true, i), values.at(i));
+
+    // Verify resends stay bounded (resync timing depends on the uC)
+    quint64 num_packets = values.length();
+    Bridge_Stats tx = bridge->get_tx_stats(MAJOR_KEY_IO, MINOR_KEY_IO_DIO_WRITE);
+    QVERIFY(num_packets <= tx.packets);
+    QVERIFY((tx.packets - num_packets) <= (3 * num_packets));
+    if (corrupt_rate <= 0.0) QCOMPARE(tx.packets, num_packets);
+}
+
+void LINK_EMULATOR_TESTS::test_corrupt_latency_data()
+{
+    // Input data columns
+    QTest::addColumn<quint32>("seed");
+    QTest::addColumn<double>("corrupt_rate");
+    QTest::addColumn<quint32>("latency_ms");
+    QTest::addColumn<quint32>("jitter_ms");
+
+    // Load in data
+    QTest::newRow("Latency only") << (quint32) 3 << 0.0 << (quint32) 20 << (quint32) 5;
+    QTest::newRow("Corrupt 1%") << (quint32) 11 << 0.01 << (quint32) 2 << (quint32) 0;
+    QTest::newRow("Corrupt 2% & latency") << (quint32) 99 << 0.02 << (quint32) 10 << (quint32) 3;
+}
+
+void LINK_EMULATOR_TESTS::test_throughput()
+{
+    // Fetch data
+    QFETCH(quint32, latency_ms);
+    QFETCH(quint32, bits_per_sec);
+
+    // Setup clean link
+    Link_Emulator_Settings link_settings = Link_Emulator_Settings_DEFAULT;
+    link_settings.latency_ms = latency_ms;
+    link_settings.bits_per_sec = bits_per_sec;
+    QVERIFY(start_link(link_settings));
+
+    // Benchmark one packet per pin (stop-and-wait so latency bound)
+    QList<uint16_t> values = test_pin_values(0);
+    bool sent = true;
+    QBENCHMARK {
+        sent = (sent && send_pin_writes(values));
+    }
+    QVERIFY(sent);
+
+    // Clean link never resends
+    bridge->clear_stats();
+    QVERIFY(send_pin_writes(values));
+    Bridge_Stats tx = bridge->get_tx_stats(MAJOR_KEY_IO, MINOR_KEY_IO_DIO_WRITE);
+    QCOMPARE(tx.packets, (quint64) values.length());
+}
+
+void LINK_EMULATOR_TESTS::test_throughput_data()
+{
+    // Input data columns
+    QTest::addColumn<quint32>("latency_ms");
+    QTest::addColumn<quint32>("bits_per_sec");
+
+    // Load in data
+    QTest::newRow("Unlimited") << (quint32) 0 << (quint32) 0;
+    QTest::newRow("115200 baud") << (quint32) 0 << (quint32) 115200;
+    QTest::newRow("115200 baud & 1 ms") << (quint32) 1 << (quint32) 115200;
+}
+
+bool LINK_EMULATOR_TESTS::start_link(Link_Emulator_Settings link_settings)
+{
+    // Apply settings (reseeds) & start emulated uC
+    emulator->set_settings(&link_settings);
+    emulator->open();
+    return emulator->isConnected();
+}
+
+bool LINK_EMULATOR_TESTS::send_pin_writes(QList<uint16_t> values)
+{
+    // Build DIO writes (chunk size splits one write per packet)
+    QByteArray chunk;
+    for (int i = 0; i < values.length(); i++)
+    {
+        chunk.append((char) i);
+        chunk.append((char) ((values.at(i) >> 8) & 0xFF));
+        chunk.append((char) (values.at(i) & 0xFF));
+    }
+    bridge->set_chunk_size(s2_io_write_end);
+
+    // Close bridge if transfer stalls (exits ack loop)
+    QTimer guard;
+    guard.setSingleShot(true);
+    connect(&guard, SIGNAL(timeout()),
+            bridge, SLOT(close_bridge()),
+            Qt::DirectConnection);
+    guard.start(transfer_timeout_ms);
+
+    // Send (returns after last ack)
+    bridge->send_chunk(MAJOR_KEY_IO, MINOR_KEY_IO_DIO_WRITE, chunk);
+
+    // Transfer done if guard never fired
+    bool done = guard.isActive();
+    guard.stop();
+    return done;
+}
+
+QList<uint16_t> LINK_EMULATOR_TESTS::test_pin_values(uint16_t offset)
+{
+    // Distinct non-zero value for each pin
+    QList<uint16_t> values;
+    for (uint8_t i = 0; i < LINK_EMULATOR_MCU::num_dio_pins; i++)
+        values.append((uint16_t) (offset + (i * 257) + 1));
+    return values;
+}
@@ -0,0 +1,62 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LINK_EMULATOR_TESTS_H
+#define LINK_EMULATOR_TESTS_H
+
+#include <QObject>
+
+// Objects under test
+#include "../../src/communication/link-emulator.hpp"
+#include "../../src/gui-helpers/gui-comm-bridge.hpp"
+
+class LINK_EMULATOR_TESTS : public QObject
+{
+    Q_OBJECT
+
+public:
+    LINK_EMULATOR_TESTS();
+    ~LINK_EMULATOR_TESTS();
+
+private slots:
+    // Setup and cleanup functions
+    void init();
+    void cleanup();
+
+    // Bridge over emulated link tests
+    void test_drop_retries();
+    void test_drop_retries_data();
+
+    void test_corrupt_latency();
+    void test_corrupt_latency_data();
+
+    // Packets per second over emulated link
+    void test_throughput();
+    void test_throughput_data();
+
+private:
+    LINK_EMULATOR *emulator;
+    GUI_COMM_BRIDGE *bridge;
+
+    // Test helpers
+    bool start_link(Link_Emulator_Settings link_settings);
+    bool send_pin_writes(QList<uint16_t> values);
+    QList<uint16_t> test_pin_values(uint16_t offset);
+};
+
+#endif // LINK_EMULATOR_TESTS_H
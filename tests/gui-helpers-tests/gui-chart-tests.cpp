@@ -0,0 +1,464 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-chart-tests.hpp"
+
+// Testing infrastructure includes
+#include <QtTest>
+#include <QtMath>
+
+// Test series (one point per second)
+static const QString test_series_uid = "test-series";
+static const int test_interval_ms = 1000;
+
+GUI_CHART_TESTS::GUI_CHART_TESTS()
+{
+    store = nullptr;
+}
+
+GUI_CHART_TESTS::~GUI_CHART_TESTS()
+{
+    // Delete store if allocated
+    if (store) delete store;
+}
+
+void GUI_CHART_TESTS::init()
+{
+    // Create new store for each test
+    store = new GUI_CHART_STORE();
+    QVERIFY(store);
+}
+
+void GUI_CHART_TESTS::cleanup()
+{
+    // Delete store
+    if (store) delete store;
+    store = nullptr;
+}
+
+void GUI_CHART_TESTS::test_store_refs()
+{
+    // Fetch data
+    QFETCH(QStringList, ops);
+    QFETCH(QStringList, expected_refs);
+    QFETCH(int, expected_series);
+
+    // Run ops ("ref:<owner>:<series>", "rel:<owner>:<series>" or "all:<owner>")
+    // with a point appended to every referenced series after each op
+    const int owners[3] = {0, 1, 2};
+    QStringList op_parts;
+    QString series_uid;
+    for (int i = 0; i < ops.length(); i++)
+    {
+        op_parts = ops.at(i).split(':');
+        const void *owner = &owners[op_parts.at(1).toInt()];
+        series_uid = op_parts.value(2);
+        if (op_parts.at(0) == "ref") store->reference(series_uid, owner, 10.0, test_interval_ms);
+        else if (op_parts.at(0) == "rel") store->release(series_uid, owner);
+        else if (op_parts.at(0) == "all") store->release_all(owner);
+        else QFAIL(qPrintable("Unknown op: " + ops.at(i)));
+
+        // Appends only land in stored series
+        if (!series_uid.isEmpty())
+        {
+            QCOMPARE(store->append(series_uid, QPointF(i, 0)), 0 < store->get_refs(series_uid));
+        }
+    }
+
+    // Verify reference counts ("<series>=<refs>", removed series have none)
+    foreach (QString refs, expected_refs)
+    {
+        op_parts = refs.split('=');
+        QCOMPARE(store->get_refs(op_parts.at(0)), op_parts.at(1).toInt());
+
+        QReadLocker locker(store->get_lock());
+        QCOMPARE(store->find(op_parts.at(0)) != nullptr, 0 < op_parts.at(1).toInt());
+    }
+    QCOMPARE(store->get_num_series(), expected_series);
+}
+
+void GUI_CHART_TESTS::test_store_refs_data()
+{
+    // Input data columns
+    QTest::addColumn<QStringList>("ops");
+
+    // Expected output columns
+    QTest::addColumn<QStringList>("expected_refs");
+    QTest::addColumn<int>("expected_series");
+
+    // Load in data
+    QTest::newRow("Single ref")
+            << QStringList({"ref:0:a"})
+            << QStringList({"a=1"}) << 1;
+    QTest::newRow("Repeat ref counts once")
+            << QStringList({"ref:0:a", "ref:0:a"})
+            << QStringList({"a=1"}) << 1;
+    QTest::newRow("Shared series")
+            << QStringList({"ref:0:a", "ref:1:a"})
+            << QStringList({"a=2"}) << 1;
+    QTest::newRow("Release keeps shared")
+            << QStringList({"ref:0:a", "ref:1:a", "rel:0:a"})
+            << QStringList({"a=1"}) << 1;
+    QTest::newRow("Release last removes")
+            << QStringList({"ref:0:a", "ref:1:a", "rel:0:a", "rel:1:a"})
+            << QStringList({"a=0"}) << 0;
+    QTest::newRow("Release twice")
+            << QStringList({"ref:0:a", "ref:1:a", "rel:0:a", "rel:0:a"})
+            << QStringList({"a=1"}) << 1;
+    QTest::newRow("Release unreferenced owner")
+            << QStringList({"ref:0:a", "rel:2:a"})
+            << QStringList({"a=1"}) << 1;
+    QTest::newRow("Release unknown series")
+            << QStringList({"ref:0:a", "rel:0:b"})
+            << QStringList({"a=1", "b=0"}) << 1;
+    QTest::newRow("Release all")
+            << QStringList({"ref:0:a", "ref:0:b", "ref:1:b", "ref:1:c", "all:0"})
+            << QStringList({"a=0", "b=1", "c=1"}) << 2;
+    QTest::newRow("Release all owners")
+            << QStringList({"ref:0:a", "ref:0:b", "ref:1:b", "all:1", "all:0"})
+            << QStringList({"a=0", "b=0"}) << 0;
+    QTest::newRow("Release all unknown owner")
+            << QStringList({"ref:0:a", "ref:1:b", "all:2"})
+            << QStringList({"a=1", "b=1"}) << 2;
+    QTest::newRow("Re-add after release")
+            << QStringList({"ref:0:a", "rel:0:a", "ref:1:a"})
+            << QStringList({"a=1"}) << 1;
+}
+
+void GUI_CHART_TESTS::test_sampler_lttb()
+{
+    // Fetch data
+    QFETCH(int, num_points);
+    QFETCH(double, x_duration);
+    QFETCH(int, width_px);
+    QFETCH(int, expected_points);
+
+    // Store rising points (min/max of a bucket are its ends)
+    QVERIFY(fill_store(test_series_uid, num_points, x_duration));
+
+    // Catch sampled points
+    GUI_CHART_SAMPLER sampler(store);
+    QVector<QPointF> frame;
+    int num_frames = 0;
+    connect(&sampler, &GUI_CHART_SAMPLER::series_sampled,
+            [&](QString series_uid, QVector<QPointF> points) {
+        if (series_uid != test_series_uid) return;
+        frame = points;
+        num_frames += 1;
+    });
+
+    // Sample series
+    sampler.set_view(x_duration, width_px, CHART_SAMPLE_LTTB);
+    sampler.add_series(test_series_uid);
+    sampler.update_series(QList<QString>({test_series_uid}));
+    QCOMPARE(num_frames, 1);
+
+    // Verify point count (one per finished bucket, extremes of
+    // the last two buckets) & never more than the raw points
+    QCOMPARE(frame.length(), expected_points);
+    QVERIFY(frame.length() <= num_points);
+
+    // Verify endpoints kept
+    QCOMPARE(frame.first(), QPointF(0, 0));
+    QCOMPARE(frame.last(), QPointF(num_points - 1, num_points - 1));
+
+    // Verify stored points in x order
+    for (int i = 1; i < frame.length(); i++)
+    {
+        QVERIFY(frame.at(i - 1).x() < frame.at(i).x());
+        QCOMPARE(frame.at(i).y(), frame.at(i).x());
+    }
+}
+
+void GUI_CHART_TESTS::test_sampler_lttb_data()
+{
+    // Input data columns
+    QTest::addColumn<int>("num_points");
+    QTest::addColumn<double>("x_duration");
+    QTest::addColumn<int>("width_px");
+
+    // Expected output columns
+    QTest::addColumn<int>("expected_points");
+
+    // Load in data (LTTB keeps 2 buckets per pixel, buckets before the
+    // filling one & the one before it are finished)
+    QTest::newRow("Fits raw") << 20 << 200.0 << 10 << 20;
+    QTest::newRow("10 points per bucket") << 200 << 200.0 << 10 << 22;
+    QTest::newRow("50 points per bucket") << 1000 << 1000.0 << 10 << 22;
+    QTest::newRow("Newest bucket 1 point") << 191 << 200.0 << 10 << 21;
+    QTest::newRow("Wide view") << 1000 << 1000.0 << 100 << 202;
+}
+
+void GUI_CHART_TESTS::test_stats_window()
+{
+    // Fetch data
+    QFETCH(int, num_points);
+    QFETCH(int, window_len);
+    QFETCH(int, rebuild_every);
+
+    // Add points & evict oldest once window full
+    GUI_CHART_STATS stats;
+    stats.reset(window_len);
+    QVector<QPointF> points;
+    int first = 0;
+    for (int i = 0; i < num_points; i++)
+    {
+        points.append(QPointF(i, get_test_value(i)));
+        stats.add(points.last());
+        if (window_len < (points.length() - first))
+        {
+            stats.remove(points.at(first));
+            first += 1;
+        }
+
+        // Restart window from kept points (as sampler does once per window)
+        if (rebuild_every && !((i + 1) % rebuild_every))
+        {
+            HISTORY_RING<QPointF> ring;
+            ring.reset(window_len);
+            for (int j = first; j < points.length(); j++) ring.append(points.at(j));
+            stats.set_window(ring);
+        }
+
+        // Verify window against brute force
+        QVector<double> window_values;
+        for (int j = first; j < points.length(); j++) window_values.append(points.at(j).y());
+        verify_stats(stats.get_window(), window_values);
+        if (QTest::currentTestFailed()) return;
+    }
+
+    // Verify since start against brute force
+    QVector<double> total_values;
+    foreach (QPointF p, points) total_values.append(p.y());
+    verify_stats(stats.get_total(), total_values);
+}
+
+void GUI_CHART_TESTS::test_stats_window_data()
+{
+    // Input data columns
+    QTest::addColumn<int>("num_points");
+    QTest::addColumn<int>("window_len");
+    QTest::addColumn<int>("rebuild_every");
+
+    // Load in data
+    QTest::newRow("Window not full") << 10 << 32 << 0;
+    QTest::newRow("Window of 1") << 50 << 1 << 0;
+    QTest::newRow("Evictions") << 500 << 16 << 0;
+    QTest::newRow("Long run") << 10000 << 100 << 0;
+    QTest::newRow("Rebuilt windows") << 500 << 16 << 16;
+    QTest::newRow("Rebuilt mid window") << 500 << 16 << 7;
+}
+
+void GUI_CHART_TESTS::test_fft_sine()
+{
+    // Fetch data
+    QFETCH(int, size);
+    QFETCH(double, cycles);
+    QFETCH(double, amplitude);
+    QFETCH(double, offset);
+
+    // Build sine (whole cycles land in one bin)
+    QVector<float> in(size);
+    for (int i = 0; i < size; i++)
+    {
+        in[i] = (float) (offset + amplitude * qSin(2.0 * M_PI * cycles * i / size));
+    }
+
+    // Transform
+    GUI_CHART_FFT fft;
+    QVERIFY(fft.set_size(size));
+    QCOMPARE(fft.get_size(), size);
+    int num_bins = size / 2 + 1;
+    QVector<float> out_re(num_bins), out_im(num_bins);
+    fft.forward(in.constData(), out_re.data(), out_im.data());
+
+    // Verify every bin against naive DFT (float error grows with size)
+    double tolerance = 1e-4 * size * (amplitude + qAbs(offset));
+    double dft_re, dft_im, angle;
+    for (int k = 0; k < num_bins; k++)
+    {
+        dft_re = 0;
+        dft_im = 0;
+        for (int i = 0; i < size; i++)
+        {
+            angle = -2.0 * M_PI * k * i / size;
+            dft_re += in[i] * qCos(angle);
+            dft_im += in[i] * qSin(angle);
+        }
+        QVERIFY2(qAbs(out_re[k] - dft_re) < tolerance, qPrintable(QString("real bin %1").arg(k)));
+        QVERIFY2(qAbs(out_im[k] - dft_im) < tolerance, qPrintable(QString("imag bin %1").arg(k)));
+    }
+
+    // Verify sine peak (whole cycles only)
+    int bin = (int) cycles;
+    if (bin == cycles)
+    {
+        double magnitude = qSqrt(out_re[bin] * out_re[bin] + out_im[bin] * out_im[bin]);
+        QVERIFY(qAbs(magnitude - amplitude * size / 2.0) < tolerance);
+    }
+}
+
+void GUI_CHART_TESTS::test_fft_sine_data()
+{
+    // Input data columns
+    QTest::addColumn<int>("size");
+    QTest::addColumn<double>("cycles");
+    QTest::addColumn<double>("amplitude");
+    QTest::addColumn<double>("offset");
+
+    // Load in data
+    QTest::newRow("Smallest size") << 4 << 1.0 << 1.0 << 0.0;
+    QTest::newRow("Bin 1") << 64 << 1.0 << 1.0 << 0.0;
+    QTest::newRow("Bin 5 with offset") << 256 << 5.0 << 2.5 << 1.0;
+    QTest::newRow("Below Nyquist") << 128 << 63.0 << 1.0 << 0.0;
+    QTest::newRow("Off bin leakage") << 512 << 10.5 << 1.0 << 0.0;
+    QTest::newRow("Large size") << 4096 << 300.0 << 100.0 << -20.0;
+}
+
+void GUI_CHART_TESTS::test_fft_size()
+{
+    // Fetch data
+    QFETCH(int, size);
+    QFETCH(bool, expected_set);
+
+    // Verify only powers of two (at least 4) accepted & size kept on failure
+    GUI_CHART_FFT fft;
+    QVERIFY(fft.set_size(8));
+    QCOMPARE(fft.set_size(size), expected_set);
+    QCOMPARE(fft.get_size(), expected_set ? size : 8);
+}
+
+void GUI_CHART_TESTS::test_fft_size_data()
+{
+    // Input data columns
+    QTest::addColumn<int>("size");
+
+    // Expected output columns
+    QTest::addColumn<bool>("expected_set");
+
+    // Load in data
+    QTest::newRow("0") << 0 << false;
+    QTest::newRow("2") << 2 << false;
+    QTest::newRow("4") << 4 << true;
+    QTest::newRow("12") << 12 << false;
+    QTest::newRow("1024") << 1024 << true;
+    QTest::newRow("1000") << 1000 << false;
+    QTest::newRow("Negative") << -8 << false;
+}
+
+bool GUI_CHART_TESTS::fill_store(QString series_uid, int num_points, double duration_s)
+{
+    // Reference series for window at test rate
+    store->reference(series_uid, this, duration_s, test_interval_ms);
+
+    // Append one point per interval (y equal to x)
+    for (int i = 0; i < num_points; i++)
+    {
+        if (!store->append(series_uid, QPointF(i, i))) return false;
+    }
+    return true;
+}
+
+double GUI_CHART_TESTS::get_test_value(int i)
+{
+    // Repeatable values with runs up & down (exercises min/max deques)
+    return 100.0 * qSin(0.37 * i) + ((i * 7919) % 31) - 15.0;
+}
+
+void GUI_CHART_TESTS::verify_stats(const Chart_Stats &stats, const QVector<double> &values)
+{
+    // Brute force statistics
+    int n = values.length();
+    double min = values.first(), max = values.first(), sum = 0, sum_sq = 0;
+    foreach (double y, values)
+    {
+        min = qMin(min, y);
+        max = qMax(max, y);
+        sum += y;
+        sum_sq += y * y;
+    }
+    double mean = sum / n;
+    double var_sum = 0;
+    foreach (double y, values) var_sum += (y - mean) * (y - mean);
+
+    // Verify (mean & deviations allow rounding drift)
+    QCOMPARE(stats.count, (quint64) n);
+    QCOMPARE(stats.min, min);
+    QCOMPARE(stats.max, max);
+    QVERIFY(qAbs(stats.mean - mean) < 1e-6);
+    QVERIFY(qAbs(stats.rms - qSqrt(sum_sq / n)) < 1e-6);
+    QVERIFY(qAbs(stats.std - ((1 < n) ? qSqrt(var_sum / (n - 1)) : 0.0)) < 1e-6);
+}
+
+void GUI_CHART_TESTS::test_spectrum_jitter()
+{
+    // Fetch data
+    QFETCH(double, jitter_ms);
+    QFETCH(double, amplitude);
+
+    // Build sine on bin 10 of 256 points at 1 kHz (times jittered like
+    // polled samples, ends kept so frame rate stays 1 kHz)
+    const int size = CHART_FFT_MIN_SIZE;
+    const int bin = 10;
+    double freq_hz = bin * 1000.0 / size;
+    QVector<QPointF> samples;
+    qsrand(7);
+    double t;
+    for (int i = 0; i < size; i++)
+    {
+        t = i;
+        if ((0 < i) && (i < (size - 1))) t += jitter_ms * (2.0 * qrand() / RAND_MAX - 1.0);
+        samples.append(QPointF(t, amplitude * qSin(2.0 * M_PI * freq_hz * t / 1000.0)));
+    }
+
+    // Run one frame
+    GUI_CHART_SPECTRUM spectrum;
+    spectrum.set_view(size, CHART_FFT_WINDOW_HANN, CHART_FFT_OVERLAP_0);
+    spectrum.add_series(test_series_uid);
+    QVector<QPointF> points;
+    connect(&spectrum, &GUI_CHART_SPECTRUM::spectrum_ready,
+            [&points](QString, QVector<QPointF> new_points) { points = new_points; });
+    spectrum.add_samples(test_series_uid, samples);
+    QCOMPARE(points.length(), size / 2 + 1);
+
+    // Verify peak at sine (frequency & amplitude)
+    int peak = 0;
+    for (int k = 1; k < points.length(); k++) if (points[peak].y() < points[k].y()) peak = k;
+    QCOMPARE(peak, bin);
+    QVERIFY(qAbs(points[peak].x() - freq_hz) < 1e-6);
+    QVERIFY(qAbs(points[peak].y() - 20.0 * log10(amplitude)) < 0.5);
+
+    // Verify jitter not spread as noise (resampled onto even grid)
+    for (int k = 0; k < points.length(); k++)
+    {
+        if (qAbs(k - bin) < 3) continue;
+        QVERIFY2(points[k].y() < (points[peak].y() - 50.0), qPrintable(QString("bin %1").arg(k)));
+    }
+}
+
+void GUI_CHART_TESTS::test_spectrum_jitter_data()
+{
+    // Input data columns
+    QTest::addColumn<double>("jitter_ms");
+    QTest::addColumn<double>("amplitude");
+
+    // Load in data
+    QTest::newRow("Even") << 0.0 << 1.0;
+    QTest::newRow("Jitter 30%") << 0.3 << 1.0;
+    QTest::newRow("Jitter 45%") << 0.45 << 100.0;
+}
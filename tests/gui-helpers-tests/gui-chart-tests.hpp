@@ -0,0 +1,78 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_CHART_TESTS_H
+#define GUI_CHART_TESTS_H
+
+#include <QObject>
+#include <QPointF>
+#include <QVector>
+
+// Objects under test
+#include "../../src/gui-helpers/gui-chart-fft.hpp"
+#include "../../src/gui-helpers/gui-chart-stats.hpp"
+#include "../../src/gui-helpers/gui-chart-store.hpp"
+#include "../../src/gui-helpers/gui-chart-sampler.hpp"
+#include "../../src/gui-helpers/gui-chart-spectrum.hpp"
+
+class GUI_CHART_TESTS : public QObject
+{
+    Q_OBJECT
+
+public:
+    GUI_CHART_TESTS();
+    ~GUI_CHART_TESTS();
+
+private slots:
+    // Setup and cleanup functions
+    void init();
+    void cleanup();
+
+    // Store tests
+    void test_store_refs();
+    void test_store_refs_data();
+
+    // Sampler tests
+    void test_sampler_lttb();
+    void test_sampler_lttb_data();
+
+    // Statistics tests
+    void test_stats_window();
+    void test_stats_window_data();
+
+    // FFT tests
+    void test_fft_sine();
+    void test_fft_sine_data();
+
+    void test_fft_size();
+    void test_fft_size_data();
+
+    // Spectrum tests
+    void test_spectrum_jitter();
+    void test_spectrum_jitter_data();
+
+private:
+    GUI_CHART_STORE *store;
+
+    // Test helpers
+    bool fill_store(QString series_uid, int num_points, double duration_s);
+    double get_test_value(int i);
+    void verify_stats(const Chart_Stats &stats, const QVector<double> &values);
+};
+
+#endif // GUI_CHART_TESTS_H
@@ -0,0 +1,114 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-device-clock-tests.hpp"
+
+// Testing infrastructure includes
+#include <QtTest>
+
+#include <random>
+
+// Host start time (us since epoch), time between packets & largest packet delay
+static const qint64 test_host_start_us = Q_INT64_C(1600000000000000);
+static const qint64 test_packet_us = 10000;
+static const int test_max_delay_us = 2000;
+
+// Largest mapping error (delay plus drift over a block)
+static const qint64 test_max_error_us = 3000;
+
+GUI_DEVICE_CLOCK_TESTS::GUI_DEVICE_CLOCK_TESTS()
+{
+    /* DO NOTHING */
+}
+
+GUI_DEVICE_CLOCK_TESTS::~GUI_DEVICE_CLOCK_TESTS()
+{
+    /* DO NOTHING */
+}
+
+void GUI_DEVICE_CLOCK_TESTS::test_clock_fit()
+{
+    // Fetch data
+    QFETCH(double, drift_ppm);
+    QFETCH(quint32, start_us);
+    QFETCH(int, restart_ms);
+    QFETCH(quint32, restart_us);
+    QFETCH(int, duration_ms);
+
+    // Send device times with random delays (every fifth undelayed)
+    GUI_DEVICE_CLOCK clock;
+    QVERIFY(!clock.is_valid());
+    std::mt19937 rng(1);
+    double rate = 1.0 + (drift_ppm / 1e6);
+    qint64 base_us = start_us, base_host_us = test_host_start_us;
+    qint64 host_us, device_us, arrival_us, unwrapped_us, error_us;
+    int num_packets = duration_ms * 1000 / test_packet_us;
+    for (int i = 0; i <= num_packets; i++)
+    {
+        // Restart device counter
+        host_us = test_host_start_us + i * test_packet_us;
+        if ((0 <= restart_ms) && ((i * test_packet_us) == (restart_ms * 1000)))
+        {
+            base_us = restart_us;
+            base_host_us = host_us;
+        }
+
+        // Get device time (64 bit) & arrival time
+        device_us = base_us + qRound64((host_us - base_host_us) * rate);
+        arrival_us = host_us + ((i % 5) ? (rng() % test_max_delay_us) : 0);
+
+        // Verify unwrapped from 32 bits (restart drops wraps)
+        unwrapped_us = clock.unwrap((uint32_t) device_us, arrival_us);
+        QCOMPARE(unwrapped_us, device_us);
+
+        // Verify mapped back to host time
+        clock.update(unwrapped_us, arrival_us);
+        QVERIFY(clock.is_valid());
+        error_us = clock.to_host_us(unwrapped_us) - host_us;
+        QVERIFY2(qAbs(error_us) <= test_max_error_us,
+                 qPrintable(QString("packet %1 off by %2 us").arg(i).arg(error_us)));
+    }
+
+    // Verify drift fitted (host minus device time falls as device runs fast)
+    QVERIFY2(qAbs(clock.get_drift_ppm() + drift_ppm) < 20.0,
+             qPrintable(QString("drift %1 ppm").arg(clock.get_drift_ppm())));
+
+    // Verify reset forgets estimate
+    clock.reset();
+    QVERIFY(!clock.is_valid());
+    QCOMPARE(clock.to_host_us(device_us), device_us);
+}
+
+void GUI_DEVICE_CLOCK_TESTS::test_clock_fit_data()
+{
+    // Input data columns
+    QTest::addColumn<double>("drift_ppm");
+    QTest::addColumn<quint32>("start_us");
+    QTest::addColumn<int>("restart_ms");
+    QTest::addColumn<quint32>("restart_us");
+    QTest::addColumn<int>("duration_ms");
+
+    // Load in data
+    QTest::newRow("No drift") << 0.0 << (quint32) 0 << -1 << (quint32) 0 << 40000;
+    QTest::newRow("Fast device") << 250.0 << (quint32) 1000000 << -1 << (quint32) 0 << 40000;
+    QTest::newRow("Slow device") << -400.0 << (quint32) 1000000 << -1 << (quint32) 0 << 40000;
+    QTest::newRow("32 bit wrap") << 100.0 << (quint32) (0xFFFFFFFF - 10000000) << -1 << (quint32) 0 << 40000;
+    QTest::newRow("Restart counter back") << 100.0 << (quint32) 100000000 << 20000 << (quint32) 500000 << 50000;
+    QTest::newRow("Restart looks like wrap") << 100.0 << (quint32) 3000000000 << 20000 << (quint32) 0 << 50000;
+    QTest::newRow("Restart before wrap") << -100.0 << (quint32) (0xFFFFFFFF - 30000000) << 20000 << (quint32) 0 << 50000;
+}
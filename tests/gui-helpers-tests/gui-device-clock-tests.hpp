@@ -0,0 +1,41 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_DEVICE_CLOCK_TESTS_H
+#define GUI_DEVICE_CLOCK_TESTS_H
+
+#include <QObject>
+
+// Objects under test
+#include "../../src/gui-helpers/gui-device-clock.hpp"
+
+class GUI_DEVICE_CLOCK_TESTS : public QObject
+{
+    Q_OBJECT
+
+public:
+    GUI_DEVICE_CLOCK_TESTS();
+    ~GUI_DEVICE_CLOCK_TESTS();
+
+private slots:
+    // Unwrap & drift fit tests
+    void test_clock_fit();
+    void test_clock_fit_data();
+};
+
+#endif // GUI_DEVICE_CLOCK_TESTS_H
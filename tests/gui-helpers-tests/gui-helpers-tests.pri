@@ -0,0 +1,11 @@
+SOURCES += \
+    $$PWD/gui-chart-tests.cpp \
+    $$PWD/gui-device-clock-tests.cpp \
+    $$PWD/gui-log-tests.cpp \
+    $$PWD/gui-pin-tests.cpp
+
+HEADERS += \
+    $$PWD/gui-chart-tests.hpp \
+    $$PWD/gui-device-clock-tests.hpp \
+    $$PWD/gui-log-tests.hpp \
+    $$PWD/gui-pin-tests.hpp
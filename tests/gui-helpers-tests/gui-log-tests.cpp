@@ -0,0 +1,675 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-log-tests.hpp"
+#include "../../src/gui-helpers/gui-log-writer.hpp"
+#include "../../src/gui-helpers/gui-log-replay.hpp"
+
+// Testing infrastructure includes
+#include <QtTest>
+
+#include <QFile>
+#include <QDateTime>
+#include <QSignalSpy>
+#include <QElapsedTimer>
+
+#include "../../src/user-interfaces/gui-io-control-minor-keys.h"
+
+// Log start time (ms since epoch)
+static const qint64 test_start_ms = 1000;
+
+// Replayed row & wall time it was emitted
+typedef struct {
+    uint8_t pinType;
+    QList<uint8_t> pin_nums;
+    QVector<float> values;
+    qint64 time_ms;
+    qint64 wall_ms;
+} Replayed_Row;
+
+GUI_LOG_TESTS::GUI_LOG_TESTS()
+{
+    temp_dir = nullptr;
+}
+
+GUI_LOG_TESTS::~GUI_LOG_TESTS()
+{
+    // Delete temp dir if allocated (removes logs)
+    if (temp_dir) delete temp_dir;
+}
+
+void GUI_LOG_TESTS::init()
+{
+    // Create new dir for each test's logs
+    temp_dir = new QTemporaryDir();
+    QVERIFY(temp_dir);
+    QVERIFY(temp_dir->isValid());
+}
+
+void GUI_LOG_TESTS::cleanup()
+{
+    // Delete temp dir (removes logs)
+    if (temp_dir)
+    {
+        delete temp_dir;
+        temp_dir = nullptr;
+    }
+}
+
+void GUI_LOG_TESTS::test_pin_log_seek()
+{
+    // Fetch data
+    QFETCH(quint64, num_records);
+    QFETCH(quint32, stride);
+    QFETCH(int, flush_every);
+    QFETCH(QList<qint64>, seek_times);
+
+    // Write log
+    QString logPath = temp_dir->filePath("seek.bin");
+    QVERIFY(write_pin_log(logPath, num_records, stride, flush_every));
+
+    // Reopen & verify header
+    GUI_PIN_LOG_READER reader;
+    QVERIFY(reader.open(logPath));
+    QCOMPARE(reader.get_start_ms(), test_start_ms);
+    QList<Pin_Log_Column> expected_cols = get_test_columns();
+    QList<Pin_Log_Column> cols = reader.get_columns();
+    QCOMPARE(cols.length(), expected_cols.length());
+    for (int c = 0; c < cols.length(); c++)
+    {
+        QCOMPARE(cols.at(c).pinType, expected_cols.at(c).pinType);
+        QCOMPARE(cols.at(c).pin_num, expected_cols.at(c).pin_num);
+        QCOMPARE(cols.at(c).mode, expected_cols.at(c).mode);
+        QCOMPARE(cols.at(c).range.min, expected_cols.at(c).range.min);
+        QCOMPARE(cols.at(c).range.max, expected_cols.at(c).range.max);
+        QCOMPARE(cols.at(c).range.step, expected_cols.at(c).range.step);
+        QCOMPARE(cols.at(c).range.div, expected_cols.at(c).range.div);
+    }
+
+    // Verify records & seeks
+    verify_pin_log(&reader, num_records);
+    foreach (qint64 time_ms, seek_times)
+    {
+        // First record at or after time (brute force)
+        quint64 expected = 0;
+        while ((expected < num_records) && (get_test_time(expected) < time_ms)) expected++;
+        QCOMPARE(reader.find_record(time_ms), expected);
+    }
+}
+
+void GUI_LOG_TESTS::test_pin_log_seek_data()
+{
+    // Input data columns
+    QTest::addColumn<quint64>("num_records");
+    QTest::addColumn<quint32>("stride");
+    QTest::addColumn<int>("flush_every");
+    QTest::addColumn<QList<qint64>>("seek_times");
+
+    // Seeks before, at, between & after records (pairs share a time)
+    QList<qint64> seeks = {0, test_start_ms, test_start_ms + 5, test_start_ms + 10,
+                           test_start_ms + 155, test_start_ms + 160, test_start_ms + 4990,
+                           test_start_ms + 5000, test_start_ms + 100000};
+
+    // Load in data
+    QTest::newRow("Empty") << (quint64) 0 << (quint32) 16 << 1 << seeks;
+    QTest::newRow("Single flush") << (quint64) 1000 << (quint32) 16 << 0 << seeks;
+    QTest::newRow("Many flushes") << (quint64) 1000 << (quint32) 16 << 7 << seeks;
+    QTest::newRow("Stride 1") << (quint64) 100 << (quint32) 1 << 10 << seeks;
+    QTest::newRow("Default stride") << (quint64) 1000 << (quint32) PIN_LOG_INDEX_STRIDE_DEFAULT << 100 << seeks;
+}
+
+void GUI_LOG_TESTS::test_pin_log_truncated()
+{
+    // Fetch data
+    QFETCH(quint64, num_records);
+    QFETCH(quint32, stride);
+    QFETCH(int, keep_bytes);
+    QFETCH(quint64, expected_records);
+
+    // Write complete log
+    QString logPath = temp_dir->filePath("truncated.bin");
+    QVERIFY(write_pin_log(logPath, num_records, stride, 10));
+
+    // Cut file keep_bytes after last record (crash before footer done)
+    int num_cols = get_test_columns().length();
+    qint64 records_end = pin_log_cols_loc + (pin_log_col_len * num_cols)
+            + (qint64) num_records * (8 + 4*num_cols);
+    QFile logFile(logPath);
+    QVERIFY(logFile.resize(records_end + keep_bytes));
+
+    // Reopen & verify complete records are kept
+    GUI_PIN_LOG_READER reader;
+    QVERIFY(reader.open(logPath));
+    verify_pin_log(&reader, expected_records);
+
+    // Seeks search records without index
+    qint64 end_ms = expected_records ? get_test_time(expected_records - 1) : test_start_ms;
+    for (qint64 time_ms = test_start_ms - 10; time_ms <= (end_ms + 10); time_ms += 5)
+    {
+        quint64 expected = 0;
+        while ((expected < expected_records) && (get_test_time(expected) < time_ms)) expected++;
+        QCOMPARE(reader.find_record(time_ms), expected);
+    }
+}
+
+void GUI_LOG_TESTS::test_pin_log_truncated_data()
+{
+    // Input data columns
+    QTest::addColumn<quint64>("num_records");
+    QTest::addColumn<quint32>("stride");
+    QTest::addColumn<int>("keep_bytes");
+
+    // Expected output columns
+    QTest::addColumn<quint64>("expected_records");
+
+    // Footer length for 100 records with stride 16
+    int footer_len = pin_log_footer_head_len + (PIN_LOG_INDEX_ENTRY_LEN * 7) + pin_log_footer_tail_len;
+
+    // Load in data
+    QTest::newRow("Full footer") << (quint64) 100 << (quint32) 16 << footer_len << (quint64) 100;
+    QTest::newRow("No footer") << (quint64) 100 << (quint32) 16 << 0 << (quint64) 100;
+    QTest::newRow("Partial footer (short)") << (quint64) 100 << (quint32) 16 << 10 << (quint64) 100;
+    QTest::newRow("Partial footer (long)") << (quint64) 100 << (quint32) 16 << 30 << (quint64) 100;
+    QTest::newRow("Footer missing last byte") << (quint64) 100 << (quint32) 16 << (footer_len - 1) << (quint64) 100;
+    QTest::newRow("Partial record") << (quint64) 100 << (quint32) 16 << -5 << (quint64) 99;
+    QTest::newRow("Header only") << (quint64) 0 << (quint32) 16 << 0 << (quint64) 0;
+}
+
+void GUI_LOG_TESTS::test_log_writer_rotation()
+{
+    // Fetch data
+    QFETCH(bool, binary);
+    QFETCH(bool, threaded);
+    QFETCH(bool, compress);
+    QFETCH(quint64, rotate_bytes);
+    QFETCH(int, num_rows);
+    QFETCH(int, min_segments);
+
+    // Setup writer
+    GUI_LOG_WRITER writer;
+    Log_Writer_Settings settings = Log_Writer_Settings_DEFAULT;
+    settings.threaded = threaded;
+    settings.buffer_bytes = 256;
+    settings.rotate_bytes = rotate_bytes;
+    settings.compress = compress;
+    writer.set_settings(settings);
+
+    // Open first segment
+    QString logPath = temp_dir->filePath(binary ? "rotate.bin" : "rotate.txt");
+    QString header = "Started: " + QDateTime::currentDateTimeUtc().toString() + " with update rate 0.1 seconds\n";
+    QList<Pin_Log_Column> columns = get_test_columns();
+    if (binary) QVERIFY(writer.open_binary(logPath, columns));
+    else QVERIFY(writer.open_text(logPath, false, header));
+    QVERIFY(writer.is_open());
+    QCOMPARE(writer.is_binary(), binary);
+
+    // Write rows (other format is rejected)
+    // (binary times are after segment start, earlier times are clamped)
+    qint64 base_ms = QDateTime::currentMSecsSinceEpoch() + 60000;
+    QByteArray expected_text;
+    QString line;
+    for (int i = 0; i < num_rows; i++)
+    {
+        if (binary)
+        {
+            QVERIFY(writer.write_record(base_ms + get_test_time(i), get_test_values(i, columns.length())));
+        } else
+        {
+            line = QString::number(MINOR_KEY_IO_AIO) + "," + QString::number(i) + "," + QString::number(i * 0.5) + "\n";
+            expected_text.append(line.toUtf8());
+            QVERIFY(writer.write_text(line));
+        }
+    }
+    QVERIFY(!(binary ? writer.write_text("x\n") : writer.write_record(0, QVector<float>())));
+
+    // Close (writes queued rows & compresses last segment)
+    writer.close();
+    QVERIFY(!writer.is_open());
+    QCOMPARE(writer.get_dropped(), (quint64) 0);
+
+    // Verify segment names & count
+    QStringList segments = writer.get_segments();
+    QVERIFY(min_segments <= segments.length());
+    if (!rotate_bytes) QCOMPARE(segments.length(), 1);
+    QString suffix = compress ? GUI_LOG_WRITER_QZ_SUFFIX : "";
+    QString ext = binary ? ".bin" : ".txt";
+    for (int s = 0; s < segments.length(); s++)
+    {
+        QString name = "rotate" + ((s == 0) ? QString() : ("_" + QString::number(s))) + ext;
+        QCOMPARE(segments.at(s), temp_dir->filePath(name) + suffix);
+        QVERIFY(QFile::exists(segments.at(s)));
+        if (compress) QVERIFY(!QFile::exists(temp_dir->filePath(name)));
+    }
+
+    // Read back all rows in order across segments
+    if (binary)
+    {
+        quint64 record = 0;
+        GUI_PIN_LOG_READER reader;
+        foreach (QString segment, segments)
+        {
+            QVERIFY(reader.open(segment));
+            for (quint64 i = 0; i < reader.get_num_records(); i++, record++)
+            {
+                QCOMPARE(reader.get_time(i), base_ms + get_test_time(record));
+                QCOMPARE(reader.get_value(i, 1), get_test_values(record, columns.length()).at(1));
+            }
+            reader.close();
+        }
+        QCOMPARE(record, (quint64) num_rows);
+    } else
+    {
+        QByteArray text, data;
+        foreach (QString segment, segments)
+        {
+            // Each segment starts with header
+            QFile segmentFile(segment);
+            QVERIFY(segmentFile.open(QIODevice::ReadOnly));
+            data = segmentFile.readAll();
+            segmentFile.close();
+            if (compress) data = GUI_LOG_WRITER::decompress_data(data);
+            QVERIFY(data.startsWith(header.toUtf8()));
+            text.append(data.mid(header.toUtf8().length()));
+        }
+        QCOMPARE(text, expected_text);
+    }
+}
+
+void GUI_LOG_TESTS::test_log_writer_rotation_data()
+{
+    // Input data columns
+    QTest::addColumn<bool>("binary");
+    QTest::addColumn<bool>("threaded");
+    QTest::addColumn<bool>("compress");
+    QTest::addColumn<quint64>("rotate_bytes");
+    QTest::addColumn<int>("num_rows");
+
+    // Expected output columns
+    QTest::addColumn<int>("min_segments");
+
+    // Load in data
+    QTest::newRow("Text no rotate") << false << false << false << (quint64) 0 << 500 << 1;
+    QTest::newRow("Text rotate") << false << false << false << (quint64) 1024 << 500 << 5;
+    QTest::newRow("Text rotate threaded & compressed") << false << true << true << (quint64) 1024 << 500 << 5;
+    QTest::newRow("Binary no rotate compressed") << true << false << true << (quint64) 0 << 2000 << 1;
+    QTest::newRow("Binary rotate") << true << false << false << (quint64) 4096 << 2000 << 5;
+    QTest::newRow("Binary rotate threaded & compressed") << true << true << true << (quint64) 4096 << 2000 << 5;
+}
+
+void GUI_LOG_TESTS::test_log_writer_compression()
+{
+    // Fetch data
+    QFETCH(int, data_len);
+
+    // Build data (compressible runs & counter bytes)
+    QByteArray data(data_len, 0);
+    for (int i = 0; i < data_len; i++)
+        data[i] = (char) (((i / 64) % 2) ? (i * 7) : 'a');
+
+    // Write source & compress
+    QString srcPath = temp_dir->filePath("src.txt");
+    QString dstPath = srcPath + GUI_LOG_WRITER_QZ_SUFFIX;
+    QFile srcFile(srcPath);
+    QVERIFY(srcFile.open(QIODevice::WriteOnly));
+    QCOMPARE(srcFile.write(data), (qint64) data_len);
+    srcFile.close();
+    QVERIFY(GUI_LOG_WRITER::compress_file(srcPath, dstPath));
+
+    // Read back & decompress
+    QFile dstFile(dstPath);
+    QVERIFY(dstFile.open(QIODevice::ReadOnly));
+    QByteArray packed = dstFile.readAll();
+    dstFile.close();
+    QVERIFY(packed.startsWith(GUI_LOG_WRITER_QZ_MAGIC));
+    QCOMPARE(GUI_LOG_WRITER::decompress_data(packed), data);
+
+    // Cut last block keeps all complete blocks
+    int num_blocks = (data_len + GUI_LOG_WRITER_QZ_BLOCK_LEN - 1) / GUI_LOG_WRITER_QZ_BLOCK_LEN;
+    if (num_blocks)
+    {
+        packed.chop(1);
+        QCOMPARE(GUI_LOG_WRITER::decompress_data(packed),
+                 data.left((num_blocks - 1) * GUI_LOG_WRITER_QZ_BLOCK_LEN));
+    }
+
+    // Unknown data is rejected
+    QCOMPARE(GUI_LOG_WRITER::decompress_data(data), QByteArray());
+}
+
+void GUI_LOG_TESTS::test_log_writer_compression_data()
+{
+    // Input data columns
+    QTest::addColumn<int>("data_len");
+
+    // Load in data
+    QTest::newRow("Empty") << 0;
+    QTest::newRow("Small") << 100;
+    QTest::newRow("One block") << GUI_LOG_WRITER_QZ_BLOCK_LEN;
+    QTest::newRow("Partial last block") << ((2 * GUI_LOG_WRITER_QZ_BLOCK_LEN) + 123);
+}
+
+void GUI_LOG_TESTS::test_log_writer_stop()
+{
+    // Fetch data
+    QFETCH(bool, threaded);
+    QFETCH(bool, compress);
+    QFETCH(int, num_rows);
+
+    // Setup writer (exports CSV copy of each segment)
+    GUI_LOG_WRITER writer;
+    Log_Writer_Settings settings = Log_Writer_Settings_DEFAULT;
+    settings.threaded = threaded;
+    settings.compress = compress;
+    settings.export_csv = true;
+    writer.set_settings(settings);
+    QSignalSpy error_spy(&writer, SIGNAL(write_error(QString)));
+    QVERIFY(error_spy.isValid());
+
+    // Open & write rows
+    QString logPath = temp_dir->filePath("stop.bin");
+    QList<Pin_Log_Column> columns = get_test_columns();
+    QVERIFY(writer.open_binary(logPath, columns));
+    qint64 base_ms = QDateTime::currentMSecsSinceEpoch() + 60000;
+    for (int i = 0; i < num_rows; i++)
+        QVERIFY(writer.write_record(base_ms + get_test_time(i), get_test_values(i, columns.length())));
+    QCOMPARE(error_spy.count(), 0);
+
+    // Record after a pin change stops the log (reported once)
+    QVERIFY(!writer.write_record(base_ms, get_test_values(0, columns.length() + 1)));
+    QVERIFY(!writer.is_open());
+    QVERIFY(!writer.write_record(base_ms, get_test_values(0, columns.length())));
+    QCOMPARE(error_spy.count(), 1);
+
+    // Stop returned before worker closes, compresses & exports
+    writer.stop();
+    QTRY_VERIFY(writer.isFinished());
+    QCOMPARE(error_spy.count(), 1);
+
+    // Verify rows before pin change kept & CSV exported
+    QStringList segments = writer.get_segments();
+    QCOMPARE(segments.length(), 1);
+    QCOMPARE(segments.at(0), logPath + (compress ? GUI_LOG_WRITER_QZ_SUFFIX : ""));
+    GUI_PIN_LOG_READER reader;
+    QVERIFY(reader.open(segments.at(0)));
+    QCOMPARE(reader.get_num_records(), (quint64) num_rows);
+    reader.close();
+
+    QFile csvFile(segments.at(0) + ".csv");
+    QVERIFY(csvFile.open(QIODevice::ReadOnly));
+    QVERIFY(csvFile.readAll().startsWith("Started: "));
+    csvFile.close();
+}
+
+void GUI_LOG_TESTS::test_log_writer_stop_data()
+{
+    // Input data columns
+    QTest::addColumn<bool>("threaded");
+    QTest::addColumn<bool>("compress");
+    QTest::addColumn<int>("num_rows");
+
+    // Load in data
+    QTest::newRow("Unthreaded") << false << false << 100;
+    QTest::newRow("Unthreaded compressed") << false << true << 100;
+    QTest::newRow("Threaded compressed") << true << true << 2000;
+}
+
+void GUI_LOG_TESTS::test_log_replay_order()
+{
+    // Fetch data
+    QFETCH(bool, binary);
+    QFETCH(double, speed);
+    QFETCH(int, num_frames);
+    QFETCH(int, period_ms);
+
+    // Write & open log
+    QString logPath = temp_dir->filePath(binary ? "replay.bin" : "replay.txt");
+    QVERIFY(write_replay_log(logPath, binary, num_frames, period_ms));
+    GUI_LOG_REPLAY replay;
+    QVERIFY(replay.open(logPath, {MINOR_KEY_IO_AIO, MINOR_KEY_IO_DIO}));
+    QCOMPARE(replay.get_num_frames(), (quint64) num_frames);
+    qint64 start_ms = replay.get_start_ms();
+    QCOMPARE(replay.get_end_ms() - start_ms, (qint64) (num_frames - 1) * period_ms);
+    QCOMPARE(replay.get_time_ms(), start_ms);
+
+    // Catch replayed rows
+    QList<Replayed_Row> replayed;
+    QElapsedTimer wall;
+    connect(&replay, &GUI_LOG_REPLAY::replay_values,
+            [&](uint8_t pinType, QList<uint8_t> pin_nums, QVector<float> values, qint64 time_ms) {
+        replayed.append(Replayed_Row{.pinType=pinType, .pin_nums=pin_nums, .values=values,
+                                     .time_ms=time_ms, .wall_ms=wall.elapsed()});
+    });
+    QSignalSpy tick_spy(&replay, SIGNAL(replay_tick(qint64)));
+    QSignalSpy done_spy(&replay, SIGNAL(replay_done()));
+    QVERIFY(tick_spy.isValid());
+    QVERIFY(done_spy.isValid());
+
+    // Replay whole log
+    qint64 span_ms = replay.get_end_ms() - start_ms;
+    wall.start();
+    replay.start(speed);
+    QTRY_COMPARE_WITH_TIMEOUT(done_spy.count(), 1, (int) (3 * span_ms) + 5000);
+    qint64 wall_ms = wall.elapsed();
+    QVERIFY(!replay.is_running());
+    QVERIFY(0 < tick_spy.count());
+    if (speed != 0) QVERIFY(replay.get_end_ms() <= replay.get_time_ms());
+    else QCOMPARE(replay.get_time_ms(), replay.get_end_ms());
+
+    // Verify every row in log order (pin types in column order per frame)
+    QList<Pin_Log_Column> columns = get_test_columns();
+    QCOMPARE(replayed.length(), 2 * num_frames);
+    for (int i = 0; i < num_frames; i++)
+    {
+        QVector<float> values = get_test_values(i, columns.length());
+        for (int r = 0; r < 2; r++)
+        {
+            const Replayed_Row &row = replayed.at(2*i + r);
+            QCOMPARE(row.pinType, (uint8_t) (r ? MINOR_KEY_IO_DIO : MINOR_KEY_IO_AIO));
+            QCOMPARE(row.time_ms - start_ms, (qint64) i * period_ms);
+            QCOMPARE(row.values, values.mid(2*r, 2));
+            // Binary rows name their pins, text rows are in pin order
+            if (binary) QCOMPARE(row.pin_nums, QList<uint8_t>({columns.at(2*r).pin_num, columns.at(2*r + 1).pin_num}));
+            else QVERIFY(row.pin_nums.isEmpty());
+
+            // Paced replay never runs ahead of log time
+            if (speed != 0) QVERIFY((row.time_ms - start_ms) <= (qint64) ((row.wall_ms + 2) * speed));
+        }
+    }
+
+    // Paced replay takes log span, unpaced takes far less
+    if (speed != 0) QVERIFY(((span_ms / speed) - 2) <= wall_ms);
+    else QVERIFY(wall_ms < (span_ms / 2));
+}
+
+void GUI_LOG_TESTS::test_log_replay_order_data()
+{
+    // Input data columns
+    QTest::addColumn<bool>("binary");
+    QTest::addColumn<double>("speed");
+    QTest::addColumn<int>("num_frames");
+    QTest::addColumn<int>("period_ms");
+
+    // Load in data
+    QTest::newRow("Text 1x") << false << 1.0 << 40 << 25;
+    QTest::newRow("Text as fast as possible") << false << 0.0 << 2000 << 50;
+    QTest::newRow("Binary 1x") << true << 1.0 << 40 << 25;
+    QTest::newRow("Binary 4x") << true << 4.0 << 100 << 20;
+    QTest::newRow("Binary as fast as possible") << true << 0.0 << 10000 << 10;
+}
+
+void GUI_LOG_TESTS::test_log_replay_seek()
+{
+    // Fetch data
+    QFETCH(bool, binary);
+
+    // Write & open log
+    int num_frames = 200, period_ms = 10;
+    QString logPath = temp_dir->filePath(binary ? "seek.bin" : "seek.txt");
+    QVERIFY(write_replay_log(logPath, binary, num_frames, period_ms));
+    GUI_LOG_REPLAY replay;
+    QVERIFY(replay.open(logPath, {MINOR_KEY_IO_AIO, MINOR_KEY_IO_DIO}));
+    qint64 start_ms = replay.get_start_ms();
+
+    // Catch replayed frame times
+    QList<qint64> times;
+    connect(&replay, &GUI_LOG_REPLAY::replay_values,
+            [&](uint8_t, QList<uint8_t>, QVector<float>, qint64 time_ms) {
+        if (times.isEmpty() || (times.last() != time_ms)) times.append(time_ms);
+    });
+    QSignalSpy done_spy(&replay, SIGNAL(replay_done()));
+    QVERIFY(done_spy.isValid());
+
+    // Seek between frames replays from next frame
+    replay.seek(start_ms + (120 * period_ms) - 5);
+    replay.start(0);
+    QTRY_COMPARE(done_spy.count(), 1);
+    QCOMPARE(times.length(), num_frames - 120);
+    QCOMPARE(times.first(), start_ms + (120 * period_ms));
+
+    // Stop rewinds to first frame
+    replay.stop();
+    QCOMPARE(replay.get_time_ms(), start_ms);
+    times.clear();
+    replay.start(0);
+    QTRY_COMPARE(done_spy.count(), 2);
+    QCOMPARE(times.length(), num_frames);
+    QCOMPARE(times.first(), start_ms);
+
+    // Seek past end replays nothing
+    times.clear();
+    replay.seek(replay.get_end_ms() + 1);
+    replay.start(0);
+    QTRY_COMPARE(done_spy.count(), 3);
+    QVERIFY(times.isEmpty());
+}
+
+void GUI_LOG_TESTS::test_log_replay_seek_data()
+{
+    // Input data columns
+    QTest::addColumn<bool>("binary");
+
+    // Load in data
+    QTest::newRow("Text") << false;
+    QTest::newRow("Binary") << true;
+}
+
+QList<Pin_Log_Column> GUI_LOG_TESTS::get_test_columns()
+{
+    // Two AIO & two DIO pins
+    QList<Pin_Log_Column> columns;
+    columns.append(Pin_Log_Column{.pinType=MINOR_KEY_IO_AIO, .pin_num=0, .mode=1,
+                                  .range=RangeList{.min=0, .max=500, .step=50, .div=100.0}});
+    columns.append(Pin_Log_Column{.pinType=MINOR_KEY_IO_AIO, .pin_num=5, .mode=2,
+                                  .range=RangeList{.min=-5, .max=5, .step=1, .div=2.5}});
+    columns.append(Pin_Log_Column{.pinType=MINOR_KEY_IO_DIO, .pin_num=0, .mode=0,
+                                  .range=RangeList{.min=0, .max=1, .step=1, .div=1.0}});
+    columns.append(Pin_Log_Column{.pinType=MINOR_KEY_IO_DIO, .pin_num=13, .mode=3,
+                                  .range=RangeList{.min=0, .max=255, .step=5, .div=1.0}});
+    return columns;
+}
+
+QVector<float> GUI_LOG_TESTS::get_test_values(quint64 record, int num_cols)
+{
+    // Exact in float
+    QVector<float> values(num_cols);
+    for (int c = 0; c < num_cols; c++)
+        values[c] = (record * 0.5f) + (c * 100) - 3;
+    return values;
+}
+
+qint64 GUI_LOG_TESTS::get_test_time(quint64 record)
+{
+    // Pairs of records share a time
+    return test_start_ms + (qint64) (record / 2) * 10;
+}
+
+bool GUI_LOG_TESTS::write_pin_log(QString filePath, quint64 num_records, uint32_t stride, int flush_every)
+{
+    // Open log
+    GUI_PIN_LOG_WRITER writer;
+    QList<Pin_Log_Column> columns = get_test_columns();
+    if (!writer.open(filePath, columns, test_start_ms, stride)) return false;
+
+    // Append records (flushing every few if set)
+    for (quint64 i = 0; i < num_records; i++)
+    {
+        if (!writer.append(get_test_time(i), get_test_values(i, columns.length()))) return false;
+        if (flush_every && (((i + 1) % flush_every) == 0) && !writer.flush()) return false;
+    }
+
+    // Wrong width is rejected
+    if (writer.append(get_test_time(num_records), QVector<float>(columns.length() + 1))) return false;
+
+    // Write footer & close
+    writer.close();
+    return !writer.is_open();
+}
+
+bool GUI_LOG_TESTS::write_replay_log(QString filePath, bool binary, int num_frames, int period_ms)
+{
+    QList<Pin_Log_Column> columns = get_test_columns();
+    QVector<float> values;
+
+    // Binary log has one record per frame
+    if (binary)
+    {
+        GUI_PIN_LOG_WRITER writer;
+        if (!writer.open(filePath, columns, test_start_ms)) return false;
+        for (int i = 0; i < num_frames; i++)
+        {
+            if (!writer.append(test_start_ms + (qint64) i * period_ms, get_test_values(i, columns.length())))
+                return false;
+        }
+        writer.close();
+        return true;
+    }
+
+    // Text log has one row per pin type per tick (events are skipped)
+    QFile logFile(filePath);
+    if (!logFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) return false;
+    QByteArray text = "Started: " + QDateTime::currentDateTimeUtc().toString().toUtf8()
+            + " with update rate " + QByteArray::number(period_ms / 1000.0) + " seconds\n";
+    for (int i = 0; i < num_frames; i++)
+    {
+        values = get_test_values(i, columns.length());
+        text += QByteArray::number(MINOR_KEY_IO_AIO) + "," + QByteArray::number(values.at(0))
+                + "," + QByteArray::number(values.at(1)) + "\n";
+        text += QByteArray::number(MINOR_KEY_IO_DIO_EVENTS) + ",3,1,12345\n";
+        text += QByteArray::number(MINOR_KEY_IO_DIO) + "," + QByteArray::number(values.at(2))
+                + "," + QByteArray::number(values.at(3)) + "\n";
+    }
+    bool success = (logFile.write(text) == text.length());
+    logFile.close();
+    return success;
+}
+
+void GUI_LOG_TESTS::verify_pin_log(GUI_PIN_LOG_READER *reader, quint64 num_records)
+{
+    // Verify count, times & values
+    int num_cols = get_test_columns().length();
+    QCOMPARE(reader->get_num_records(), num_records);
+    for (quint64 i = 0; i < num_records; i++)
+    {
+        QCOMPARE(reader->get_time(i), get_test_time(i));
+        QCOMPARE(reader->get_value(i, 0), get_test_values(i, num_cols).at(0));
+        QCOMPARE(reader->get_value(i, num_cols - 1), get_test_values(i, num_cols).at(num_cols - 1));
+    }
+
+    // Out of range reads fail
+    QCOMPARE(reader->get_time(num_records), (qint64) -1);
+}
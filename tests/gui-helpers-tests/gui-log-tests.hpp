@@ -0,0 +1,77 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_LOG_TESTS_H
+#define GUI_LOG_TESTS_H
+
+#include <QObject>
+#include <QTemporaryDir>
+
+// Objects under test
+#include "../../src/gui-helpers/gui-pin-log.hpp"
+
+class GUI_LOG_TESTS : public QObject
+{
+    Q_OBJECT
+
+public:
+    GUI_LOG_TESTS();
+    ~GUI_LOG_TESTS();
+
+private slots:
+    // Setup and cleanup functions
+    void init();
+    void cleanup();
+
+    // Binary pin log tests
+    void test_pin_log_seek();
+    void test_pin_log_seek_data();
+
+    void test_pin_log_truncated();
+    void test_pin_log_truncated_data();
+
+    // Log writer tests
+    void test_log_writer_rotation();
+    void test_log_writer_rotation_data();
+
+    void test_log_writer_compression();
+    void test_log_writer_compression_data();
+
+    void test_log_writer_stop();
+    void test_log_writer_stop_data();
+
+    // Log replay tests
+    void test_log_replay_order();
+    void test_log_replay_order_data();
+
+    void test_log_replay_seek();
+    void test_log_replay_seek_data();
+
+private:
+    QTemporaryDir *temp_dir;
+
+    // Test helpers
+    QList<Pin_Log_Column> get_test_columns();
+    QVector<float> get_test_values(quint64 record, int num_cols);
+    qint64 get_test_time(quint64 record);
+    bool write_pin_log(QString filePath, quint64 num_records, uint32_t stride, int flush_every);
+    void verify_pin_log(GUI_PIN_LOG_READER *reader, quint64 num_records);
+    bool write_replay_log(QString filePath, bool binary, int num_frames, int period_ms);
+};
+
+#endif // GUI_LOG_TESTS_H
@@ -0,0 +1,299 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui-pin-tests.hpp"
+
+// Testing infrastructure includes
+#include <QtTest>
+
+#include "../../src/user-interfaces/gui-io-control-minor-keys.h"
+
+// History test sizing (small rings so tiers fill & wrap)
+#define TEST_HISTORY_SETTINGS Pin_History_Settings{\
+    .samples=8, .factor=4, .tiers=2, .buckets=8}
+static const qint64 test_sample_ms = 10;
+
+GUI_PIN_TESTS::GUI_PIN_TESTS()
+{
+    /* DO NOTHING */
+}
+
+GUI_PIN_TESTS::~GUI_PIN_TESTS()
+{
+    /* DO NOTHING */
+}
+
+void GUI_PIN_TESTS::test_store_set_pins()
+{
+    // Fetch data
+    QFETCH(QList<int>, old_pins);
+    QFETCH(QList<int>, new_pins);
+
+    // Set old layout (other pin type must be left alone)
+    GUI_PIN_STORE store;
+    QList<uint8_t> pin_nums;
+    foreach (int pin_num, old_pins) pin_nums.append((uint8_t) pin_num);
+    store.set_pins(MINOR_KEY_IO_AIO, pin_nums);
+    store.set_pins(MINOR_KEY_IO_DIO, QList<uint8_t>({0, 1}));
+    QCOMPARE(store.get_num_pins(MINOR_KEY_IO_AIO), old_pins.length());
+
+    // Set state from pin number
+    int pos;
+    foreach (int pin_num, old_pins)
+    {
+        pos = store.get_pos(MINOR_KEY_IO_AIO, pin_num);
+        QVERIFY(0 <= pos);
+        store.set_mode(MINOR_KEY_IO_AIO, pos, pin_num % 3, get_test_range(pin_num), pin_num % 2);
+        QVERIFY(store.set_raw(MINOR_KEY_IO_AIO, pos, 10 * pin_num, 1000 + pin_num));
+    }
+
+    // Set new layout
+    pin_nums.clear();
+    foreach (int pin_num, new_pins) pin_nums.append((uint8_t) pin_num);
+    store.set_pins(MINOR_KEY_IO_AIO, pin_nums);
+    QCOMPARE(store.get_num_pins(MINOR_KEY_IO_AIO), new_pins.length());
+    QCOMPARE(store.get_num_pins(MINOR_KEY_IO_DIO), 2);
+
+    // Verify removed pins have no position
+    foreach (int pin_num, old_pins)
+    {
+        if (!new_pins.contains(pin_num)) QCOMPARE(store.get_pos(MINOR_KEY_IO_AIO, pin_num), -1);
+    }
+
+    // Verify kept pins carry state & new pins start cleared
+    const Pin_Table *table = store.get_table(MINOR_KEY_IO_AIO);
+    QVERIFY(table);
+    int pin_num;
+    bool kept;
+    RangeList range;
+    for (pos = 0; pos < new_pins.length(); pos++)
+    {
+        pin_num = new_pins.at(pos);
+        QCOMPARE((int) table->pin_num.at(pos), pin_num);
+        QCOMPARE(store.get_pos(MINOR_KEY_IO_AIO, pin_num), pos);
+
+        kept = old_pins.contains(pin_num);
+        range = kept ? get_test_range(pin_num) : EMPTY_RANGE;
+        QCOMPARE((int) table->raw.at(pos), kept ? (10 * pin_num) : 0);
+        QCOMPARE(table->value.at(pos), kept ? qRound(10 * pin_num + range.min * range.div) : 0);
+        QCOMPARE(table->scaled.at(pos), kept ? (double) (((float) table->value.at(pos)) / range.div) : 0.0);
+        QCOMPARE((int) table->mode.at(pos), kept ? (pin_num % 3) : 0);
+        QCOMPARE(table->range.at(pos).min, range.min);
+        QCOMPARE(table->range.at(pos).max, range.max);
+        QCOMPARE(table->range.at(pos).div, range.div);
+        QCOMPARE(table->input.at(pos), kept && (pin_num % 2));
+        QCOMPARE(table->timestamp.at(pos), kept ? (qint64) (1000 + pin_num) : (qint64) 0);
+    }
+}
+
+void GUI_PIN_TESTS::test_store_set_pins_data()
+{
+    // Input data columns
+    QTest::addColumn<QList<int>>("old_pins");
+    QTest::addColumn<QList<int>>("new_pins");
+
+    // Load in data
+    QTest::newRow("Same pins") << QList<int>({0, 1, 2, 3}) << QList<int>({0, 1, 2, 3});
+    QTest::newRow("Pins added") << QList<int>({1, 3}) << QList<int>({0, 1, 2, 3, 4});
+    QTest::newRow("Pins removed") << QList<int>({0, 1, 2, 3, 4}) << QList<int>({1, 4});
+    QTest::newRow("Positions shift") << QList<int>({0, 1, 2, 3}) << QList<int>({2, 3, 4, 5});
+    QTest::newRow("No overlap") << QList<int>({0, 1}) << QList<int>({6, 7});
+    QTest::newRow("All removed") << QList<int>({0, 1, 2}) << QList<int>();
+    QTest::newRow("From empty") << QList<int>() << QList<int>({0, 255});
+    QTest::newRow("High pin numbers") << QList<int>({200, 254, 255}) << QList<int>({100, 255});
+}
+
+void GUI_PIN_TESTS::test_history_range()
+{
+    // Fetch data
+    QFETCH(int, num_samples);
+    QFETCH(qint64, t_start);
+    QFETCH(qint64, t_end);
+    QFETCH(int, max_points);
+    QFETCH(int, expected_points);
+    QFETCH(qint64, expected_width);
+
+    // Append samples (one per test period)
+    GUI_PIN_HISTORY history;
+    history.set_settings(TEST_HISTORY_SETTINGS);
+    history.set_pins(MINOR_KEY_IO_AIO, 2);
+    qint64 t;
+    for (int i = 0; i < num_samples; i++)
+    {
+        t = i * test_sample_ms;
+        history.append(MINOR_KEY_IO_AIO, 1, t, get_history_value(t));
+    }
+    QCOMPARE(history.get_num_appended(MINOR_KEY_IO_AIO, 1), (quint64) num_samples);
+    QCOMPARE(history.get_num_appended(MINOR_KEY_IO_AIO, 0), (quint64) 0);
+
+    // Verify count & tier used (raw samples have no width, tier 0 buckets
+    // merge factor samples, tier 1 merge factor tier 0 buckets)
+    QVector<Pin_Bucket> buckets = history.get_range(MINOR_KEY_IO_AIO, 1, t_start, t_end, max_points);
+    QCOMPARE(buckets.length(), expected_points);
+    if (buckets.isEmpty()) return;
+    QCOMPARE(buckets.first().t_end - buckets.first().t_start, expected_width);
+    QVERIFY(buckets.length() <= max_points);
+
+    // Verify each bucket against its samples (last may be partial)
+    double min, max;
+    for (int i = 0; i < buckets.length(); i++)
+    {
+        const Pin_Bucket &b = buckets.at(i);
+        QVERIFY(b.t_start <= t_end);
+        QVERIFY(t_start <= b.t_end);
+        if (i) QVERIFY(buckets.at(i - 1).t_end < b.t_start);
+        if ((i + 1) < buckets.length()) QCOMPARE(b.t_end - b.t_start, expected_width);
+
+        min = max = get_history_value(b.t_start);
+        for (t = b.t_start; t <= b.t_end; t += test_sample_ms)
+        {
+            min = qMin(min, get_history_value(t));
+            max = qMax(max, get_history_value(t));
+        }
+        QCOMPARE(b.min, min);
+        QCOMPARE(b.max, max);
+    }
+}
+
+void GUI_PIN_TESTS::test_history_range_data()
+{
+    // Input data columns
+    QTest::addColumn<int>("num_samples");
+    QTest::addColumn<qint64>("t_start");
+    QTest::addColumn<qint64>("t_end");
+    QTest::addColumn<int>("max_points");
+
+    // Expected output columns
+    QTest::addColumn<int>("expected_points");
+    QTest::addColumn<qint64>("expected_width");
+
+    // Load in data (8 raw samples, 8 buckets per tier, 4 entries merged per bucket)
+    QTest::newRow("Raw fits") << 6 << (qint64) 0 << (qint64) 50 << 10 << 6 << (qint64) 0;
+    QTest::newRow("Raw too many") << 6 << (qint64) 0 << (qint64) 50 << 3 << 2 << (qint64) 30;
+    QTest::newRow("Raw covers window") << 40 << (qint64) 330 << (qint64) 390 << 100 << 7 << (qint64) 0;
+    QTest::newRow("Tier 0 fits") << 40 << (qint64) 330 << (qint64) 390 << 5 << 2 << (qint64) 30;
+    QTest::newRow("Tier 0 covers window") << 40 << (qint64) 100 << (qint64) 390 << 100 << 8 << (qint64) 30;
+    QTest::newRow("Tier 0 partial") << 42 << (qint64) 100 << (qint64) 410 << 100 << 9 << (qint64) 30;
+    QTest::newRow("Tier 1 covers window") << 40 << (qint64) 0 << (qint64) 390 << 100 << 3 << (qint64) 150;
+    QTest::newRow("Coarsest tier") << 400 << (qint64) 0 << (qint64) 3990 << 4 << 3 << (qint64) 150;
+    QTest::newRow("Empty window") << 40 << (qint64) 390 << (qint64) 0 << 100 << 0 << (qint64) 0;
+}
+
+void GUI_PIN_TESTS::test_scheduler_merged()
+{
+    // Fetch data
+    QFETCH(QList<int>, rates_ms);
+    QFETCH(int, default_ms);
+    QFETCH(bool, enabled);
+    QFETCH(int, busy_pos);
+    QFETCH(int, late_ms);
+    QFETCH(int, duration_ms);
+    QFETCH(int, expected_requests);
+    QFETCH(QList<int>, expected_reads);
+
+    // Setup schedule (other pin type never polled)
+    GUI_PIN_SCHEDULER scheduler;
+    int num_pins = rates_ms.length();
+    scheduler.set_pins(MINOR_KEY_IO_AIO, num_pins);
+    scheduler.set_pins(MINOR_KEY_IO_DIO, num_pins);
+    scheduler.set_default_rate(MINOR_KEY_IO_AIO, default_ms);
+    for (int pos = 0; pos < num_pins; pos++) scheduler.set_rate(MINOR_KEY_IO_AIO, pos, rates_ms.at(pos));
+    scheduler.set_enabled(MINOR_KEY_IO_AIO, enabled);
+    QCOMPARE(scheduler.has_rates(MINOR_KEY_IO_AIO), rates_ms.count(0) != num_pins);
+    QVERIFY(!scheduler.has_rates(MINOR_KEY_IO_DIO));
+    scheduler.start(0);
+
+    // Poll each time a pin is due (late_ms after it), due pins share one request
+    QBitArray busy(num_pins), due;
+    if (0 <= busy_pos) busy.setBit(busy_pos);
+    QList<int> reads;
+    for (int pos = 0; pos < num_pins; pos++) reads.append(0);
+    int requests = 0;
+    qint64 now_ms;
+    while (0 <= scheduler.get_next_due())
+    {
+        now_ms = scheduler.get_next_due() + late_ms;
+        if (duration_ms < now_ms) break;
+        QVERIFY(scheduler.take_due(MINOR_KEY_IO_DIO, now_ms, busy).isEmpty());
+
+        due = scheduler.take_due(MINOR_KEY_IO_AIO, now_ms, busy);
+        if (!due.count(true)) continue;
+        requests += 1;
+        for (int pos = 0; pos < due.size(); pos++)
+        {
+            if (due.testBit(pos)) reads[pos] += 1;
+        }
+    }
+
+    // Verify requests & reads per pin
+    QCOMPARE(requests, expected_requests);
+    QCOMPARE(reads, expected_reads);
+}
+
+void GUI_PIN_TESTS::test_scheduler_merged_data()
+{
+    // Input data columns
+    QTest::addColumn<QList<int>>("rates_ms");
+    QTest::addColumn<int>("default_ms");
+    QTest::addColumn<bool>("enabled");
+    QTest::addColumn<int>("busy_pos");
+    QTest::addColumn<int>("late_ms");
+    QTest::addColumn<int>("duration_ms");
+
+    // Expected output columns
+    QTest::addColumn<int>("expected_requests");
+    QTest::addColumn<QList<int>>("expected_reads");
+
+    // Load in data
+    QTest::newRow("Equal rates")
+            << QList<int>({100, 100, 100}) << 0 << true << -1 << 0 << 1000
+            << 11 << QList<int>({11, 11, 11});
+    QTest::newRow("Multiple rates")
+            << QList<int>({100, 200, 400}) << 0 << true << -1 << 0 << 1000
+            << 11 << QList<int>({11, 6, 3});
+    QTest::newRow("Default rate")
+            << QList<int>({0, 0, 250}) << 500 << true << -1 << 0 << 1000
+            << 5 << QList<int>({3, 3, 5});
+    QTest::newRow("Unpolled pin")
+            << QList<int>({0, 300}) << 0 << true << -1 << 0 << 1000
+            << 4 << QList<int>({0, 4});
+    QTest::newRow("Unaligned rates")
+            << QList<int>({300, 200}) << 0 << true << -1 << 0 << 1000
+            << 8 << QList<int>({4, 6});
+    QTest::newRow("Busy pin skipped")
+            << QList<int>({100, 100}) << 0 << true << 1 << 0 << 1000
+            << 11 << QList<int>({11, 0});
+    QTest::newRow("Late polls skip missed periods")
+            << QList<int>({100, 200}) << 0 << true << -1 << 250 << 1000
+            << 3 << QList<int>({3, 3});
+    QTest::newRow("Disabled")
+            << QList<int>({100, 200}) << 100 << false << -1 << 0 << 1000
+            << 0 << QList<int>({0, 0});
+}
+
+RangeList GUI_PIN_TESTS::get_test_range(uint8_t pin_num)
+{
+    // Range from pin number (every other pin scaled)
+    return RangeList{.min=pin_num, .max=pin_num + 100, .step=1, .div=(pin_num % 2) ? 10.0f : 1.0f};
+}
+
+double GUI_PIN_TESTS::get_history_value(qint64 t)
+{
+    // Repeatable value jumping up & down
+    return ((t / test_sample_ms) * 37) % 23 - 11.0;
+}
@@ -0,0 +1,56 @@
+/*
+ * uC Interface - A GUI for Programming & Interfacing with Microcontrollers
+ * Copyright (C) 2018  Mitchell Oleson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GUI_PIN_TESTS_H
+#define GUI_PIN_TESTS_H
+
+#include <QObject>
+
+// Objects under test
+#include "../../src/gui-helpers/gui-pin-store.hpp"
+#include "../../src/gui-helpers/gui-pin-history.hpp"
+#include "../../src/gui-helpers/gui-pin-scheduler.hpp"
+
+class GUI_PIN_TESTS : public QObject
+{
+    Q_OBJECT
+
+public:
+    GUI_PIN_TESTS();
+    ~GUI_PIN_TESTS();
+
+private slots:
+    // Pin store tests
+    void test_store_set_pins();
+    void test_store_set_pins_data();
+
+    // Pin history tests
+    void test_history_range();
+    void test_history_range_data();
+
+    // Poll scheduler tests
+    void test_scheduler_merged();
+    void test_scheduler_merged_data();
+
+private:
+    // Test helpers
+    RangeList get_test_range(uint8_t pin_num);
+    double get_history_value(qint64 t);
+};
+
+#endif // GUI_PIN_TESTS_H
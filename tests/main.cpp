@@ -21,6 +21,12 @@
 #include <QCoreApplication>
 
 // Testing classes
+#include "communication-tests/comms-base-tests.hpp"
+#include "communication-tests/link-emulator-tests.hpp"
+#include "gui-helpers-tests/gui-chart-tests.hpp"
+#include "gui-helpers-tests/gui-device-clock-tests.hpp"
+#include "gui-helpers-tests/gui-log-tests.hpp"
+#include "gui-helpers-tests/gui-pin-tests.hpp"
 #include "user-interfaces-tests/gui-base-tests.hpp"
 #include "user-interfaces-tests/gui-welcome-tests.hpp"
 #include "user-interfaces-tests/gui-io-control-tests.hpp"
@@ -50,6 +56,30 @@ int main(int argc, char *argv[])
         argList.removeAll("-interfaceForceParamsOff");
     }
 
+    /* Comms Base Tests */
+    COMMS_BASE_TESTS comms_base_tester;
+    status += QTest::qExec(&comms_base_tester, argList);
+
+    /* Link Emulator Tests */
+    LINK_EMULATOR_TESTS link_emulator_tester;
+    status += QTest::qExec(&link_emulator_tester, argList);
+
+    /* GUI Log Tests */
+    GUI_LOG_TESTS gui_log_tester;
+    status += QTest::qExec(&gui_log_tester, argList);
+
+    /* GUI Chart Tests */
+    GUI_CHART_TESTS gui_chart_tester;
+    status += QTest::qExec(&gui_chart_tester, argList);
+
+    /* GUI Pin Tests */
+    GUI_PIN_TESTS gui_pin_tester;
+    status += QTest::qExec(&gui_pin_tester, argList);
+
+    /* GUI Device Clock Tests */
+    GUI_DEVICE_CLOCK_TESTS gui_device_clock_tester;
+    status += QTest::qExec(&gui_device_clock_tester, argList);
+
     /* GUI Base Tests */
     GUI_BASE_TESTS gui_base_tester;
     status += QTest::qExec(&gui_base_tester, argList);
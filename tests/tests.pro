@@ -25,4 +25,6 @@ include(../src/uc-interfaces/uc-interfaces.pri)
 include(../src/user-interfaces/user-interfaces.pri)
 
 # Include local test files
+include(communication-tests/communication-tests.pri)
+include(gui-helpers-tests/gui-helpers-tests.pri)
 include(user-interfaces-tests/user-interfaces-tests.pri)
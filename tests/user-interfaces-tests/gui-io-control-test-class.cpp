@@ -231,6 +231,16 @@ void GUI_IO_CONTROL_TEST_CLASS::request_read_all_test(uint8_t pinType)
     request_read_all(pinType);
 }
 
+QByteArray GUI_IO_CONTROL_TEST_CLASS::get_read_all_request_test(uint8_t pinType)
+{
+    return get_read_all_request(pinType);
+}
+
+QByteArray GUI_IO_CONTROL_TEST_CLASS::unpack_read_all_test(uint8_t minorKey, QByteArray values)
+{
+    return unpack_read_all(minorKey, values);
+}
+
 void GUI_IO_CONTROL_TEST_CLASS::request_read_pin_test(uint8_t pinType, uint8_t pinNum)
 {
     request_read_pin(pinType, pinNum);
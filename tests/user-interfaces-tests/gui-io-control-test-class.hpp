@@ -84,6 +84,9 @@ public:
     void request_read_all_test(uint8_t pinType);
     void request_read_pin_test(uint8_t pinType, uint8_t pinNum);
 
+    QByteArray get_read_all_request_test(uint8_t pinType);
+    QByteArray unpack_read_all_test(uint8_t minorKey, QByteArray values);
+
     bool set_pin_test(QString pin_str, QString combo_value, int slider_value);
     bool perform_action_test(QString pin_str, uint8_t button, QVariant value);
 
@@ -23,6 +23,9 @@
 #include <QSignalSpy>
 
 #include "../../src/gui-helpers/gui-generic-helper.hpp"
+#include "../../src/gui-helpers/gui-comm-bridge.hpp"
+#include "../../src/communication/link-emulator.hpp"
+#include "gui-base-test-class.hpp"
 
 // Object includes
 #include <QFile>
@@ -52,6 +55,21 @@ GUI_IO_CONTROL_TESTS::generic_config_str = \
         "\"4=Output\",\\\n" \
         "\"5=Input,Output\"\n";
 
+// Setup round_trip_config_str (pin counts match emulated uC)
+const QString
+GUI_IO_CONTROL_TESTS::round_trip_config_str = \
+        "[IO]\n" \
+        "tab_name=\"IO\"\n" \
+        "dio_combo_settings = \\\n" \
+        "\"Input,true,0:1:1:1.0\",\\\n" \
+        "\"PWM,false,0:65535:1:1.0\"\n" \
+        "dio_pin_settings = \\\n" \
+        "\"0:13=Input,PWM\"\n" \
+        "aio_combo_settings = \\\n" \
+        "\"Input,true,0:4095:1:1.0\"\n" \
+        "aio_pin_settings = \\\n" \
+        "\"0:5=Input\"\n";
+
 GUI_IO_CONTROL_TESTS::GUI_IO_CONTROL_TESTS()
 {
     /* DO NOTHING */
@@ -2857,6 +2875,384 @@ void GUI_IO_CONTROL_TESTS::test_chart_update_features_data()
                                    << expected_signals_list;
 }
 
+void GUI_IO_CONTROL_TESTS::test_packed_round_trip()
+{
+    // Fetch data
+    QFETCH(QString, read_settings);
+    QFETCH(quint8, pin_type);
+    QFETCH(QList<QList<int>>, pin_values);
+    QFETCH(QList<bool>, truncate);
+    QFETCH(QList<int>, expected_requests);
+    QFETCH(QList<QList<int>>, expected_values);
+
+    // Verify input data
+    int num_steps = pin_values.length();
+    QCOMPARE(truncate.length(), num_steps);
+    QCOMPARE(expected_requests.length(), num_steps);
+    QCOMPARE(expected_values.length(), num_steps);
+
+    // Set pin counts to match emulated uC & reset GUI (clears delta sync)
+    QVERIFY(set_gui_config(round_trip_config_str + read_settings));
+    io_control_tester->reset_gui();
+
+    // Setup emulated uC & bridge (uC encodes with uc-generic-io)
+    Link_Emulator_Settings link_settings = Link_Emulator_Settings_DEFAULT;
+    LINK_EMULATOR emulator(&link_settings);
+    GUI_COMM_BRIDGE bridge(MAJOR_KEY_DEV_READY);
+    bridge.attach_device(&emulator);
+    QVERIFY(bridge.open_bridge());
+    emulator.open();
+    QVERIFY(emulator.isConnected());
+
+    // Catch responses bridge passes to IO GUIs
+    GUI_BASE_TEST_CLASS io_receiver;
+    io_receiver.set_gui_key_test(MAJOR_KEY_IO);
+    bridge.add_gui(&io_receiver);
+    QSignalSpy response_spy(&io_receiver, SIGNAL(readyRead(QByteArray)));
+    QVERIFY(response_spy.isValid());
+
+    // Setup keys
+    bool is_dio = (pin_type == MINOR_KEY_IO_DIO);
+    uint8_t write_key = is_dio ? MINOR_KEY_IO_DIO_WRITE : MINOR_KEY_IO_AIO_WRITE;
+    uint8_t read_key = is_dio ? MINOR_KEY_IO_DIO_READ_ALL : MINOR_KEY_IO_AIO_READ_ALL;
+    uint8_t packed_key = is_dio ? MINOR_KEY_IO_DIO_READ_ALL_PACKED : MINOR_KEY_IO_AIO_READ_ALL_PACKED;
+
+    // Setup loop variables
+    QByteArray writes, request, response, expected;
+
+    for (int i = 0; i < num_steps; i++)
+    {
+        // Write step values to uC pins (one packet per pin)
+        writes.clear();
+        for (int pin = 0; pin < pin_values.at(i).length(); pin++)
+        {
+            writes.append((char) pin);
+            writes.append((char) ((pin_values.at(i).at(pin) >> 8) & 0xFF));
+            writes.append((char) (pin_values.at(i).at(pin) & 0xFF));
+        }
+        bridge.set_chunk_size(s2_io_write_end);
+        bridge.send_chunk(MAJOR_KEY_IO, write_key, writes);
+
+        // Verify GUI asks for expected encoding (keyframe after mismatch)
+        request = io_control_tester->get_read_all_request_test(pin_type);
+        QCOMPARE(request.length(), 1);
+        QCOMPARE((int) request.at(s2_io_packed_encoding_loc), expected_requests.at(i));
+
+        // Request packed read all from uC
+        bridge.set_chunk_size(GUI_COMM_BRIDGE::default_chunk_size);
+        bridge.send_chunk(MAJOR_KEY_IO, read_key, request);
+        QTRY_COMPARE(response_spy.count(), 1);
+        response = response_spy.takeFirst().at(0).toByteArray();
+        QCOMPARE((uint8_t) response.at(s1_minor_key_loc), packed_key);
+        response.remove(0, s1_end_loc);
+
+        // Drop last byte to force a length mismatch
+        if (truncate.at(i)) response.chop(1);
+
+        // Build expected read all layout (empty if mismatch)
+        expected.clear();
+        foreach (int value, expected_values.at(i))
+        {
+            expected.append((char) ((value >> 8) & 0xFF));
+            expected.append((char) (value & 0xFF));
+        }
+
+        // Verify host decode
+        QCOMPARE(io_control_tester->unpack_read_all_test(packed_key, response), expected);
+    }
+
+    // Stop uC before objects go out of scope
+    bridge.remove_gui(&io_receiver);
+    emulator.close();
+}
+
+void GUI_IO_CONTROL_TESTS::test_scheduled_high_pins()
+{
+    // Set 80 aio inputs with only pins above 63 polled fast & reset GUI
+    QVERIFY(set_gui_config(
+                "[IO]\n" \
+                "tab_name=\"IO\"\n" \
+                "aio_combo_settings = \\\n" \
+                "\"Input,true,0:4095:1:1.0\"\n" \
+                "aio_pin_settings = \\\n" \
+                "\"0:79=Input\"\n" \
+                "aio_pin_rates = \\\n" \
+                "\"70:79=0.05\"\n"));
+    io_control_tester->reset_gui();
+
+    // Setup spy to catch requests
+    QSignalSpy transmit_chunk_spy(io_control_tester, io_control_tester->transmit_chunk);
+    QVERIFY(transmit_chunk_spy.isValid());
+
+    // Build expected read pins request (pins 70 to 79)
+    QByteArray expected_mask(10, 0);
+    expected_mask[8] = (char) 0xC0;
+    expected_mask[9] = (char) 0xFF;
+    QByteArray expected_request;
+    expected_request.append((char) expected_mask.length());
+    expected_request.append(expected_mask);
+
+    // Start updater with slow type rate (every pin due at start)
+    io_control_tester->set_aio_update_rate_test(10);
+    io_control_tester->update_rate_start_clicked_test();
+
+    // Wait for fast pins to come due again (first request is read all)
+    QList<QVariant> spy_args;
+    bool found = false;
+    for (int i = 0; (i < 20) && !found; i++)
+    {
+        QTest::qWait(50);
+        while (!found && transmit_chunk_spy.count())
+        {
+            spy_args = transmit_chunk_spy.takeFirst();
+            if (spy_args.at(1).toUInt() != MINOR_KEY_IO_AIO_READ_PINS) continue;
+
+            // Verify mask covers pins above 63
+            QCOMPARE(spy_args.at(0).toUInt(), (uint) MAJOR_KEY_IO);
+            QCOMPARE(spy_args.at(2).toByteArray(), expected_request);
+            found = true;
+        }
+    }
+    QVERIFY(found);
+
+    // Respond with values for requested pins
+    QByteArray response = GUI_GENERIC_HELPER::qList_to_byteArray({MAJOR_KEY_IO,
+                                                                   MINOR_KEY_IO_AIO_READ_PINS});
+    response.append(expected_request);
+    for (int pin = 70; pin < 80; pin++)
+    {
+        response.append((char) 0x00);
+        response.append((char) pin);
+    }
+    emit io_control_tester->readyRead(response);
+    qApp->processEvents();
+
+    // Verify high pins updated
+    QVERIFY(io_control_tester->check_pin_test("AIO_70", "Input", 70, "70", true));
+    QVERIFY(io_control_tester->check_pin_test("AIO_79", "Input", 79, "79", true));
+
+    // Stop updater
+    io_control_tester->update_rate_stop_clicked_test();
+}
+
+void GUI_IO_CONTROL_TESTS::test_packed_round_trip_data()
+{
+    // Input data columns
+    // Each step writes pin_values to the uC then requests a read all
+    QTest::addColumn<QString>("read_settings");
+    QTest::addColumn<quint8>("pin_type");
+    QTest::addColumn<QList<QList<int>>>("pin_values");
+    QTest::addColumn<QList<bool>>("truncate");
+
+    // Expected output columns (empty values if decode rejects response)
+    QTest::addColumn<QList<int>>("expected_requests");
+    QTest::addColumn<QList<QList<int>>>("expected_values");
+
+    // AIO 10 bit (values above width clamp to max)
+    QTest::newRow("AIO 10 bit") << QString("packed_reads=\"true\"\naio_packed_bits=\"10\"\n")
+                                << (quint8) MINOR_KEY_IO_AIO
+                                << QList<QList<int>>({{0, 1, 511, 1023, 1024, 4095}})
+                                << QList<bool>({false})
+                                << QList<int>({io_packed_aio_10})
+                                << QList<QList<int>>({{0, 1, 511, 1023, 1023, 1023}});
+
+    // AIO 12 bit (values above width clamp to max)
+    QTest::newRow("AIO 12 bit") << QString("packed_reads=\"true\"\naio_packed_bits=\"12\"\n")
+                                << (quint8) MINOR_KEY_IO_AIO
+                                << QList<QList<int>>({{4095, 2048, 0, 5, 4096, 0xFFFF},
+                                                      {1, 2, 3, 0xA5A, 0x5A5, 0xFFF}})
+                                << QList<bool>({false, false})
+                                << QList<int>({io_packed_aio_12, io_packed_aio_12})
+                                << QList<QList<int>>({{4095, 2048, 0, 5, 4095, 4095},
+                                                      {1, 2, 3, 0xA5A, 0x5A5, 0xFFF}});
+
+    // DIO bits (wide pins send full values, spans two mask bytes)
+    QTest::newRow("DIO bits & wide pins") << QString("packed_reads=\"true\"\n")
+                                          << (quint8) MINOR_KEY_IO_DIO
+                                          << QList<QList<int>>({{0, 1, 0, 1, 255, 0, 1000, 1, 0, 0, 2, 1, 0, 0xFFFF},
+                                                                {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+                                                                {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}})
+                                          << QList<bool>({false, false, false})
+                                          << QList<int>({io_packed_dio_bits, io_packed_dio_bits, io_packed_dio_bits})
+                                          << QList<QList<int>>({{0, 1, 0, 1, 255, 0, 1000, 1, 0, 0, 2, 1, 0, 0xFFFF},
+                                                                {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+                                                                {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}});
+
+    // DIO delta (keyframe, delta, mismatch drops update, keyframe resyncs)
+    QTest::newRow("DIO delta resync") << QString("delta_reads=\"true\"\n")
+                                      << (quint8) MINOR_KEY_IO_DIO
+                                      << QList<QList<int>>({{0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1},
+                                                            {0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 300},
+                                                            {0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 300},
+                                                            {1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 300},
+                                                            {1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 301}})
+                                      << QList<bool>({false, false, true, false, false})
+                                      << QList<int>({io_packed_delta_keyframe, io_packed_delta,
+                                                     io_packed_delta, io_packed_delta_keyframe,
+                                                     io_packed_delta})
+                                      << QList<QList<int>>({{0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1},
+                                                            {0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 300},
+                                                            {},
+                                                            {1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 300},
+                                                            {1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 301}});
+
+    // AIO delta (no changes sends empty mask, mismatch then resync)
+    QTest::newRow("AIO delta resync") << QString("delta_reads=\"true\"\n")
+                                      << (quint8) MINOR_KEY_IO_AIO
+                                      << QList<QList<int>>({{10, 20, 30, 40, 50, 60},
+                                                            {10, 20, 30, 40, 50, 60},
+                                                            {11, 20, 30, 40, 50, 61},
+                                                            {11, 20, 30, 40, 50, 61}})
+                                      << QList<bool>({false, false, true, false})
+                                      << QList<int>({io_packed_delta_keyframe, io_packed_delta,
+                                                     io_packed_delta, io_packed_delta_keyframe})
+                                      << QList<QList<int>>({{10, 20, 30, 40, 50, 60},
+                                                            {10, 20, 30, 40, 50, 60},
+                                                            {},
+                                                            {11, 20, 30, 40, 50, 61}});
+}
+
+void GUI_IO_CONTROL_TESTS::test_stream_high_pins()
+{
+    // Set 70 streamed aio inputs (stream mask stops at pin 63) & reset GUI
+    QVERIFY(set_gui_config(
+                "[IO]\n" \
+                "tab_name=\"IO\"\n" \
+                "stream_updates=\"true\"\n" \
+                "aio_combo_settings = \\\n" \
+                "\"Input,true,0:4095:1:1.0\"\n" \
+                "aio_pin_settings = \\\n" \
+                "\"0:69=Input\"\n"));
+    io_control_tester->reset_gui();
+
+    // Setup spy to catch requests
+    QSignalSpy transmit_chunk_spy(io_control_tester, io_control_tester->transmit_chunk);
+    QVERIFY(transmit_chunk_spy.isValid());
+
+    // Build expected read pins request (pins 64 to 69)
+    QByteArray expected_request;
+    expected_request.append((char) 9);
+    expected_request.append(QByteArray(8, 0));
+    expected_request.append((char) 0x3F);
+
+    // Start streams (aio every 50 ms)
+    io_control_tester->set_aio_update_rate_test(0.05);
+    io_control_tester->update_rate_start_clicked_test();
+
+    // Verify subscribe covers pins 0 to 63 only
+    QList<QVariant> spy_args;
+    bool subscribed = false;
+    while (!subscribed && transmit_chunk_spy.count())
+    {
+        spy_args = transmit_chunk_spy.takeFirst();
+        if (spy_args.at(1).toUInt() != MINOR_KEY_IO_AIO_STREAM) continue;
+        QCOMPARE(spy_args.at(2).toByteArray(),
+                 GUI_GENERIC_HELPER::qList_to_byteArray({0x00, 0x32}) + QByteArray(8, (char) 0xFF));
+        subscribed = true;
+    }
+    QVERIFY(subscribed);
+
+    // Verify pins past the stream mask keep being polled
+    bool found = false;
+    for (int i = 0; (i < 20) && !found; i++)
+    {
+        QTest::qWait(50);
+        while (!found && transmit_chunk_spy.count())
+        {
+            spy_args = transmit_chunk_spy.takeFirst();
+            if (spy_args.at(1).toUInt() != MINOR_KEY_IO_AIO_READ_PINS) continue;
+            QCOMPARE(spy_args.at(2).toByteArray(), expected_request);
+            found = true;
+        }
+    }
+    QVERIFY(found);
+
+    // Verify stop unsubscribes & stops polling
+    io_control_tester->update_rate_stop_clicked_test();
+    transmit_chunk_spy.clear();
+    QTest::qWait(150);
+    foreach (QList<QVariant> args, transmit_chunk_spy)
+        QVERIFY(args.at(1).toUInt() != MINOR_KEY_IO_AIO_READ_PINS);
+}
+
+void GUI_IO_CONTROL_TESTS::test_stream_round_trip()
+{
+    // Fetch data
+    QFETCH(quint32, seed);
+    QFETCH(double, drop_rate);
+    QFETCH(int, stream_timeout_ms);
+
+    // Set pin counts to match emulated uC & reset GUI
+    QVERIFY(set_gui_config(round_trip_config_str));
+    io_control_tester->reset_gui();
+
+    // Setup emulated uC & bridge (uC streams with uc-generic-io)
+    Link_Emulator_Settings link_settings = Link_Emulator_Settings_DEFAULT;
+    link_settings.drop_rate = drop_rate;
+    link_settings.seed = seed;
+    LINK_EMULATOR emulator(&link_settings);
+    GUI_COMM_BRIDGE bridge(MAJOR_KEY_DEV_READY);
+    bridge.attach_device(&emulator);
+    QVERIFY(bridge.open_bridge());
+    emulator.open();
+    QVERIFY(emulator.isConnected());
+
+    // IO GUI marks stream keys (bridge acks them in batches)
+    bridge.add_gui(io_control_tester);
+
+    // Subscribe aio stream [interval_high, interval_low, mask] (1 ms, all pins)
+    bridge.send_chunk(MAJOR_KEY_IO, MINOR_KEY_IO_AIO_STREAM,
+                      GUI_GENERIC_HELPER::qList_to_byteArray({0x00, 0x01, 0x3F}));
+
+    // Verify stream keeps flowing past the ack window
+    // (without batched acks uC holds every window for packet_timeout)
+    QTRY_VERIFY_WITH_TIMEOUT((quint64) (4 * stream_ack_window) <= get_stream_packets(&bridge),
+                             stream_timeout_ms);
+
+    // Read dio mid stream (batched acks must never ack the response)
+    quint64 num_reads;
+    for (int i = 0; i < 5; i++)
+    {
+        num_reads = bridge.get_rx_stats(MAJOR_KEY_IO, MINOR_KEY_IO_DIO_READ_ALL).packets;
+        bridge.send_chunk(MAJOR_KEY_IO, MINOR_KEY_IO_DIO_READ_ALL, QByteArray());
+        QTRY_VERIFY_WITH_TIMEOUT(
+                    num_reads < bridge.get_rx_stats(MAJOR_KEY_IO, MINOR_KEY_IO_DIO_READ_ALL).packets,
+                    stream_timeout_ms);
+    }
+
+    // Verify stream still flowing after reads
+    quint64 num_stream = get_stream_packets(&bridge);
+    QTRY_VERIFY_WITH_TIMEOUT(num_stream < get_stream_packets(&bridge), stream_timeout_ms);
+
+    // Stop stream (empty mask) & let packets in flight arrive
+    bridge.send_chunk(MAJOR_KEY_IO, MINOR_KEY_IO_AIO_STREAM,
+                      GUI_GENERIC_HELPER::qList_to_byteArray({0x00, 0x00}));
+    QTest::qWait(100);
+
+    // Verify no more stream packets
+    num_stream = get_stream_packets(&bridge);
+    QTest::qWait(200);
+    QCOMPARE(get_stream_packets(&bridge), num_stream);
+
+    // Stop uC before objects go out of scope
+    bridge.remove_gui(io_control_tester);
+    emulator.close();
+}
+
+void GUI_IO_CONTROL_TESTS::test_stream_round_trip_data()
+{
+    // Input data columns
+    QTest::addColumn<quint32>("seed");
+    QTest::addColumn<double>("drop_rate");
+    QTest::addColumn<int>("stream_timeout_ms");
+
+    // Load in data
+    // Clean link must pass 4 ack windows before uC would resume unacked
+    QTest::newRow("Clean") << (quint32) 1 << 0.0 << (int) packet_timeout;
+    QTest::newRow("Drop 5% (seed 7)") << (quint32) 7 << 0.05 << 10000;
+    QTest::newRow("Drop 10% (seed 42)") << (quint32) 42 << 0.10 << 10000;
+}
+
 bool GUI_IO_CONTROL_TESTS::set_gui_config(QString config_str)
 {
     // Clear current config
@@ -2880,6 +3276,13 @@ bool GUI_IO_CONTROL_TESTS::set_gui_config(QString config_str)
     return true;
 }
 
+quint64 GUI_IO_CONTROL_TESTS::get_stream_packets(GUI_COMM_BRIDGE *bridge)
+{
+    // Count aio stream packets (with or without device time)
+    return bridge->get_rx_stats(MAJOR_KEY_IO, MINOR_KEY_IO_AIO_STREAM).packets
+            + bridge->get_rx_stats(MAJOR_KEY_IO, MINOR_KEY_IO_AIO_STREAM | io_timestamp_flag).packets;
+}
+
 void GUI_IO_CONTROL_TESTS::clear_gui_config()
 {
     // Clear current config
@@ -2931,3 +3334,4 @@ void GUI_IO_CONTROL_TESTS::verify_reset_values()
     // Check update rate
     QCOMPARE(io_control_tester->get_update_rate_start_text_test(), QString("Start"));
 }
+
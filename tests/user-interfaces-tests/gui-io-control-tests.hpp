@@ -23,6 +23,7 @@
 
 // Testing class
 #include "gui-io-control-test-class.hpp"
+#include "../../src/gui-helpers/gui-comm-bridge.hpp"
 
 class GUI_IO_CONTROL_TESTS : public QObject
 {
@@ -67,15 +68,27 @@ private slots:
     void test_chart_update_features();
     void test_chart_update_features_data();
 
+    void test_packed_round_trip();
+    void test_packed_round_trip_data();
+
+    void test_scheduled_high_pins();
+    void test_stream_high_pins();
+
+    void test_stream_round_trip();
+    void test_stream_round_trip_data();
+
 private:
     GUI_IO_CONTROL_TEST_CLASS *io_control_tester;
     QString temp_filename;
 
     static const QString generic_config_str;
+    static const QString round_trip_config_str;
 
     bool set_gui_config(QString config_str);
     void clear_gui_config();
 
+    quint64 get_stream_packets(GUI_COMM_BRIDGE *bridge);
+
     bool reset_tempFile();
     bool remove_tempFile();
 